@@ -0,0 +1,624 @@
+#include"add_benchmarks.h"
+#include"../Utilities/random.h"
+#include"auction_matching.h"
+#include"bellman_ford_shortest_paths.h"
+#include"blocked_floyd_warshall.h"
+#include"boruvka_mst.h"
+#include"create_random_graph.h"
+#include"delta_stepping_shortest_paths.h"
+#include"dinic_flow.h"
+#include"dijkstra.h"
+#include"dijkstra_monotone.h"
+#include"edmonds_karp_flow.h"
+#include"filter_kruskal_mst.h"
+#include"flow_edge.h"
+#include"hopcroft_karp_csr.h"
+#include"hungarian_matching.h"
+#include"jonker_volgenant_matching.h"
+#include"max_2c_matching_karzanov_hopcroft_karp.h"
+#include"min_cost_flow_graph.h"
+#include"parallel_boruvka_mst.h"
+#include"push_relabel_flow.h"
+#include<memory>
+#include<utility>
+
+namespace
+{
+    using vertex_t = std::int32_t;
+    using weight_t = std::int64_t;
+    using graph_t = Standard::Algorithms::Graphs::graph<vertex_t, weight_t>;
+
+    constexpr weight_t max_weight = 1'000;
+    constexpr weight_t infinite_weight = std::numeric_limits<weight_t>::max() / 2;
+    constexpr vertex_t source_vertex{};
+
+    // The degree is about the vertex count divided by the "sparsity".
+    [[nodiscard]] auto random_digraph(const std::size_t vertex_count, const std::size_t sparsity)
+        -> std::shared_ptr<const graph_t>
+    {
+        assert(1U < vertex_count && 0U < sparsity);
+
+        auto result = std::make_shared<graph_t>(vertex_count);
+        const auto degree = std::max<std::size_t>(1U, vertex_count / sparsity);
+        const auto max_vertex = static_cast<vertex_t>(vertex_count - 1U);
+
+        Standard::Algorithms::Utilities::random_t<vertex_t> rnd(vertex_t{}, max_vertex);
+        Standard::Algorithms::Utilities::random_t<weight_t> rwe(1, max_weight);
+
+        for (vertex_t from{}; from <= max_vertex; ++from)
+        {
+            for (std::size_t index{}; index < degree; ++index)
+            {
+                if (const auto tod = rnd(); tod != from)
+                {
+                    constexpr auto add_reverse_edge = false;
+
+                    result->add_edge(from, tod, rwe(), add_reverse_edge);
+                }
+            }
+        }
+
+        return result;
+    }
+
+    // Where do the heap and the dense O(n*n) versions cross over?
+    template<std::size_t sparsity>
+    [[nodiscard]] auto prior_que_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            auto graph = random_digraph(size, sparsity);
+            auto distances = std::make_shared<std::vector<weight_t>>();
+            auto parents = std::make_shared<std::vector<vertex_t>>();
+
+            return [graph, distances, parents]
+            {
+                Standard::Algorithms::Graphs::dijkstra_prior_que<vertex_t, weight_t>::run(
+                    *graph, Standard::Algorithms::Graphs::absent_parent, infinite_weight, source_vertex, *distances,
+                    *parents);
+            };
+        };
+    }
+
+    // The lazy insertion heaps for integer weights.
+    template<class dijkstra_t, std::size_t sparsity>
+    [[nodiscard]] auto monotone_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            auto graph = random_digraph(size, sparsity);
+            auto distances = std::make_shared<std::vector<weight_t>>();
+            auto parents = std::make_shared<std::vector<vertex_t>>();
+
+            return [graph, distances, parents]
+            {
+                dijkstra_t::run(*graph, Standard::Algorithms::Graphs::absent_parent, infinite_weight, source_vertex,
+                    *distances, *parents);
+            };
+        };
+    }
+
+    template<std::size_t sparsity>
+    [[nodiscard]] auto delta_stepping_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            using csr_graph_t = Standard::Algorithms::Graphs::csr_graph<vertex_t, weight_t>;
+
+            auto graph = std::make_shared<const csr_graph_t>(*random_digraph(size, sparsity));
+            auto distances = std::make_shared<std::vector<weight_t>>();
+            auto parents = std::make_shared<std::vector<vertex_t>>();
+
+            return [graph, distances, parents]
+            {
+                Standard::Algorithms::Graphs::delta_stepping_shortest_paths<vertex_t, weight_t>(
+                    *graph, source_vertex, *distances, *parents, infinite_weight);
+            };
+        };
+    }
+
+    [[nodiscard]] auto floyd_warshall_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            constexpr auto sparsity = 8U;
+
+            auto graph = random_digraph(size, sparsity);
+            auto distances = std::make_shared<std::vector<std::vector<weight_t>>>();
+            auto nexts = std::make_shared<std::vector<std::vector<std::int32_t>>>();
+
+            return [graph, distances, nexts]
+            {
+                [[maybe_unused]] const auto good = Standard::Algorithms::Graphs::floyd_warshall_shortest_paths(
+                    graph->adjacency_lists(), *distances, *nexts, infinite_weight);
+            };
+        };
+    }
+
+    [[nodiscard]] auto blocked_floyd_warshall_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            constexpr auto sparsity = 8U;
+
+            auto graph = random_digraph(size, sparsity);
+            auto paths = std::make_shared<Standard::Algorithms::Graphs::flat_shortest_paths<weight_t>>();
+
+            return [graph, paths]
+            {
+                [[maybe_unused]] const auto good =
+                    Standard::Algorithms::Graphs::blocked_floyd_warshall_shortest_paths<weight_t>(
+                        graph->adjacency_lists(), *paths, infinite_weight);
+            };
+        };
+    }
+
+    using mst_weight_t = std::int32_t;
+    using mst_edge_t = std::tuple<std::int32_t, std::int32_t, mst_weight_t>;
+
+    [[nodiscard]] auto random_edge_list(const std::size_t vertex_count)
+        -> std::shared_ptr<const std::vector<mst_edge_t>>
+    {
+        constexpr auto degree = 8U;
+        constexpr mst_weight_t max_mst_weight = 1'000'000'000;
+
+        const auto max_vertex = static_cast<std::int32_t>(vertex_count - 1U);
+
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd(0, max_vertex);
+        Standard::Algorithms::Utilities::random_t<mst_weight_t> rwe(0, max_mst_weight);
+
+        auto result = std::make_shared<std::vector<mst_edge_t>>();
+        result->reserve(vertex_count * degree);
+
+        for (std::size_t index{}; index < vertex_count * degree; ++index)
+        {
+            if (const auto from = rnd(), tod = rnd(); from != tod)
+            {
+                result->emplace_back(from, tod, rwe());
+            }
+        }
+
+        return result;
+    }
+
+    // Set the OpenMP thread count for one run to measure the scaling.
+    struct omp_threads_scope final
+    {
+        explicit omp_threads_scope([[maybe_unused]] const std::int32_t thread_count)
+        {
+#ifdef _OPENMP
+            if (0 < thread_count)
+            {
+                omp_set_num_threads(thread_count);
+            }
+#endif
+        }
+
+        omp_threads_scope(const omp_threads_scope &) = delete;
+        auto operator= (const omp_threads_scope &) & -> omp_threads_scope & = delete;
+        omp_threads_scope(omp_threads_scope &&) noexcept = delete;
+        auto operator= (omp_threads_scope &&) &noexcept -> omp_threads_scope & = delete;
+
+        ~omp_threads_scope()
+        {
+#ifdef _OPENMP
+            omp_set_num_threads(Old_count);
+#endif
+        }
+
+private:
+        std::int32_t Old_count = static_cast<std::int32_t>(Standard::Algorithms::omp_thread_count());
+    };
+
+    enum class [[nodiscard]] mst_algorithm : std::uint8_t
+    {
+        boruvka,
+        filter_kruskal,
+        parallel_boruvka,
+    };
+
+    // The MST algorithms taking an edge list; a non-positive thread count means all threads.
+    // The sequential ones reorder the edges, which are restored in the untimed "prepare".
+    template<mst_algorithm algorithm, std::int32_t thread_count = 0>
+    [[nodiscard]] auto mst_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_run
+        {
+            auto edges = random_edge_list(size);
+            auto editable = std::make_shared<std::vector<mst_edge_t>>();
+            auto tree = std::make_shared<std::vector<mst_edge_t>>();
+
+            Standard::Algorithms::benchmark_body_t body = [edges, editable, tree, size]
+            {
+                const auto vertex_count = static_cast<std::int32_t>(size);
+                [[maybe_unused]] std::int64_t weights{};
+
+                if constexpr (algorithm == mst_algorithm::boruvka)
+                {
+                    weights = Standard::Algorithms::Graphs::boruvka_mst<std::int64_t, mst_weight_t>(
+                        *editable, vertex_count, *tree);
+                }
+                else if constexpr (algorithm == mst_algorithm::filter_kruskal)
+                {
+                    weights = Standard::Algorithms::Graphs::filter_kruskal_mst<std::int64_t, mst_weight_t>(
+                        *editable, vertex_count, *tree);
+                }
+                else
+                {
+                    const omp_threads_scope scope(thread_count);
+
+                    weights = Standard::Algorithms::Graphs::parallel_boruvka_mst<std::int64_t, mst_weight_t>(
+                        *edges, vertex_count, *tree);
+                }
+            };
+
+            if constexpr (algorithm == mst_algorithm::parallel_boruvka)
+            {
+                return body;
+            }
+            else
+            {
+                Standard::Algorithms::benchmark_body_t prepare = [edges, editable]
+                {
+                    *editable = *edges;
+                };
+
+                return { std::move(body), std::move(prepare) };
+            }
+        };
+    }
+
+    using flow_edge_t = Standard::Algorithms::Graphs::flow_edge<weight_t>;
+    using flow_graph_t = std::vector<std::vector<flow_edge_t>>;
+
+    // Each arc has its reverse arc of zero capacity; the sink is the last vertex.
+    [[nodiscard]] auto random_flow_graph(const std::size_t vertex_count) -> std::shared_ptr<const flow_graph_t>
+    {
+        constexpr auto degree = 8U;
+
+        const auto max_vertex = static_cast<vertex_t>(vertex_count - 1U);
+
+        Standard::Algorithms::Utilities::random_t<vertex_t> rnd(vertex_t{}, max_vertex);
+        Standard::Algorithms::Utilities::random_t<weight_t> rwe(1, max_weight);
+
+        auto result = std::make_shared<flow_graph_t>(vertex_count);
+        auto &graph = *result;
+
+        for (std::size_t index{}; index < vertex_count * degree; ++index)
+        {
+            if (const auto from = rnd(), tod = rnd(); from != tod)
+            {
+                const auto from_size = static_cast<std::int32_t>(graph[from].size());
+                const auto to_size = static_cast<std::int32_t>(graph[tod].size());
+
+                graph[from].push_back(flow_edge_t{ tod, to_size, rwe(), 0 });
+                graph[tod].push_back(flow_edge_t{ from, from_size, 0, 0 });
+            }
+        }
+
+        return result;
+    }
+
+    enum class [[nodiscard]] flow_algorithm : std::uint8_t
+    {
+        edmonds_karp,
+        push_relabel,
+        dinic,
+        dinic_capacity_scaling,
+    };
+
+    // The flows are written into the arcs, which are restored in the untimed "prepare".
+    template<flow_algorithm algorithm>
+    [[nodiscard]] auto flow_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_run
+        {
+            auto graph = random_flow_graph(size);
+            auto editable = std::make_shared<flow_graph_t>();
+
+            Standard::Algorithms::benchmark_body_t prepare = [graph, editable]
+            {
+                *editable = *graph;
+            };
+
+            Standard::Algorithms::benchmark_body_t body = [editable]
+            {
+                const auto sink = static_cast<vertex_t>(editable->size() - 1U);
+                [[maybe_unused]] weight_t flow{};
+
+                if constexpr (algorithm == flow_algorithm::edmonds_karp)
+                {
+                    flow = Standard::Algorithms::Graphs::edmonds_karp_flow<weight_t>(source_vertex, *editable, sink);
+                }
+                else if constexpr (algorithm == flow_algorithm::push_relabel)
+                {
+                    flow = Standard::Algorithms::Graphs::push_relabel_flow<weight_t>(source_vertex, *editable, sink);
+                }
+                else
+                {
+                    constexpr auto use_capacity_scaling = algorithm == flow_algorithm::dinic_capacity_scaling;
+
+                    flow = Standard::Algorithms::Graphs::dinic_flow<weight_t>(
+                        source_vertex, *editable, sink, use_capacity_scaling);
+                }
+            };
+
+            return { std::move(body), std::move(prepare) };
+        };
+    }
+
+    using min_cost_graph_t = Standard::Algorithms::Graphs::min_cost_flow_graph<std::int32_t, weight_t>;
+
+    // An assignment: the source, "size" workers, "size" jobs, the sink.
+    [[nodiscard]] auto random_assignment_graph(const std::size_t size) -> std::shared_ptr<const min_cost_graph_t>
+    {
+        constexpr auto degree = 8U;
+
+        const auto half = static_cast<vertex_t>(size);
+        const auto source = half * 2;
+        const auto sink = source + 1;
+
+        Standard::Algorithms::Utilities::random_t<vertex_t> rnd(vertex_t{}, half - 1);
+        Standard::Algorithms::Utilities::random_t<weight_t> rwe(1, max_weight);
+
+        auto result = std::make_shared<min_cost_graph_t>(sink + 1);
+
+        for (vertex_t worker{}; worker < half; ++worker)
+        {
+            result->add_edge(source, worker, 1);
+            result->add_edge(half + worker, sink, 1);
+
+            for (std::size_t index{}; index < degree; ++index)
+            {
+                result->add_edge(worker, half + rnd(), 1, rwe());
+            }
+        }
+
+        return result;
+    }
+
+    template<bool use_cost_scaling>
+    [[nodiscard]] auto min_cost_flow_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_run
+        {
+            auto graph = random_assignment_graph(size);
+            auto editable = std::make_shared<min_cost_graph_t>();
+
+            Standard::Algorithms::benchmark_body_t prepare = [graph, editable]
+            {
+                *editable = *graph;
+            };
+
+            Standard::Algorithms::benchmark_body_t body = [editable]
+            {
+                const auto sink = editable->size() - 1;
+                const auto source = sink - 1;
+
+                [[maybe_unused]] const auto flow_cost = use_cost_scaling
+                    ? editable->min_cost_max_flow_cost_scaling(source, sink)
+                    : editable->min_cost_max_flow(source, sink);
+            };
+
+            return { std::move(body), std::move(prepare) };
+        };
+    }
+
+    using cost_matrix_t = std::vector<std::vector<std::int32_t>>;
+
+    enum class [[nodiscard]] assignment_algorithm : std::uint8_t
+    {
+        hungarian,
+        jonker_volgenant,
+        auction,
+    };
+
+    // The dense assignment solvers.
+    template<assignment_algorithm algorithm>
+    [[nodiscard]] auto assignment_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            constexpr std::int32_t max_cost = 100'000;
+
+            Standard::Algorithms::Utilities::random_t<std::int32_t> rnd(0, max_cost);
+
+            auto costs = std::make_shared<cost_matrix_t>(size, std::vector<std::int32_t>(size));
+
+            for (auto &row : *costs)
+            {
+                for (auto &cost : row)
+                {
+                    cost = rnd();
+                }
+            }
+
+            auto matchings = std::make_shared<std::vector<std::int32_t>>();
+
+            return [costs, matchings]
+            {
+                [[maybe_unused]] weight_t total{};
+
+                if constexpr (algorithm == assignment_algorithm::hungarian)
+                {
+                    total = Standard::Algorithms::Graphs::hungarian_matching<weight_t>(*costs, *matchings);
+                }
+                else if constexpr (algorithm == assignment_algorithm::jonker_volgenant)
+                {
+                    total = Standard::Algorithms::Graphs::jonker_volgenant_matching<weight_t>(*costs, *matchings);
+                }
+                else
+                {
+                    total = Standard::Algorithms::Graphs::auction_matching<weight_t>(*costs, *matchings);
+                }
+            };
+        };
+    }
+
+    // The bipartite matchings on "size" + "size" vertices of the average degree 4.
+    enum class [[nodiscard]] bipartite_algorithm : std::uint8_t
+    {
+        // The 1-based lists.
+        karzanov_hopcroft_karp,
+        csr,
+        csr_greedy_init,
+    };
+
+    template<bipartite_algorithm algorithm>
+    [[nodiscard]] auto bipartite_matching_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            constexpr std::int64_t degree = 4;
+
+            const auto part_size = static_cast<std::int32_t>(size);
+
+            const auto left_neighbors = Standard::Algorithms::Graphs::create_random_bipartite_graph<std::int32_t>(
+                part_size, part_size, part_size * degree);
+
+            if constexpr (algorithm == bipartite_algorithm::karzanov_hopcroft_karp)
+            {
+                using old_t = Standard::Algorithms::Graphs::max_2c_matching_karzanov_hopcroft_karp<std::uint32_t>;
+
+                const auto part = static_cast<std::uint32_t>(size);
+                auto graph = std::make_shared<old_t>(std::pair<std::uint32_t, std::uint32_t>{ part, part });
+
+                for (std::uint32_t from{}; from < part; ++from)
+                {
+                    for (const auto &tod : left_neighbors[from])
+                    {
+                        graph->add_edge({ from + 1U, static_cast<std::uint32_t>(tod) + 1U });
+                    }
+                }
+
+                auto matchings = std::make_shared<std::vector<typename old_t::edge_t>>();
+
+                return [graph, matchings]
+                {
+                    graph->max_matching(*matchings);
+                };
+            }
+            else
+            {
+                using csr_t = Standard::Algorithms::Graphs::hopcroft_karp_csr<std::int32_t>;
+
+                auto graph = std::make_shared<csr_t>(left_neighbors, part_size);
+                auto matchings = std::make_shared<std::vector<typename csr_t::edge_t>>();
+
+                return [graph, matchings]
+                {
+                    constexpr auto use_greedy_init = algorithm == bipartite_algorithm::csr_greedy_init;
+
+                    [[maybe_unused]] const auto matching_size = graph->max_matching(*matchings, use_greedy_init);
+                };
+            }
+        };
+    }
+
+    template<std::size_t sparsity>
+    [[nodiscard]] auto dense_setup() -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [](const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+        {
+            auto graph = random_digraph(size, sparsity);
+            auto distances = std::make_shared<std::vector<weight_t>>();
+            auto parents = std::make_shared<std::vector<vertex_t>>();
+            auto processed = std::make_shared<std::vector<bool>>();
+
+            return [graph, distances, parents, processed]
+            {
+                Standard::Algorithms::Graphs::dijkstra_dense(
+                    graph->adjacency_lists(), *processed, source_vertex, *distances, *parents, infinite_weight);
+            };
+        };
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Benchmarks::add_benchmarks(std::vector<benchmark_function> &benchmarks)
+{
+    const std::vector<std::size_t> sizes{ 1'000, 2'000, 8'000 };
+
+    constexpr auto dense = 8U;
+    constexpr auto sparse = 1'000U;
+
+    benchmarks.emplace_back("dijkstra_prior_que dense", prior_que_setup<dense>(), sizes);
+    benchmarks.emplace_back("dijkstra_dense dense", dense_setup<dense>(), sizes, "dijkstra_prior_que dense");
+
+    benchmarks.emplace_back("dijkstra_prior_que sparse", prior_que_setup<sparse>(), sizes);
+    benchmarks.emplace_back("dijkstra_dense sparse", dense_setup<sparse>(), sizes, "dijkstra_prior_que sparse");
+
+    benchmarks.emplace_back("dijkstra_radix_heap sparse",
+        monotone_setup<Standard::Algorithms::Graphs::dijkstra_radix_heap<vertex_t, weight_t>, sparse>(), sizes,
+        "dijkstra_prior_que sparse");
+
+    benchmarks.emplace_back(
+        "delta_stepping sparse", delta_stepping_setup<sparse>(), sizes, "dijkstra_prior_que sparse");
+
+    benchmarks.emplace_back("dijkstra_dial sparse",
+        monotone_setup<Standard::Algorithms::Graphs::dijkstra_dial<vertex_t, weight_t>, sparse>(), sizes,
+        "dijkstra_prior_que sparse");
+
+    const std::vector<std::size_t> all_pairs_sizes{ 256, 512, 1'024 };
+
+    benchmarks.emplace_back("floyd_warshall", floyd_warshall_setup(), all_pairs_sizes);
+    benchmarks.emplace_back(
+        "blocked_floyd_warshall", blocked_floyd_warshall_setup(), all_pairs_sizes, "floyd_warshall");
+
+    const std::vector<std::size_t> mst_sizes{ 10'000, 100'000, 1'000'000 };
+
+    benchmarks.emplace_back("boruvka_mst", mst_setup<mst_algorithm::boruvka>(), mst_sizes);
+
+    benchmarks.emplace_back(
+        "filter_kruskal_mst", mst_setup<mst_algorithm::filter_kruskal>(), mst_sizes, "boruvka_mst");
+
+    benchmarks.emplace_back("parallel_boruvka_mst 1 thread", mst_setup<mst_algorithm::parallel_boruvka, 1>(),
+        mst_sizes, "boruvka_mst");
+
+    benchmarks.emplace_back("parallel_boruvka_mst 2 threads", mst_setup<mst_algorithm::parallel_boruvka, 2>(),
+        mst_sizes, "boruvka_mst");
+
+    benchmarks.emplace_back("parallel_boruvka_mst all threads", mst_setup<mst_algorithm::parallel_boruvka>(),
+        mst_sizes, "boruvka_mst");
+
+    const std::vector<std::size_t> flow_sizes{ 1'000, 4'000, 16'000 };
+
+    benchmarks.emplace_back("edmonds_karp_flow", flow_setup<flow_algorithm::edmonds_karp>(), flow_sizes);
+
+    benchmarks.emplace_back(
+        "push_relabel_flow", flow_setup<flow_algorithm::push_relabel>(), flow_sizes, "edmonds_karp_flow");
+
+    benchmarks.emplace_back("dinic_flow", flow_setup<flow_algorithm::dinic>(), flow_sizes, "edmonds_karp_flow");
+
+    benchmarks.emplace_back("dinic_flow scaling", flow_setup<flow_algorithm::dinic_capacity_scaling>(), flow_sizes,
+        "edmonds_karp_flow");
+
+    const std::vector<std::size_t> assignment_sizes{ 1'000, 4'000 };
+
+    benchmarks.emplace_back(
+        "min_cost_flow successive shortest paths", min_cost_flow_setup<false>(), assignment_sizes);
+
+    benchmarks.emplace_back("min_cost_flow cost scaling", min_cost_flow_setup<true>(), assignment_sizes,
+        "min_cost_flow successive shortest paths");
+
+    const std::vector<std::size_t> matrix_sizes{ 500, 1'000, 2'000 };
+
+    benchmarks.emplace_back("hungarian_matching", assignment_setup<assignment_algorithm::hungarian>(), matrix_sizes);
+
+    benchmarks.emplace_back("jonker_volgenant_matching", assignment_setup<assignment_algorithm::jonker_volgenant>(),
+        matrix_sizes, "hungarian_matching");
+
+    benchmarks.emplace_back("auction_matching", assignment_setup<assignment_algorithm::auction>(), matrix_sizes,
+        "hungarian_matching");
+
+    const std::vector<std::size_t> bipartite_sizes{ 10'000, 100'000, 1'000'000 };
+
+    benchmarks.emplace_back("max_2c_matching_karzanov_hopcroft_karp",
+        bipartite_matching_setup<bipartite_algorithm::karzanov_hopcroft_karp>(), bipartite_sizes);
+
+    benchmarks.emplace_back("hopcroft_karp_csr", bipartite_matching_setup<bipartite_algorithm::csr>(), bipartite_sizes,
+        "max_2c_matching_karzanov_hopcroft_karp");
+
+    benchmarks.emplace_back("hopcroft_karp_csr Karp-Sipser",
+        bipartite_matching_setup<bipartite_algorithm::csr_greedy_init>(), bipartite_sizes,
+        "max_2c_matching_karzanov_hopcroft_karp");
+}
@@ -6,6 +6,7 @@
 #include"binary_indexed_tree_tests.h"
 #include"binary_tree_serialize_tests.h"
 #include"binomial_heap_tests.h"
+#include"blocked_floyd_warshall_tests.h"
 #include"boruvka_mst_tests.h"
 #include"bridge_detector_tests.h"
 #include"bst_to_doubly_linked_list_tests.h"
@@ -13,14 +14,19 @@
 #include"clique_maximum_tests.h"
 #include"closest_select_update_tests.h"
 #include"construct_from_distinct_numbers_tests.h"
+#include"contraction_hierarchies_tests.h"
 #include"dag_longest_weighted_path_tests.h"
+#include"delta_stepping_shortest_paths_tests.h"
 #include"deap_tests.h"
 #include"detect_many_cycles_tests.h"
 #include"difference_array_range_update_in_o1_tests.h"
 #include"digraph_cycle_detector_tests.h"
+#include"dijkstra_monotone_tests.h"
+#include"dijkstra_point_to_point_tests.h"
 #include"dijkstra_tests.h"
 #include"euler_tour_tests.h"
 #include"fibonacci_heap_tests.h"
+#include"filter_kruskal_mst_tests.h"
 #include"free_tree_tests.h"
 #include"graph_girth_tests.h"
 #include"hungarian_matching_tests.h"
@@ -52,6 +58,8 @@
 #include"optimal_bst_tests.h"
 #include"order_statistics_tree_tests.h"
 #include"page_rank_tests.h"
+#include"parallel_boruvka_mst_tests.h"
+#include"parallel_connected_components_tests.h"
 #include"persistent_segment_tree_tests.h"
 #include"persistent_trie_tests.h"
 #include"prefix_codes_tests.h"
@@ -270,5 +278,18 @@ void Standard::Algorithms::Graphs::Tests::add_tests(
 
     tests.emplace_back("dijkstra_tests", &dijkstra_tests, five);
 
+    tests.emplace_back("dijkstra_monotone_tests", &dijkstra_monotone_tests, 2);
+
+    tests.emplace_back("dijkstra_point_to_point_tests", &dijkstra_point_to_point_tests, 2);
+
+    tests.emplace_back("contraction_hierarchies_tests", &contraction_hierarchies_tests, 2);
+
+    tests.emplace_back("delta_stepping_shortest_paths_tests", &delta_stepping_shortest_paths_tests, 2);
+    tests.emplace_back("blocked_floyd_warshall_tests", &blocked_floyd_warshall_tests, 2);
+
+    tests.emplace_back("parallel_connected_components_tests", &parallel_connected_components_tests, 2);
+    tests.emplace_back("filter_kruskal_mst_tests", &filter_kruskal_mst_tests, 2);
+    tests.emplace_back("parallel_boruvka_mst_tests", &parallel_boruvka_mst_tests, 2);
+
     tests.emplace_back("graph_girth_tests", &graph_girth_tests, 1);
 }
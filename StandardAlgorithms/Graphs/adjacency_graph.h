@@ -0,0 +1,40 @@
+#pragma once
+#include<concepts>
+#include<cstddef>
+#include<ranges>
+#include<utility>
+
+namespace Standard::Algorithms::Graphs
+{
+    // A graph, whose vertices are from 0 to (size - 1),
+    // where graph[from] or graph.at(from) return the out-going edges of "from".
+    // E.g. std::vector<std::vector<edge_t>>, or csr_graph.
+    template<class graph_t>
+    concept adjacency_graph = requires(const graph_t &graph, const std::size_t from)
+    // NOLINTNEXTLINE
+    {
+        {
+            graph.size()
+            } -> std::convertible_to<std::size_t>;
+
+        {
+            graph[from]
+            } -> std::ranges::sized_range;
+
+        {
+            graph.at(from)
+            } -> std::ranges::sized_range;
+    };
+
+    template<adjacency_graph graph_t>
+    using adjacency_edge_t = std::ranges::range_value_t<decltype(std::declval<const graph_t &>()[std::size_t{}])>;
+
+    // Each edge has public fields "vertex" and "weight".
+    template<class graph_t>
+    concept weighted_adjacency_graph = adjacency_graph<graph_t> && requires(const adjacency_edge_t<graph_t> &edge)
+    // NOLINTNEXTLINE
+    {
+        edge.vertex;
+        edge.weight;
+    };
+} // namespace Standard::Algorithms::Graphs
@@ -0,0 +1,235 @@
+#pragma once
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/require_utilities.h"
+#include"graph_helper.h"
+#include"hungarian_matching.h" // matching_weight
+#include<algorithm>
+#include<atomic>
+#include<cassert>
+#include<cstdint>
+#include<limits>
+#include<stdexcept>
+#include<string>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    // The benefit of a row (person) getting a column (object) is the negated scaled cost.
+    template<class graph_t>
+    struct auction_context final
+    {
+        constexpr auction_context(const graph_t &graph, const std::int64_t scale)
+            : Graph(graph)
+            , Size(static_cast<std::int32_t>(graph.size()))
+            , Scale(scale)
+            , Prices(Size, 0)
+            , Row_cols(Size, none)
+            , Col_rows(Size, none)
+            , Bid_cols(Size, none)
+            , Bids(Size, 0)
+            , Winners(Size, none)
+        {
+            Bidders.reserve(Size);
+        }
+
+        [[nodiscard]] constexpr auto benefit(const std::int32_t row, const std::int32_t col) const -> std::int64_t
+        {
+            return -static_cast<std::int64_t>(Graph[row][col]) * Scale;
+        }
+
+        // All the unassigned rows bid at the same time (Jacobi), each for its best column;
+        // the bid raises the price so that the column is better than the second best by epsilon.
+        // Each column then takes its highest bid.
+        // Return false when all the rows are assigned.
+        [[nodiscard]] auto bid_round(const std::int64_t epsilon) -> bool
+        {
+            Bidders.clear();
+
+            for (std::int32_t row{}; row < Size; ++row)
+            {
+                if (Row_cols[row] == none)
+                {
+                    Bidders.push_back(row);
+                }
+            }
+
+            if (Bidders.empty())
+            {
+                return false;
+            }
+
+            const auto bidder_count = static_cast<std::int32_t>(Bidders.size());
+
+#pragma omp parallel for default(none) shared(bidder_count, epsilon) schedule(dynamic, 16)
+            for (std::int32_t index = 0; index < bidder_count; ++index)
+            {
+                const auto row = Bidders[index];
+
+                auto best = std::numeric_limits<std::int64_t>::min();
+                auto second = best;
+                std::int32_t best_col{};
+
+                for (std::int32_t col{}; col < Size; ++col)
+                {
+                    const auto value = benefit(row, col) - Prices[col];
+
+                    if (value <= second)
+                    {
+                        continue;
+                    }
+
+                    if (best < value)
+                    {
+                        second = best;
+                        best = value, best_col = col;
+                    }
+                    else
+                    {
+                        second = value;
+                    }
+                }
+
+                Bid_cols[row] = best_col;
+                Bids[row] = Prices[best_col] + best - second + epsilon;
+
+                // The highest bid wins, then the smallest row.
+                // The acquire makes the bid of the current winner visible.
+                std::atomic_ref<std::int32_t> winner(Winners[best_col]);
+
+                for (auto cur = winner.load(std::memory_order_acquire);
+                     cur == none || Bids[cur] < Bids[row] || (Bids[cur] == Bids[row] && row < cur);)
+                {
+                    if (winner.compare_exchange_weak(cur, row, std::memory_order_acq_rel, std::memory_order_acquire))
+                    {
+                        break;
+                    }
+                }
+            }
+
+            // The evicted owners did not bid, so the writes do not overlap.
+#pragma omp parallel for default(none) shared(bidder_count) schedule(static)
+            for (std::int32_t index = 0; index < bidder_count; ++index)
+            {
+                const auto row = Bidders[index];
+                const auto &col = Bid_cols[row];
+
+                if (Winners[col] != row)
+                {
+                    continue;
+                }
+
+                if (const auto &owner = Col_rows[col]; owner != none)
+                {
+                    Row_cols[owner] = none;
+                }
+
+                Col_rows[col] = row, Row_cols[row] = col;
+                Prices[col] = Bids[row];
+                Winners[col] = none;
+            }
+
+            return true;
+        }
+
+        // An epsilon-scaling phase starts from scratch keeping the prices.
+        constexpr void unassign_all()
+        {
+            std::fill(Row_cols.begin(), Row_cols.end(), none);
+            std::fill(Col_rows.begin(), Col_rows.end(), none);
+        }
+
+        [[nodiscard]] constexpr auto row_cols() const &noexcept -> const std::vector<std::int32_t> &
+        {
+            return Row_cols;
+        }
+
+private:
+        static constexpr std::int32_t none = -1;
+
+        const graph_t &Graph;
+        std::int32_t Size;
+        std::int64_t Scale;
+
+        std::vector<std::int64_t> Prices;
+        std::vector<std::int32_t> Row_cols;
+        std::vector<std::int32_t> Col_rows;
+        std::vector<std::int32_t> Bid_cols;
+        std::vector<std::int64_t> Bids;
+        std::vector<std::int32_t> Winners;
+        std::vector<std::int32_t> Bidders{};
+    };
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Assignment problem by Bertsekas' auction with epsilon scaling: same input, output as hungarian_matching.
+    // The unassigned rows bid for the columns in parallel rounds.
+    // The costs are multiplied by (n + 1) so that the final 1-optimal assignment is optimal.
+    // The epsilon starts at the max scaled cost divided by the "alpha", and is divided by it each phase.
+    // Weights can be negative, their absolute values must not exceed 2**62 / (n + 1). Nodes start from 0.
+    // Time O(n**3 * log(n*C)) in the worst case where C is the max absolute cost.
+    template<class int_t, class graph_t>
+    [[nodiscard]] auto auction_matching(const graph_t &graph, std::vector<std::int32_t> &matchings,
+        const std::int64_t alpha = 8) -> int_t
+    {
+        {
+            using w_t = decltype(graph[0][0]);
+
+            static_assert(sizeof(w_t) <= sizeof(int_t) && sizeof(w_t) <= sizeof(std::int64_t));
+        }
+
+        require_greater(alpha, 1, "alpha");
+
+        const auto size = require_positive(static_cast<std::int32_t>(graph.size()), "graph size");
+        require_full_graph(graph);
+
+        if (size == 1)
+        {
+            matchings.assign(1, 0);
+            return Inner::matching_weight<int_t>(graph, matchings);
+        }
+
+        const auto scale = static_cast<std::int64_t>(size) + 1;
+
+        std::int64_t max_cost{};
+
+        for (const auto &row : graph)
+        {
+            for (const auto &cost : row)
+            {
+                const auto abs_cost = static_cast<std::int64_t>(cost < 0 ? -cost : cost);
+                max_cost = std::max(max_cost, abs_cost);
+            }
+        }
+
+        if (constexpr auto limit = std::numeric_limits<std::int64_t>::max() / 4; limit / scale < max_cost)
+            [[unlikely]]
+        {
+            throw std::invalid_argument("Too large cost " + std::to_string(max_cost) + " for the auction.");
+        }
+
+        Inner::auction_context<graph_t> context(graph, scale);
+
+        auto epsilon = std::max<std::int64_t>(1, max_cost * scale / alpha);
+
+        for (;;)
+        {
+            context.unassign_all();
+
+            while (context.bid_round(epsilon))
+            {
+            }
+
+            if (epsilon == 1)
+            {
+                break;
+            }
+
+            epsilon = std::max<std::int64_t>(1, epsilon / alpha);
+        }
+
+        matchings = context.row_cols();
+
+        return Inner::matching_weight<int_t>(graph, matchings);
+    }
+} // namespace Standard::Algorithms::Graphs
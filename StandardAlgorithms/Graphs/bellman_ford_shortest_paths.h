@@ -1,13 +1,15 @@
 #pragma once
 #include"../Utilities/has_openmp.h"
 #include"../Utilities/require_utilities.h"
+#include"adjacency_graph.h"
 #include<deque>
 #include<vector>
 
 namespace Standard::Algorithms::Graphs
 {
     // todo(p3): if dist[x][x] < 0, return 1;
-    [[nodiscard]] constexpr auto has_negative_cost_cycle(const auto &graph, const auto &min_distances) -> bool
+    [[nodiscard]] constexpr auto has_negative_cost_cycle(
+        const weighted_adjacency_graph auto &graph, const auto &min_distances) -> bool
     {
         {
             using distance_t = std::remove_cvref_t<decltype(min_distances[0])>;
@@ -43,7 +45,7 @@ namespace Standard::Algorithms::Graphs
 
     namespace Inner
     {
-        template<class graph_t, std::signed_integral weight_t>
+        template<weighted_adjacency_graph graph_t, std::signed_integral weight_t>
         [[nodiscard]] constexpr auto bf_cycle_underflow(const graph_t &graph, std::vector<weight_t> &distances,
             std::vector<std::int32_t> &parents, const std::deque<std::int32_t> &prev, std::deque<std::int32_t> &next,
             std::vector<bool> &used, const weight_t inf) -> bool
@@ -106,7 +108,7 @@ namespace Standard::Algorithms::Graphs
     // Find 1 source shortest path tree for a negative cost graph.
     // Return false when a negative cycle exists - the computed distances and parents can be ignored.
     // Time O(v*e) is slower than Dijkstra's for non-negative costs.
-    template<class graph_t, std::signed_integral weight_t>
+    template<weighted_adjacency_graph graph_t, std::signed_integral weight_t>
     [[nodiscard]] constexpr auto bellman_ford_shortest_paths_fast(const graph_t &graph, std::int32_t source,
         std::vector<weight_t> &distances, std::vector<std::int32_t> &parents, std::deque<std::int32_t> &temp,
         std::deque<std::int32_t> &temp2, std::vector<bool> &used,
@@ -146,7 +148,7 @@ namespace Standard::Algorithms::Graphs
     }
 
     // It is 1.5 times slower on n=5000.
-    template<class graph_t, std::signed_integral weight_t>
+    template<weighted_adjacency_graph graph_t, std::signed_integral weight_t>
     [[nodiscard]] constexpr auto bellman_ford_shortest_paths_slow(const graph_t &graph, std::int32_t source,
         std::vector<weight_t> &distances, std::vector<std::int32_t> &parents,
         const weight_t inf = std::numeric_limits<weight_t>::max() / 2) -> bool
@@ -0,0 +1,217 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include"adjacency_graph.h"
+#include<algorithm>
+#include<cstdint>
+#include<limits>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // All pairs shortest paths in 2 flat row-major matrices,
+    // where the rows are padded up to a multiple of the block size.
+    template<std::signed_integral weight_t>
+    struct flat_shortest_paths final
+    {
+        // NOLINTNEXTLINE
+        std::int32_t size{};
+
+        // NOLINTNEXTLINE
+        std::size_t stride{};
+
+        // NOLINTNEXTLINE
+        std::vector<weight_t> distances{};
+
+        // The next vertex after "from" on a shortest path from "from" to "to", or -1.
+        // NOLINTNEXTLINE
+        std::vector<std::int32_t> nexts{};
+
+        [[nodiscard]] constexpr auto distance(const std::int32_t from, const std::int32_t tod) const -> const weight_t &
+        {
+            assert(!(from < 0) && from < size && !(tod < 0) && tod < size);
+
+            return distances[from * stride + tod];
+        }
+
+        [[nodiscard]] constexpr auto next(const std::int32_t from, const std::int32_t tod) const -> const std::int32_t &
+        {
+            assert(!(from < 0) && from < size && !(tod < 0) && tod < size);
+
+            return nexts[from * stride + tod];
+        }
+    };
+
+    namespace Inner
+    {
+        // For each mid in the block: cur[i][j] = min(cur[i][j], left[i][mid] + right[mid][j]).
+        // The mid loop is outermost as the tiles may coincide in the first 2 phases.
+        // The inner loop is branch-free over contiguous memory to be vectorized;
+        // 64-bit weights need e.g. AVX2 (-march=native) for the vector compares.
+        template<std::signed_integral weight_t, std::size_t block_size>
+        inline void floyd_warshall_tile(flat_shortest_paths<weight_t> &paths, const std::size_t row_block,
+            const std::size_t column_block, const std::size_t mid_block, const weight_t inf)
+        {
+            const auto stride = paths.stride;
+            auto *const distances = paths.distances.data();
+            auto *const nexts = paths.nexts.data();
+
+            const auto row0 = row_block * block_size;
+            const auto column0 = column_block * block_size;
+            const auto mid0 = mid_block * block_size;
+            const auto minus_inf = static_cast<weight_t>(-inf);
+
+            for (auto mid = mid0; mid < mid0 + block_size; ++mid)
+            {
+                const auto *const mid_dis = distances + mid * stride + column0;
+
+                for (auto from = row0; from < row0 + block_size; ++from)
+                {
+                    const auto from_mid = distances[from * stride + mid];
+                    if (!(from_mid < inf))
+                    {
+                        continue;
+                    }
+
+                    const auto next_mid = nexts[from * stride + mid];
+                    auto *const from_dis = distances + from * stride + column0;
+                    auto *const from_next = nexts + from * stride + column0;
+
+#pragma omp simd
+                    for (std::size_t index = 0; index < block_size; ++index)
+                    {
+                        const auto &mid_sto = mid_dis[index];
+
+                        // Avoid underflow.
+                        // The unreachable stay at inf even after adding a negative weight.
+                        const auto cand =
+                            mid_sto < inf ? std::max(static_cast<weight_t>(from_mid + mid_sto), minus_inf) : inf;
+
+                        const auto is_better = cand < from_dis[index];
+
+                        from_dis[index] = is_better ? cand : from_dis[index];
+                        from_next[index] = is_better ? next_mid : from_next[index];
+                    }
+                }
+            }
+        }
+    } // namespace Inner
+
+    // Blocked (tiled) Floyd-Warshall: the matrix is split into square blocks fitting in the L1/L2 cache.
+    // For each diagonal block k:
+    // - the block (k, k) is computed alone,
+    // - then the blocks in the row k and the column k, in parallel,
+    // - then all the other blocks, in parallel.
+    // The results are the same as of floyd_warshall_shortest_paths including the 'nexts',
+    // except maybe for the ties, and the unreachable always have exactly inf.
+    // Return false when a negative cycle exists.
+    // Time O(v**3), memory O(v**2).
+    template<std::signed_integral weight_t, std::size_t block_size = 64U>
+    requires(0U < block_size)
+    [[nodiscard]] auto blocked_floyd_warshall_shortest_paths(const weighted_adjacency_graph auto &graph,
+        flat_shortest_paths<weight_t> &paths, const weight_t inf = std::numeric_limits<weight_t>::max() / 2) -> bool
+    {
+        assert(0 < inf && -inf < 0);
+
+        const auto size = require_positive(static_cast<std::int32_t>(graph.size()), "graph size");
+        const auto block_count = (static_cast<std::size_t>(size) + block_size - 1U) / block_size;
+        const auto stride = block_count * block_size;
+
+        paths.size = size;
+        paths.stride = stride;
+
+        // The padded vertices are not reachable.
+        paths.distances.assign(stride * stride, inf);
+        paths.nexts.assign(stride * stride, -1);
+
+        for (std::int32_t from{}; from < size; ++from)
+        {
+            // A self-loop only matters when negative, and then it is a negative cycle.
+            paths.distances[from * stride + from] = 0;
+            paths.nexts[from * stride + from] = from;
+
+            for (const auto &edge : graph[from])
+            {
+                const auto sto = static_cast<std::int32_t>(edge.vertex);
+                const auto &weight = edge.weight;
+
+                assert(!(sto < 0) && sto < size && -inf < weight && weight < inf);
+
+                auto &dist = paths.distances[from * stride + sto];
+                if (weight < dist)
+                {// Parallel edges.
+                    dist = weight;
+                    paths.nexts[from * stride + sto] = sto;
+                }
+            }
+        }
+
+        const auto blocks = static_cast<std::int64_t>(block_count);
+
+        for (std::int64_t mid_block{}; mid_block < blocks; ++mid_block)
+        {
+            Inner::floyd_warshall_tile<weight_t, block_size>(paths, mid_block, mid_block, mid_block, inf);
+
+#pragma omp parallel for default(none) shared(paths, mid_block, blocks, inf)
+            for (std::int64_t other = 0; other < blocks; ++other)
+            {
+                if (other != mid_block)
+                {
+                    Inner::floyd_warshall_tile<weight_t, block_size>(paths, mid_block, other, mid_block, inf);
+                    Inner::floyd_warshall_tile<weight_t, block_size>(paths, other, mid_block, mid_block, inf);
+                }
+            }
+
+#pragma omp parallel for collapse(2) default(none) shared(paths, mid_block, blocks, inf)
+            for (std::int64_t row_block = 0; row_block < blocks; ++row_block)
+            {
+                for (std::int64_t column_block = 0; column_block < blocks; ++column_block)
+                {
+                    if (row_block != mid_block && column_block != mid_block)
+                    {
+                        Inner::floyd_warshall_tile<weight_t, block_size>(
+                            paths, row_block, column_block, mid_block, inf);
+                    }
+                }
+            }
+        }
+
+        for (std::int32_t ind{}; ind < size; ++ind)
+        {
+            if (paths.distance(ind, ind) < 0)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    // The 'path' will be empty when no path exists.
+    template<std::signed_integral weight_t>
+    constexpr void restore_floyd_warshall_shortest_paths(const flat_shortest_paths<weight_t> &paths,
+        std::int32_t from, const std::int32_t sto, std::vector<std::int32_t> &path)
+    {
+        assert(!(from < 0) && !(sto < 0));
+
+        path.clear();
+
+        if (const auto no_path = paths.next(from, sto) < 0; no_path)
+        {
+            return;
+        }
+
+        for (;;)
+        {
+            path.push_back(from);
+            if (sto == from)
+            {
+                return;
+            }
+
+            const auto &next = paths.next(from, sto);
+            assert(!(next < 0));
+
+            from = next;
+        }
+    }
+} // namespace Standard::Algorithms::Graphs
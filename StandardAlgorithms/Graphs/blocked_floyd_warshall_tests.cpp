@@ -0,0 +1,200 @@
+#include"blocked_floyd_warshall_tests.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"bellman_ford_shortest_paths.h"
+#include"blocked_floyd_warshall.h"
+#include"graph.h"
+#include<set>
+
+namespace
+{
+    using vertex_t = std::int32_t;
+    using weight_t = std::int64_t;
+    using graph_t = Standard::Algorithms::Graphs::graph<vertex_t, weight_t>;
+    using paths_t = Standard::Algorithms::Graphs::flat_shortest_paths<weight_t>;
+
+    constexpr weight_t infinite_weight = std::numeric_limits<weight_t>::max() / 2;
+
+    // Negative weights without negative cycles: w(u, v) = non-negative + p(u) - p(v).
+    [[nodiscard]] auto random_graph(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd,
+        const bool has_negative_cycle) -> graph_t
+    {
+        constexpr auto min_size = 1;
+        constexpr auto max_size = 70;
+        constexpr auto max_weight = 100;
+        constexpr auto max_potential = 50;
+
+        const auto size = rnd(min_size, max_size);
+        const auto edges = rnd(0, size * 4);
+
+        std::vector<std::int32_t> potentials(size);
+
+        for (auto &potential : potentials)
+        {
+            potential = rnd(0, max_potential);
+        }
+
+        graph_t graph(size);
+
+        // The floyd_warshall_shortest_paths keeps the last of the parallel edges.
+        std::set<std::pair<std::int32_t, std::int32_t>> uniques;
+
+        for (std::int32_t index{}; index < edges; ++index)
+        {
+            const auto from = rnd(0, size - 1);
+            const auto tod = rnd(0, size - 1);
+
+            if (from != tod && uniques.emplace(from, tod).second)
+            {
+                constexpr auto add_reverse_edge = false;
+
+                graph.add_edge(
+                    from, tod, rnd(0, max_weight) + potentials[from] - potentials[tod], add_reverse_edge);
+            }
+        }
+
+        if (has_negative_cycle && 1 < size)
+        {
+            constexpr auto add_reverse_edge = false;
+
+            graph.add_edge(0, 1, -1, add_reverse_edge);
+            graph.add_edge(1, 0, -1, add_reverse_edge);
+        }
+
+        return graph;
+    }
+
+    void check_path(const graph_t &graph, const paths_t &paths, const vertex_t from, const vertex_t tod,
+        std::vector<vertex_t> &path, const std::string &name)
+    {
+        Standard::Algorithms::Graphs::restore_floyd_warshall_shortest_paths(paths, from, tod, path);
+
+        const auto &expected = paths.distance(from, tod);
+        if (expected == infinite_weight)
+        {
+            ::Standard::Algorithms::ert::are_equal(true, path.empty(), name + " no path");
+            return;
+        }
+
+        Standard::Algorithms::require_positive(path.size(), name + " path size");
+        ::Standard::Algorithms::ert::are_equal(from, path.front(), name + " path front");
+        ::Standard::Algorithms::ert::are_equal(tod, path.back(), name + " path back");
+
+        weight_t sum{};
+
+        for (std::size_t index = 1; index < path.size(); ++index)
+        {
+            auto best = infinite_weight;
+
+            for (const auto &edge : graph.adjacency_lists()[path[index - 1U]])
+            {
+                if (edge.vertex == path[index])
+                {
+                    best = std::min(best, edge.weight);
+                }
+            }
+
+            Standard::Algorithms::require_greater(infinite_weight, best, name + " path edge");
+            sum += best;
+        }
+
+        ::Standard::Algorithms::ert::are_equal(expected, sum, name + " path weight");
+    }
+
+    template<std::size_t block_size>
+    void compare_test(const graph_t &graph, const bool expected_good,
+        const std::vector<std::vector<weight_t>> &expected, std::vector<vertex_t> &path)
+    {
+        const auto size = static_cast<vertex_t>(graph.size());
+        const auto name = "size " + std::to_string(size) + ", block " + std::to_string(block_size);
+
+        paths_t paths;
+
+        const auto good =
+            Standard::Algorithms::Graphs::blocked_floyd_warshall_shortest_paths<weight_t, block_size>(
+                graph.adjacency_lists(), paths);
+
+        ::Standard::Algorithms::ert::are_equal(expected_good, good, name + " no negative cycle");
+
+        if (!good)
+        {
+            return;
+        }
+
+        for (vertex_t from{}; from < size; ++from)
+        {
+            for (vertex_t tod{}; tod < size; ++tod)
+            {
+                const auto &expected_dist = expected[from][tod];
+
+                // The original adds the negative weights to inf.
+                const auto expected_bounded = infinite_weight / 2 < expected_dist ? infinite_weight : expected_dist;
+
+                ::Standard::Algorithms::ert::are_equal(expected_bounded, paths.distance(from, tod), name + " distance");
+
+                check_path(graph, paths, from, tod, path, name);
+            }
+        }
+    }
+
+    void random_test(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd, const bool has_negative_cycle)
+    {
+        const auto graph = random_graph(rnd, has_negative_cycle);
+
+        std::vector<std::vector<weight_t>> expected;
+        std::vector<std::vector<std::int32_t>> nexts;
+
+        const auto expected_good =
+            Standard::Algorithms::Graphs::floyd_warshall_shortest_paths(
+            graph.adjacency_lists(), expected, nexts, infinite_weight);
+
+        std::vector<vertex_t> path;
+
+        compare_test<1U>(graph, expected_good, expected, path);
+        compare_test<4U>(graph, expected_good, expected, path);
+        compare_test<16U>(graph, expected_good, expected, path);
+        compare_test<64U>(graph, expected_good, expected, path);
+    }
+
+    // The graph class does not allow self-loops.
+    void self_loop_test()
+    {
+        using edge_t = graph_t::edge_t;
+
+        std::vector<std::vector<edge_t>> graph{ { edge_t(1, 2) }, { edge_t(1, 5), edge_t(2, 3) }, {} };
+
+        paths_t paths;
+
+        {
+            const auto good =
+                Standard::Algorithms::Graphs::blocked_floyd_warshall_shortest_paths<weight_t, 4U>(graph, paths);
+
+            ::Standard::Algorithms::ert::are_equal(true, good, "positive self-loop no negative cycle");
+            ::Standard::Algorithms::ert::are_equal(weight_t{}, paths.distance(1, 1), "positive self-loop distance");
+            ::Standard::Algorithms::ert::are_equal(weight_t{ 5 }, paths.distance(0, 2), "positive self-loop path");
+        }
+
+        graph[2].emplace_back(2, -1);
+
+        {
+            const auto good =
+                Standard::Algorithms::Graphs::blocked_floyd_warshall_shortest_paths<weight_t, 4U>(graph, paths);
+
+            ::Standard::Algorithms::ert::are_equal(false, good, "negative self-loop is a negative cycle");
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Tests::blocked_floyd_warshall_tests()
+{
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+    constexpr auto steps = 10;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        random_test(rnd, 0 == (step & 3));
+    }
+
+    self_loop_test();
+}
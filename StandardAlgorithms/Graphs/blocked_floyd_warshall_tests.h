@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Graphs::Tests
+{
+    void blocked_floyd_warshall_tests();
+}
@@ -0,0 +1,119 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include<concepts>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Heaps
+{
+    // Dial's monotone min-priority queue for small unsigned integer keys.
+    // All the stored keys must be in [current key, current key + max key span],
+    // e.g. the max edge weight in Dijkstra's algorithm,
+    // so that a circular array of (max key span + 1) buckets is enough.
+    // There is no decrease_key - push a duplicate, and skip the stale items when popped.
+    // Time: push O(1), pop O(1) amortized plus the skipped empty buckets.
+    template<std::unsigned_integral key_t1, class value_t1>
+    struct bucket_queue final
+    {
+        using key_t = key_t1;
+        using value_t = value_t1;
+        using item_t = std::pair<key_t, value_t>;
+
+        constexpr explicit bucket_queue(const key_t &max_key_span)
+            : Buckets(check_span(max_key_span) + 1ZU)
+        {
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool
+        {
+            return 0ZU == Size;
+        }
+
+        [[nodiscard]] constexpr auto max_key_span() const noexcept -> key_t
+        {
+            return static_cast<key_t>(Buckets.size() - 1ZU);
+        }
+
+        constexpr void clear() noexcept
+        {
+            for (auto &bucket : Buckets)
+            {
+                bucket.clear();
+            }
+
+            Size = {};
+            Current = {};
+        }
+
+        constexpr void push(const key_t &key, const value_t &value)
+        {
+            if (key < Current || max_key_span() < key - Current) [[unlikely]]
+            {
+                auto str = ::Standard::Algorithms::Utilities::w_stream();
+                str << "The pushed key " << key << " must be in [" << Current << ", " << Current << " + "
+                    << max_key_span() << "] in the bucket queue.";
+
+                throw_exception(str);
+            }
+
+            Buckets[key % Buckets.size()].push_back(value);
+            ++Size;
+        }
+
+        // Return the item with a minimum key.
+        [[nodiscard]] constexpr auto pop() -> item_t
+        {
+            if (is_empty()) [[unlikely]]
+            {
+                throw std::runtime_error("Cannot pop from an empty bucket queue.");
+            }
+
+            const auto count = Buckets.size();
+            auto index = static_cast<std::size_t>(Current % count);
+
+            while (Buckets[index].empty())
+            {
+                ++Current;
+
+                if (++index == count)
+                {
+                    index = 0;
+                }
+            }
+
+            auto &bucket = Buckets[index];
+            item_t item{ Current, std::move(bucket.back()) };
+            bucket.pop_back();
+            --Size;
+
+            return item;
+        }
+
+private:
+        [[nodiscard]] static constexpr auto check_span(const key_t &max_key_span) -> std::size_t
+        {
+            // Not too many buckets.
+            constexpr auto max_span = static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max());
+
+            if (max_span < static_cast<std::size_t>(max_key_span)) [[unlikely]]
+            {
+                auto str = ::Standard::Algorithms::Utilities::w_stream();
+                str << "The max key span " << max_key_span << " must not exceed " << max_span
+                    << " in the bucket queue; use a radix heap instead.";
+
+                throw_exception(str);
+            }
+
+            return static_cast<std::size_t>(max_key_span);
+        }
+
+        std::vector<std::vector<value_t>> Buckets;
+        std::size_t Size{};
+        key_t Current{};
+    };
+} // namespace Standard::Algorithms::Heaps
@@ -0,0 +1,922 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include"adjacency_graph.h"
+#include"csr_graph.h"
+#include"dijkstra.h"
+#include<algorithm>
+#include<bit>
+#include<cstdint>
+#include<functional>
+#include<istream>
+#include<ostream>
+#include<queue>
+#include<span>
+#include<string>
+#include<tuple>
+#include<type_traits>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    template<class vertex_t, class weight_t>
+    struct ch_edge final
+    {
+        // NOLINTNEXTLINE
+        vertex_t vertex{};
+
+        // NOLINTNEXTLINE
+        weight_t weight{};
+
+        // The contracted vertex a shortcut skips over, or absent for an original edge.
+        // NOLINTNEXTLINE
+        vertex_t middle{};
+    };
+
+    // The items are stored as little-endian fixed-width fields so that a file is portable between platforms.
+    template<class item_t>
+    requires(std::is_arithmetic_v<item_t>)
+    using ch_field_t = std::conditional_t<sizeof(item_t) == 1U, std::uint8_t,
+        std::conditional_t<sizeof(item_t) == 2U, std::uint16_t,
+            std::conditional_t<sizeof(item_t) == 4U, std::uint32_t, std::uint64_t>>>;
+
+    // Convert at most this many items at once, also to limit the allocation for a corrupt size.
+    inline constexpr std::size_t ch_chunk_items = 1U << 16U;
+
+    template<class item_t>
+    inline void ch_write_fields(std::ostream &str, const std::span<const item_t> items)
+    {
+        using field_t = ch_field_t<item_t>;
+        static_assert(sizeof(field_t) == sizeof(item_t));
+
+        std::vector<char> bytes;
+
+        for (std::size_t start{}; start < items.size(); start += ch_chunk_items)
+        {
+            bytes.clear();
+
+            for (const auto &item : items.subspan(start, std::min(ch_chunk_items, items.size() - start)))
+            {
+                const auto value = std::bit_cast<field_t>(item);
+
+                for (std::size_t shift{}; shift < sizeof(field_t) * 8U; shift += 8U)
+                {
+                    bytes.push_back(static_cast<char>(static_cast<std::uint8_t>(value >> shift)));
+                }
+            }
+
+            str.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        }
+
+        if (!str) [[unlikely]]
+        {
+            throw std::runtime_error("Cannot write the contraction hierarchy file.");
+        }
+    }
+
+    template<class item_t>
+    inline void ch_read_fields(std::istream &str, const std::size_t count, std::vector<item_t> &items)
+    {
+        using field_t = ch_field_t<item_t>;
+        static_assert(sizeof(field_t) == sizeof(item_t));
+
+        items.clear();
+        items.reserve(std::min(count, ch_chunk_items));
+
+        std::vector<char> bytes;
+
+        while (items.size() < count)
+        {
+            const auto chunk = std::min(ch_chunk_items, count - items.size());
+            bytes.resize(chunk * sizeof(field_t));
+            str.read(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+
+            if (!str) [[unlikely]]
+            {
+                throw std::runtime_error("The contraction hierarchy file is truncated.");
+            }
+
+            for (std::size_t index{}; index < bytes.size(); index += sizeof(field_t))
+            {
+                field_t value{};
+
+                for (std::size_t byte{}; byte < sizeof(field_t); ++byte)
+                {
+                    value |= static_cast<field_t>(
+                        static_cast<field_t>(static_cast<std::uint8_t>(bytes[index + byte])) << (byte * 8U));
+                }
+
+                items.push_back(std::bit_cast<item_t>(value));
+            }
+        }
+    }
+
+    inline void ch_write_u64(std::ostream &str, const std::uint64_t value)
+    {
+        ch_write_fields(str, std::span<const std::uint64_t>(&value, 1));
+    }
+
+    [[nodiscard]] inline auto ch_read_u64(std::istream &str) -> std::uint64_t
+    {
+        std::vector<std::uint64_t> values;
+        ch_read_fields(str, 1U, values);
+
+        return values[0];
+    }
+
+    template<class item_t>
+    inline void ch_write_array(std::ostream &str, const std::vector<item_t> &items)
+    {
+        ch_write_u64(str, static_cast<std::uint64_t>(items.size()));
+        ch_write_fields(str, std::span<const item_t>(items));
+    }
+
+    // The size must be in [min_size, max_size].
+    template<class item_t>
+    [[nodiscard]] inline auto ch_read_array(std::istream &str, const std::uint64_t min_size,
+        const std::uint64_t max_size, const std::string &name) -> std::vector<item_t>
+    {
+        const auto size = ch_read_u64(str);
+
+        if (size < min_size || max_size < size) [[unlikely]]
+        {
+            auto err = ::Standard::Algorithms::Utilities::w_stream();
+            err << "The contraction hierarchy " << name << " size " << size << " must be in [" << min_size << ", "
+                << max_size << "].";
+            throw_exception(err);
+        }
+
+        std::vector<item_t> items;
+        ch_read_fields(str, static_cast<std::size_t>(size), items);
+
+        return items;
+    }
+
+    // Contract the vertices one by one in the order of the edge difference:
+    // (added shortcuts - removed edges + contracted neighbors).
+    // The priorities are updated lazily: a popped vertex is re-inserted when its fresh priority is worse.
+    template<class vertex_t, class weight_t>
+    struct ch_builder final
+    {
+        using edge_t = ch_edge<vertex_t, weight_t>;
+        using edges_t = std::vector<edge_t>;
+
+        static constexpr auto absent = static_cast<vertex_t>(absent_parent);
+
+        constexpr ch_builder(const weighted_adjacency_graph auto &graph, const std::size_t witness_settled_limit)
+            : Settled_limit(require_positive(witness_settled_limit, "witness settled limit"))
+            , Outs(require_greater(graph.size(), 1U, "graph size"))
+            , Ins(graph.size())
+            , Ups(graph.size())
+            , Downs(graph.size())
+            , Ranks(graph.size(), absent)
+            , Contracted_neighbors(graph.size())
+            , Neighbor_marks(graph.size(), absent)
+            , Witness_distances(graph.size(), std::numeric_limits<weight_t>::max())
+        {
+            for (std::size_t from{}; from < graph.size(); ++from)
+            {
+                for (const auto &edge : graph[from])
+                {
+                    const auto tod = static_cast<vertex_t>(edge.vertex);
+                    if (edge.weight < weight_t{}) [[unlikely]]
+                    {
+                        throw std::invalid_argument("The contraction hierarchy edge weights must be non-negative.");
+                    }
+
+                    if (static_cast<std::size_t>(tod) != from)
+                    {
+                        add_or_improve(static_cast<vertex_t>(from), tod, edge.weight, absent);
+                    }
+                }
+            }
+        }
+
+        constexpr void run()
+        {
+            using item_t = std::pair<std::int64_t, vertex_t>;
+
+            std::priority_queue<item_t, std::vector<item_t>, std::greater<>> que;
+
+            for (vertex_t vertex{}; static_cast<std::size_t>(vertex) < Outs.size(); ++vertex)
+            {
+                que.emplace(priority(vertex), vertex);
+            }
+
+            vertex_t rank{};
+
+            while (!que.empty())
+            {
+                const auto vertex = que.top().second;
+                que.pop();
+
+                if (const auto fresh = priority(vertex); !que.empty() && que.top().first < fresh)
+                {
+                    que.emplace(fresh, vertex);
+                    continue;
+                }
+
+                contract(vertex);
+                Ranks[vertex] = rank++;
+            }
+        }
+
+        // NOLINTNEXTLINE
+        std::size_t Settled_limit;
+
+        // The remaining graph.
+        // NOLINTNEXTLINE
+        std::vector<edges_t> Outs;
+
+        // NOLINTNEXTLINE
+        std::vector<edges_t> Ins;
+
+        // Output: the edges to the higher ranked vertices.
+        // NOLINTNEXTLINE
+        std::vector<edges_t> Ups;
+
+        // Output: the edges from the higher ranked vertices, stored at the lower ends.
+        // NOLINTNEXTLINE
+        std::vector<edges_t> Downs;
+
+        // NOLINTNEXTLINE
+        std::vector<vertex_t> Ranks;
+
+private:
+        static constexpr void add_or_improve(edges_t &edges, const vertex_t vertex, const weight_t &weight,
+            const vertex_t middle)
+        {
+            const auto iter = std::find_if(edges.begin(), edges.end(),
+                [vertex](const auto &edge)
+                {
+                    return edge.vertex == vertex;
+                });
+
+            if (iter == edges.end())
+            {
+                edges.push_back(edge_t{ vertex, weight, middle });
+            }
+            else if (weight < iter->weight)
+            {
+                iter->weight = weight;
+                iter->middle = middle;
+            }
+        }
+
+        constexpr void add_or_improve(const vertex_t from, const vertex_t tod, const weight_t &weight,
+            const vertex_t middle)
+        {
+            add_or_improve(Outs[from], tod, weight, middle);
+            add_or_improve(Ins[tod], from, weight, middle);
+        }
+
+        // A bounded Dijkstra from the source avoiding the vertex being contracted.
+        // It may miss a witness, which only adds a superfluous shortcut.
+        constexpr void witness_search(const vertex_t source, const vertex_t avoided, const weight_t &max_distance)
+        {
+            for (const auto &vertex : Witness_touched)
+            {
+                Witness_distances[vertex] = std::numeric_limits<weight_t>::max();
+            }
+
+            Witness_touched.assign(1, source);
+            Witness_distances[source] = weight_t{};
+
+            using item_t = std::pair<weight_t, vertex_t>;
+
+            std::priority_queue<item_t, std::vector<item_t>, std::greater<>> que;
+            que.emplace(weight_t{}, source);
+
+            for (std::size_t settled{}; !que.empty() && settled < Settled_limit; ++settled)
+            {
+                const auto [dist_from, from] = que.top();
+                que.pop();
+
+                if (dist_from != Witness_distances[from])
+                {
+                    continue;
+                }
+
+                if (max_distance < dist_from)
+                {
+                    return;
+                }
+
+                for (const auto &edge : Outs[from])
+                {
+                    if (edge.vertex == avoided)
+                    {
+                        continue;
+                    }
+
+                    const auto cand = static_cast<weight_t>(dist_from + edge.weight);
+                    auto &dist = Witness_distances[edge.vertex];
+
+                    if (cand < dist)
+                    {
+                        if (dist == std::numeric_limits<weight_t>::max())
+                        {
+                            Witness_touched.push_back(edge.vertex);
+                        }
+
+                        dist = cand;
+                        que.emplace(cand, edge.vertex);
+                    }
+                }
+            }
+        }
+
+        // Return the number of the needed shortcuts, and add them when "is_adding".
+        template<bool is_adding>
+        constexpr auto shortcuts(const vertex_t vertex) -> std::int64_t
+        {
+            std::int64_t count{};
+
+            if (Outs[vertex].empty())
+            {
+                return count;
+            }
+
+            weight_t max_out{};
+
+            for (const auto &edge : Outs[vertex])
+            {
+                max_out = std::max(max_out, edge.weight);
+            }
+
+            for (const auto &in_edge : Ins[vertex])
+            {
+                const auto &from = in_edge.vertex;
+                witness_search(from, vertex, static_cast<weight_t>(in_edge.weight + max_out));
+
+                for (const auto &out_edge : Outs[vertex])
+                {
+                    const auto &tod = out_edge.vertex;
+                    if (tod == from)
+                    {
+                        continue;
+                    }
+
+                    const auto via = static_cast<weight_t>(in_edge.weight + out_edge.weight);
+                    if (!(via < Witness_distances[tod]))
+                    {
+                        continue;
+                    }
+
+                    ++count;
+
+                    if constexpr (is_adding)
+                    {
+                        add_or_improve(from, tod, via, vertex);
+                    }
+                }
+            }
+
+            return count;
+        }
+
+        [[nodiscard]] constexpr auto priority(const vertex_t vertex) -> std::int64_t
+        {
+            const auto removed = static_cast<std::int64_t>(Outs[vertex].size() + Ins[vertex].size());
+
+            return shortcuts<false>(vertex) - removed + Contracted_neighbors[vertex];
+        }
+
+        constexpr void contract(const vertex_t vertex)
+        {
+            shortcuts<true>(vertex);
+
+            Ups[vertex] = std::move(Outs[vertex]);
+            Downs[vertex] = std::move(Ins[vertex]);
+
+            const auto is_vertex = [vertex](const auto &edge)
+            {
+                return edge.vertex == vertex;
+            };
+
+            // A neighbor on both an in-arc and an out-arc is counted once;
+            // the marks need no reset as each vertex is contracted once.
+            for (const auto &edge : Ups[vertex])
+            {
+                std::erase_if(Ins[edge.vertex], is_vertex);
+                ++Contracted_neighbors[edge.vertex];
+                Neighbor_marks[edge.vertex] = vertex;
+            }
+
+            for (const auto &edge : Downs[vertex])
+            {
+                std::erase_if(Outs[edge.vertex], is_vertex);
+
+                if (Neighbor_marks[edge.vertex] != vertex)
+                {
+                    ++Contracted_neighbors[edge.vertex];
+                }
+            }
+
+            Outs[vertex] = {};
+            Ins[vertex] = {};
+        }
+
+        std::vector<std::int64_t> Contracted_neighbors;
+        std::vector<vertex_t> Neighbor_marks;
+        std::vector<weight_t> Witness_distances;
+        std::vector<vertex_t> Witness_touched{};
+    };
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Contraction hierarchies for a non-negative weight digraph.
+    // Preprocess once, and then answer the shortest path queries by
+    // two searches climbing up the hierarchy which settle only a few hundred vertices on a road network.
+    // The upward graph has the edges to the higher ranked vertices;
+    // the downward graph has the edges from the higher ranked vertices,
+    // reversed for the backward search from the target.
+    template<class vertex_t, class weight_t>
+    struct contraction_hierarchy final
+    {
+        using graph_t = csr_graph<vertex_t, weight_t>;
+
+        static constexpr auto absent = static_cast<vertex_t>(absent_parent);
+
+        // The witness settled limit trades the preprocessing time for more shortcuts.
+        [[nodiscard]] static constexpr auto build(
+            const weighted_adjacency_graph auto &graph, const std::size_t witness_settled_limit = 500)
+            -> contraction_hierarchy
+        {
+            Inner::ch_builder<vertex_t, weight_t> builder(graph, witness_settled_limit);
+            builder.run();
+
+            auto [upward, up_middles] = to_csr(builder.Ups);
+            auto [downward, down_middles] = to_csr(builder.Downs);
+
+            return contraction_hierarchy(std::move(builder.Ranks), std::move(upward), std::move(up_middles),
+                std::move(downward), std::move(down_middles));
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Ranks.size();
+        }
+
+        [[nodiscard]] constexpr auto ranks() const &noexcept -> const std::vector<vertex_t> &
+        {
+            return Ranks;
+        }
+
+        [[nodiscard]] constexpr auto upward() const &noexcept -> const graph_t &
+        {
+            return Upward;
+        }
+
+        [[nodiscard]] constexpr auto downward() const &noexcept -> const graph_t &
+        {
+            return Downward;
+        }
+
+        // The middle vertex for each upward edge, or absent.
+        [[nodiscard]] constexpr auto up_middles() const &noexcept -> const std::vector<vertex_t> &
+        {
+            return Up_middles;
+        }
+
+        [[nodiscard]] constexpr auto down_middles() const &noexcept -> const std::vector<vertex_t> &
+        {
+            return Down_middles;
+        }
+
+        [[nodiscard]] constexpr auto shortcut_count() const noexcept -> std::size_t
+        {
+            const auto is_shortcut = [](const auto &middle)
+            {
+                return middle != absent;
+            };
+
+            return static_cast<std::size_t>(std::count_if(Up_middles.cbegin(), Up_middles.cend(), is_shortcut) +
+                std::count_if(Down_middles.cbegin(), Down_middles.cend(), is_shortcut));
+        }
+
+        // A portable binary format to skip the preprocessing on startup.
+        void save(std::ostream &str) const
+        {
+            Inner::ch_write_u64(str, file_signature);
+            Inner::ch_write_array(str, Ranks);
+
+            for (const auto &[graph, middles] : { std::make_pair(&Upward, &Up_middles),
+                     std::make_pair(&Downward, &Down_middles) })
+            {
+                const std::vector<std::uint64_t> offsets(graph->offsets().cbegin(), graph->offsets().cend());
+
+                Inner::ch_write_array(str, offsets);
+                Inner::ch_write_array(str, graph->targets());
+                Inner::ch_write_array(str, graph->weights());
+                Inner::ch_write_array(str, *middles);
+            }
+        }
+
+        // Throw on a truncated or corrupt file.
+        [[nodiscard]] static auto load(std::istream &str) -> contraction_hierarchy
+        {
+            if (Inner::ch_read_u64(str) != file_signature) [[unlikely]]
+            {
+                throw std::runtime_error("Not a contraction hierarchy file, or a different version.");
+            }
+
+            constexpr auto max_vertices = static_cast<std::uint64_t>(std::numeric_limits<vertex_t>::max());
+
+            auto ranks = Inner::ch_read_array<vertex_t>(str, 2U, max_vertices, "ranks");
+            check_ranks(ranks);
+
+            const auto size = static_cast<std::uint64_t>(ranks.size());
+
+            auto read_graph = [&str, &ranks, size](const std::string &name)
+            {
+                auto offsets = Inner::ch_read_array<std::uint64_t>(str, size + 1U, size + 1U, name + " offsets");
+
+                const auto edge_count = offsets.back();
+                check_offsets(offsets, name);
+
+                auto targets = Inner::ch_read_array<vertex_t>(str, edge_count, edge_count, name + " targets");
+                auto weights = Inner::ch_read_array<weight_t>(str, edge_count, edge_count, name + " weights");
+                auto middles = Inner::ch_read_array<vertex_t>(str, edge_count, edge_count, name + " middles");
+                check_edges(ranks, offsets, targets, weights, middles, name);
+
+                return std::make_pair(graph_t(std::vector<std::size_t>(offsets.cbegin(), offsets.cend()),
+                                          std::move(targets), std::move(weights)),
+                    std::move(middles));
+            };
+
+            auto [upward, up_middles] = read_graph("upward");
+            auto [downward, down_middles] = read_graph("downward");
+
+            return contraction_hierarchy(std::move(ranks), std::move(upward), std::move(up_middles),
+                std::move(downward), std::move(down_middles));
+        }
+
+private:
+        // "CH" + version 2 + whether the weight is floating + sizes of the vertex, weight.
+        static constexpr std::uint64_t file_signature = 0x4348'0002'0000'0000ULL |
+            (std::is_floating_point_v<weight_t> ? 0x1'0000ULL : 0U) | (sizeof(vertex_t) << 8U) | sizeof(weight_t);
+
+        [[noreturn]] static void throw_corrupt(const std::string &message)
+        {
+            throw std::runtime_error("The contraction hierarchy file is corrupt: " + message + ".");
+        }
+
+        // The ranks must be a permutation.
+        static void check_ranks(const std::vector<vertex_t> &ranks)
+        {
+            std::vector<bool> is_taken(ranks.size());
+
+            for (const auto &rank : ranks)
+            {
+                if (rank < vertex_t{} || ranks.size() <= static_cast<std::size_t>(rank) ||
+                    is_taken[static_cast<std::size_t>(rank)]) [[unlikely]]
+                {
+                    throw_corrupt("the ranks must be a permutation");
+                }
+
+                is_taken[static_cast<std::size_t>(rank)] = true;
+            }
+        }
+
+        static void check_offsets(const std::vector<std::uint64_t> &offsets, const std::string &name)
+        {
+            if (offsets[0] != 0U || !std::is_sorted(offsets.cbegin(), offsets.cend()) ||
+                std::numeric_limits<std::size_t>::max() < offsets.back()) [[unlikely]]
+            {
+                throw_corrupt("the " + name + " offsets must start from 0 and be non-decreasing");
+            }
+        }
+
+        // An edge goes to a higher ranked vertex; a shortcut skips over a lower ranked one.
+        // This also guarantees the shortcut unpacking stops.
+        static void check_edges(const std::vector<vertex_t> &ranks, const std::vector<std::uint64_t> &offsets,
+            const std::vector<vertex_t> &targets, const std::vector<weight_t> &weights,
+            const std::vector<vertex_t> &middles, const std::string &name)
+        {
+            const auto is_vertex = [size = ranks.size()](const vertex_t &vertex)
+            {
+                return !(vertex < vertex_t{}) && static_cast<std::size_t>(vertex) < size;
+            };
+
+            for (std::size_t from{}; from < ranks.size(); ++from)
+            {
+                const auto &rank = ranks[from];
+
+                for (auto index = static_cast<std::size_t>(offsets[from]);
+                     index < static_cast<std::size_t>(offsets[from + 1U]); ++index)
+                {
+                    const auto &tod = targets[index];
+                    const auto &middle = middles[index];
+
+                    if (!is_vertex(tod) || !(rank < ranks[tod]) || weights[index] < weight_t{} ||
+                        (middle != absent && (!is_vertex(middle) || !(ranks[middle] < rank)))) [[unlikely]]
+                    {
+                        throw_corrupt("bad " + name + " edge from " + std::to_string(from) + " at " +
+                            std::to_string(index));
+                    }
+                }
+            }
+        }
+
+        constexpr contraction_hierarchy(std::vector<vertex_t> &&ranks, graph_t &&upward,
+            std::vector<vertex_t> &&up_middles, graph_t &&downward, std::vector<vertex_t> &&down_middles)
+            : Ranks(std::move(ranks))
+            , Upward(std::move(upward))
+            , Downward(std::move(downward))
+            , Up_middles(std::move(up_middles))
+            , Down_middles(std::move(down_middles))
+        {
+            const auto size = Ranks.size();
+            require_equal(size, "upward size", Upward.size());
+            require_equal(size, "downward size", Downward.size());
+            require_equal(Upward.edge_count(), "up middles size", Up_middles.size());
+            require_equal(Downward.edge_count(), "down middles size", Down_middles.size());
+        }
+
+        [[nodiscard]] static constexpr auto to_csr(
+            const std::vector<std::vector<Inner::ch_edge<vertex_t, weight_t>>> &lists)
+            -> std::pair<graph_t, std::vector<vertex_t>>
+        {
+            std::vector<std::vector<weighted_vertex<vertex_t, weight_t>>> adjacency_lists(lists.size());
+            std::vector<vertex_t> middles;
+
+            for (std::size_t from{}; from < lists.size(); ++from)
+            {
+                for (const auto &edge : lists[from])
+                {
+                    adjacency_lists[from].emplace_back(edge.vertex, edge.weight);
+                    middles.push_back(edge.middle);
+                }
+            }
+
+            return { graph_t(adjacency_lists), std::move(middles) };
+        }
+
+        std::vector<vertex_t> Ranks;
+        graph_t Upward;
+        graph_t Downward;
+        std::vector<vertex_t> Up_middles;
+        std::vector<vertex_t> Down_middles;
+    };
+
+    // The reusable query buffers for one thread; a hierarchy can be shared by many queries.
+    template<class vertex_t, class weight_t>
+    struct contraction_hierarchy_query final
+    {
+        using hierarchy_t = contraction_hierarchy<vertex_t, weight_t>;
+
+        constexpr contraction_hierarchy_query(const hierarchy_t &hierarchy, const weight_t &infinite_weight)
+            : Hierarchy(hierarchy)
+            , Infinite_weight(require_positive(infinite_weight, "infinite weight"))
+            , Forward(hierarchy.size(), infinite_weight)
+            , Backward(hierarchy.size(), infinite_weight)
+        {
+        }
+
+        // Return the distance, or the infinite weight when the target is not reachable.
+        constexpr auto distance(const vertex_t source, const vertex_t target) -> weight_t
+        {
+            const auto size = Hierarchy.size();
+
+            for (const auto &vertex : { source, target })
+            {
+                if (vertex < vertex_t{} || size <= static_cast<std::size_t>(vertex)) [[unlikely]]
+                {
+                    auto str = ::Standard::Algorithms::Utilities::w_stream();
+                    str << "The vertex " << vertex << " must be in [0, " << (size - 1U) << "].";
+                    throw_exception(str);
+                }
+            }
+
+            reset(Forward);
+            reset(Backward);
+            Meeting = hierarchy_t::absent;
+
+            relax(Forward, source, weight_t{}, hierarchy_t::absent, 0U);
+            relax(Backward, target, weight_t{}, hierarchy_t::absent, 0U);
+
+            auto best = Infinite_weight;
+
+            if (source == target)
+            {
+                best = weight_t{};
+                Meeting = source;
+            }
+
+            for (;;)
+            {
+                skip_stale(Forward);
+                skip_stale(Backward);
+
+                const auto is_forward_done = Forward.heap.empty() || !(Forward.heap.top().first < best);
+                const auto is_backward_done = Backward.heap.empty() || !(Backward.heap.top().first < best);
+
+                if (is_forward_done && is_backward_done)
+                {
+                    break;
+                }
+
+                if (!is_forward_done && (is_backward_done || Forward.heap.top().first <= Backward.heap.top().first))
+                {
+                    expand(Hierarchy.upward(), Forward, Backward, best);
+                }
+                else
+                {
+                    expand(Hierarchy.downward(), Backward, Forward, best);
+                }
+            }
+
+            return best;
+        }
+
+        // Return the distance, and the path in the original graph with all the shortcuts unpacked.
+        constexpr auto find_path(const vertex_t source, const vertex_t target, std::vector<vertex_t> &path) -> weight_t
+        {
+            path.clear();
+
+            const auto best = distance(source, target);
+            if (Meeting == hierarchy_t::absent)
+            {
+                return best;
+            }
+
+            // The upward edges from the source to the meeting vertex.
+            std::vector<std::pair<vertex_t, std::size_t>> hops;
+
+            for (auto vertex = Meeting; vertex != source; vertex = Forward.parents[vertex])
+            {
+                hops.emplace_back(vertex, Forward.parent_edges[vertex]);
+            }
+
+            path.push_back(source);
+
+            for (auto iter = hops.crbegin(); iter != hops.crend(); ++iter)
+            {
+                const auto &[vertex, edge_index] = *iter;
+                unpack(Forward.parents[vertex], vertex, Hierarchy.up_middles()[edge_index], path);
+            }
+
+            // The reversed downward edges from the meeting vertex to the target.
+            for (auto vertex = Meeting; vertex != target; vertex = Backward.parents[vertex])
+            {
+                const auto &edge_index = Backward.parent_edges[vertex];
+                unpack(vertex, Backward.parents[vertex], Hierarchy.down_middles()[edge_index], path);
+            }
+
+            return best;
+        }
+
+private:
+        using heap_item_t = std::pair<weight_t, vertex_t>;
+
+        struct search_side final
+        {
+            constexpr search_side(const std::size_t vertex_count, const weight_t &infinite_weight)
+                : distances(vertex_count, infinite_weight)
+                , parents(vertex_count, hierarchy_t::absent)
+                , parent_edges(vertex_count)
+            {
+            }
+
+            // NOLINTNEXTLINE
+            std::vector<weight_t> distances;
+
+            // NOLINTNEXTLINE
+            std::vector<vertex_t> parents;
+
+            // The edge index in the upward or downward graph.
+            // NOLINTNEXTLINE
+            std::vector<std::size_t> parent_edges;
+
+            // NOLINTNEXTLINE
+            std::vector<vertex_t> touched{};
+
+            // NOLINTNEXTLINE
+            std::priority_queue<heap_item_t, std::vector<heap_item_t>, std::greater<>> heap{};
+        };
+
+        constexpr void reset(search_side &side) const
+        {
+            for (const auto &vertex : side.touched)
+            {
+                side.distances[vertex] = Infinite_weight;
+                side.parents[vertex] = hierarchy_t::absent;
+            }
+
+            side.touched.clear();
+            side.heap = {};
+        }
+
+        constexpr void relax(search_side &side, const vertex_t vertex, const weight_t &distance, const vertex_t parent,
+            const std::size_t edge_index) const
+        {
+            auto &dist = side.distances[vertex];
+            if (dist == Infinite_weight)
+            {
+                side.touched.push_back(vertex);
+            }
+
+            dist = distance;
+            side.parents[vertex] = parent;
+            side.parent_edges[vertex] = edge_index;
+            side.heap.emplace(distance, vertex);
+        }
+
+        static constexpr void skip_stale(search_side &side)
+        {
+            while (!side.heap.empty() && side.heap.top().first != side.distances[side.heap.top().second])
+            {
+                side.heap.pop();
+            }
+        }
+
+        constexpr void expand(const auto &graph, search_side &side, const search_side &other, weight_t &best)
+        {
+            const auto from = side.heap.top().second;
+            side.heap.pop();
+
+            const auto dist_from = side.distances[from];
+            const auto first = static_cast<std::size_t>(graph.offsets()[from]);
+            const auto last = static_cast<std::size_t>(graph.offsets()[from + 1]);
+
+            const auto &targets = graph.targets();
+            const auto &weights = graph.weights();
+
+            for (auto index = first; index < last; ++index)
+            {
+                const auto &tod = targets[index];
+                const auto cand = static_cast<weight_t>(dist_from + weights[index]);
+
+                if (!(cand < side.distances[tod]))
+                {
+                    continue;
+                }
+
+                relax(side, tod, cand, from, index);
+
+                if (const auto &other_dist = other.distances[tod]; other_dist != Infinite_weight)
+                {
+                    if (const auto total = static_cast<weight_t>(cand + other_dist); total < best)
+                    {
+                        best = total;
+                        Meeting = tod;
+                    }
+                }
+            }
+        }
+
+        // Find the edge index from "from" to "tod" in the lower ranked vertex lists.
+        [[nodiscard]] static constexpr auto find_edge(const auto &graph, const vertex_t from, const vertex_t tod)
+            -> std::size_t
+        {
+            const auto first = static_cast<std::size_t>(graph.offsets()[from]);
+            const auto last = static_cast<std::size_t>(graph.offsets()[from + 1]);
+            const auto &targets = graph.targets();
+
+            for (auto index = first; index < last; ++index)
+            {
+                if (targets[index] == tod)
+                {
+                    return index;
+                }
+            }
+
+            throw std::runtime_error("The contraction hierarchy must have a shortcut part edge.");
+        }
+
+        // Append the original graph vertices after "from" up to "tod".
+        constexpr void unpack(
+            const vertex_t from, const vertex_t tod, const vertex_t middle, std::vector<vertex_t> &path)
+        {
+            Unpack_stack.assign(1, std::make_tuple(from, tod, middle));
+
+            do
+            {
+                const auto [one, two, mid] = Unpack_stack.back();
+                Unpack_stack.pop_back();
+
+                if (mid == hierarchy_t::absent)
+                {
+                    path.push_back(two);
+                    continue;
+                }
+
+                // The middle was contracted before both ends:
+                // mid -> two is an upward edge of mid, one -> mid is a downward edge stored at mid.
+                const auto up_index = find_edge(Hierarchy.upward(), mid, two);
+                const auto down_index = find_edge(Hierarchy.downward(), mid, one);
+
+                Unpack_stack.emplace_back(mid, two, Hierarchy.up_middles()[up_index]);
+                Unpack_stack.emplace_back(one, mid, Hierarchy.down_middles()[down_index]);
+            } while (!Unpack_stack.empty());
+        }
+
+        const hierarchy_t &Hierarchy;
+        weight_t Infinite_weight;
+        search_side Forward;
+        search_side Backward;
+        vertex_t Meeting = hierarchy_t::absent;
+        std::vector<std::tuple<vertex_t, vertex_t, vertex_t>> Unpack_stack{};
+    };
+} // namespace Standard::Algorithms::Graphs
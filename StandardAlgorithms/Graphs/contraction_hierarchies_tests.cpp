@@ -0,0 +1,231 @@
+#include"contraction_hierarchies_tests.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"contraction_hierarchies.h"
+#include<sstream>
+
+namespace
+{
+    using vertex_t = std::int32_t;
+    using weight_t = std::int64_t;
+    using graph_t = Standard::Algorithms::Graphs::graph<vertex_t, weight_t>;
+    using hierarchy_t = Standard::Algorithms::Graphs::contraction_hierarchy<vertex_t, weight_t>;
+    using query_t = Standard::Algorithms::Graphs::contraction_hierarchy_query<vertex_t, weight_t>;
+
+    constexpr auto absent_parent = Standard::Algorithms::Graphs::absent_parent;
+    constexpr weight_t infinite_weight = std::numeric_limits<weight_t>::max() / 2;
+
+    [[nodiscard]] auto random_graph(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd,
+        const bool is_undirected) -> graph_t
+    {
+        constexpr auto min_size = 2;
+        constexpr auto max_size = 40;
+        constexpr auto max_weight = 100;
+
+        const auto size = rnd(min_size, max_size);
+        const auto edges = rnd(0, size * 3);
+
+        graph_t graph(size);
+
+        for (std::int32_t index{}; index < edges; ++index)
+        {
+            const auto from = rnd(0, size - 1);
+            const auto tod = rnd(0, size - 1);
+
+            if (from != tod)
+            {
+                graph.add_edge(from, tod, rnd(0, max_weight), is_undirected);
+            }
+        }
+
+        return graph;
+    }
+
+    void verify_path(const graph_t &graph, const vertex_t source, const vertex_t target,
+        const std::vector<vertex_t> &path, const weight_t &expected, const std::string &name)
+    {
+        Standard::Algorithms::require_positive(path.size(), name + " path size");
+        ::Standard::Algorithms::ert::are_equal(source, path.front(), name + " path front");
+        ::Standard::Algorithms::ert::are_equal(target, path.back(), name + " path back");
+
+        weight_t sum{};
+
+        for (std::size_t index = 1; index < path.size(); ++index)
+        {
+            auto weight = infinite_weight;
+
+            for (const auto &edge : graph.adjacency_lists().at(path[index - 1U]))
+            {
+                if (edge.vertex == path[index])
+                {
+                    weight = std::min(weight, edge.weight);
+                }
+            }
+
+            Standard::Algorithms::require_greater(infinite_weight, weight, name + " path edge");
+            sum += weight;
+        }
+
+        ::Standard::Algorithms::ert::are_equal(expected, sum, name + " path weight");
+    }
+
+    void verify_all_pairs(const graph_t &graph, const hierarchy_t &hierarchy, const std::string &name)
+    {
+        const auto size = static_cast<vertex_t>(graph.size());
+
+        query_t query(hierarchy, infinite_weight);
+
+        std::vector<weight_t> distances;
+        std::vector<vertex_t> parents;
+        std::vector<vertex_t> path;
+
+        for (vertex_t source{}; source < size; ++source)
+        {
+            Standard::Algorithms::Graphs::dijkstra_prior_que<vertex_t, weight_t>::run(
+                graph, absent_parent, infinite_weight, source, distances, parents);
+
+            for (vertex_t target{}; target < size; ++target)
+            {
+                const auto sub_name = name + " source " + std::to_string(source) + ", target " + std::to_string(target);
+                const auto &expected = distances[target];
+                const auto is_reachable = expected != infinite_weight - 1;
+
+                const auto actual = query.find_path(source, target, path);
+                ::Standard::Algorithms::ert::are_equal(
+                    is_reachable ? expected : infinite_weight, actual, sub_name + " distance");
+
+                if (is_reachable)
+                {
+                    verify_path(graph, source, target, path, expected, sub_name);
+                }
+                else
+                {
+                    ::Standard::Algorithms::ert::are_equal(0U, path.size(), sub_name + " empty path");
+                }
+            }
+        }
+    }
+
+    void random_test(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd, const bool is_undirected)
+    {
+        const auto graph = random_graph(rnd, is_undirected);
+        const auto name = std::string(is_undirected ? "undirected" : "directed") + " size " +
+            std::to_string(graph.size());
+
+        // A tiny witness limit adds more shortcuts, which must not break the answers.
+        const auto witness_settled_limit = static_cast<std::size_t>(rnd(1, 2)) == 1U ? 1U : 500U;
+
+        const auto hierarchy = hierarchy_t::build(graph.adjacency_lists(), witness_settled_limit);
+        verify_all_pairs(graph, hierarchy, name);
+
+        std::stringstream str;
+        hierarchy.save(str);
+
+        const auto loaded = hierarchy_t::load(str);
+        ::Standard::Algorithms::ert::are_equal(hierarchy.ranks(), loaded.ranks(), name + " loaded ranks");
+        ::Standard::Algorithms::ert::are_equal(
+            hierarchy.shortcut_count(), loaded.shortcut_count(), name + " loaded shortcut count");
+
+        verify_all_pairs(graph, loaded, name + " loaded");
+    }
+
+    void bad_file_test()
+    {
+        std::stringstream str("not a contraction hierarchy");
+
+        ::Standard::Algorithms::ert::expect_exception<std::runtime_error>(
+            "Not a contraction hierarchy file, or a different version.",
+            [&str]
+            {
+                [[maybe_unused]] const auto loaded = hierarchy_t::load(str);
+            },
+            "load a bad file");
+    }
+
+    [[nodiscard]] auto small_file() -> std::string
+    {
+        graph_t graph(3);
+        graph.add_edge(0, 1, 2, true);
+        graph.add_edge(1, 2, 3, true);
+
+        const auto hierarchy = hierarchy_t::build(graph.adjacency_lists());
+
+        std::stringstream str;
+        hierarchy.save(str);
+
+        return str.str();
+    }
+
+    void expect_load_error(const std::string &file, const std::string &error, const std::string &name)
+    {
+        ::Standard::Algorithms::ert::expect_exception<std::runtime_error>(
+            error,
+            [&file]
+            {
+                std::stringstream str(file);
+                [[maybe_unused]] const auto loaded = hierarchy_t::load(str);
+            },
+            name);
+    }
+
+    void truncated_file_test()
+    {
+        const auto file = small_file();
+
+        for (std::size_t length{}; length < file.size(); ++length)
+        {
+            expect_load_error(file.substr(0, length), "The contraction hierarchy file is truncated.",
+                "load a file truncated to " + std::to_string(length));
+        }
+    }
+
+    void corrupt_file_test()
+    {
+        const auto file = small_file();
+
+        // The signature, the ranks size, then the ranks.
+        constexpr std::size_t ranks_size_position = 8;
+        constexpr std::size_t ranks_position = 16;
+        constexpr auto rank_bytes = sizeof(vertex_t);
+
+        {
+            auto huge = file;
+            huge.replace(ranks_size_position, 8, 8, '\xFF');
+
+            expect_load_error(huge, "The contraction hierarchy ranks size 18446744073709551615 must be in [2, ",
+                "load a file with a huge size");
+        }
+        {
+            auto repeated = file;
+            repeated.replace(ranks_position, rank_bytes, file.substr(ranks_position + rank_bytes, rank_bytes));
+
+            expect_load_error(repeated, "The contraction hierarchy file is corrupt: the ranks must be a permutation.",
+                "load a file with a repeated rank");
+        }
+        {
+            // The upward offsets size and the first offset follow the ranks.
+            auto shifted = file;
+            shifted[ranks_position + (rank_bytes * 3U) + 8U] = 1;
+
+            expect_load_error(shifted, "The contraction hierarchy file is corrupt: the upward offsets",
+                "load a file with a bad first offset");
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Tests::contraction_hierarchies_tests()
+{
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+    constexpr auto steps = 10;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        random_test(rnd, false);
+        random_test(rnd, true);
+    }
+
+    bad_file_test();
+    truncated_file_test();
+    corrupt_file_test();
+}
@@ -3,6 +3,7 @@
 #include"../Numbers/hash_utilities.h"
 #include"../Numbers/shift.h"
 #include"../Utilities/random.h"
+#include<algorithm>
 #include<unordered_set>
 #include<vector>
 
@@ -161,4 +162,36 @@ namespace Standard::Algorithms::Graphs
 
         return graph;
     }
+
+    // A simple bipartite graph as the left part adjacency lists; the right vertices are [0..right_size-1].
+    // The edge count is capped by left_size * right_size.
+    template<std::integral int_t>
+    [[nodiscard]] constexpr auto create_random_bipartite_graph(
+        const int_t left_size, const int_t right_size, std::int64_t edge_count) -> std::vector<std::vector<int_t>>
+    {
+        assert(int_t{} < left_size && int_t{} < right_size && !(edge_count < 0));
+
+        edge_count = std::min<std::int64_t>(edge_count, static_cast<std::int64_t>(left_size) * right_size);
+
+        Standard::Algorithms::Utilities::random_t<int_t> rnd{};
+
+        std::vector<std::vector<int_t>> graph(left_size);
+
+        using pair_t = std::pair<int_t, int_t>;
+
+        std::unordered_set<pair_t, Standard::Algorithms::Numbers::pair_hash> edges;
+
+        while (static_cast<std::int64_t>(edges.size()) < edge_count)
+        {
+            const auto from = rnd(int_t{}, left_size - 1);
+            const auto tod = rnd(int_t{}, right_size - 1);
+
+            if (edges.insert(pair_t{ from, tod }).second)
+            {
+                graph[from].push_back(tod);
+            }
+        }
+
+        return graph;
+    }
 } // namespace Standard::Algorithms::Graphs
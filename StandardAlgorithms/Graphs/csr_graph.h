@@ -0,0 +1,289 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include"adjacency_graph.h"
+#include"graph.h"
+#include<algorithm>
+#include<cstddef>
+#include<stdexcept>
+#include<tuple>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // The out-going edges of one vertex in a csr_graph.
+    // The edges are returned by value as they are stored in 2 separate arrays.
+    template<class vertex_t, class weight_t>
+    struct csr_edges final
+    {
+        using value_type = weighted_vertex<vertex_t, weight_t>;
+
+        struct iterator final
+        {
+            using value_type = weighted_vertex<vertex_t, weight_t>;
+            using difference_type = std::ptrdiff_t;
+
+            // NOLINTNEXTLINE
+            const vertex_t *target{};
+
+            // NOLINTNEXTLINE
+            const weight_t *weight{};
+
+            [[nodiscard]] constexpr auto operator* () const -> value_type
+            {
+                assert(target != nullptr && weight != nullptr);
+
+                return value_type{ *target, *weight };
+            }
+
+            constexpr auto operator++ () noexcept -> iterator &
+            {
+                ++target;
+                ++weight;
+                return *this;
+            }
+
+            constexpr auto operator++ (int) noexcept -> iterator
+            {
+                auto old = *this;
+                ++*this;
+                return old;
+            }
+
+            [[nodiscard]] constexpr auto operator== (const iterator &other) const noexcept -> bool
+            {
+                return target == other.target;
+            }
+        };
+
+        [[nodiscard]] constexpr auto begin() const noexcept -> iterator
+        {
+            return iterator{ Targets, Weights };
+        }
+
+        [[nodiscard]] constexpr auto end() const noexcept -> iterator
+        {
+            return iterator{ Targets + Size, Weights + Size };
+        }
+
+        [[nodiscard]] constexpr auto cbegin() const noexcept -> iterator
+        {
+            return begin();
+        }
+
+        [[nodiscard]] constexpr auto cend() const noexcept -> iterator
+        {
+            return end();
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        [[nodiscard]] constexpr auto empty() const noexcept -> bool
+        {
+            return 0U == Size;
+        }
+
+        [[nodiscard]] constexpr auto operator[] (const std::size_t index) const -> value_type
+        {
+            assert(index < Size);
+
+            return value_type{ Targets[index], Weights[index] };
+        }
+
+        [[nodiscard]] constexpr auto at(const std::size_t index) const -> value_type
+        {
+            require_greater(Size, index, "csr edge index");
+
+            return (*this)[index];
+        }
+
+        // NOLINTNEXTLINE
+        const vertex_t *Targets{};
+
+        // NOLINTNEXTLINE
+        const weight_t *Weights{};
+
+        // NOLINTNEXTLINE
+        std::size_t Size{};
+    };
+
+    // An immutable directed graph in the compressed sparse row format:
+    // the out-going edges of a vertex "from" are
+    // in [offsets[from], offsets[from + 1]) of the targets, weights.
+    // There are only 3 allocations in total instead of one per vertex,
+    // and relaxing the edges of a vertex scans contiguous memory.
+    // Use a 32-bit offset_t when there are fewer than 4G edges to save memory.
+    template<class vertex_t, class weight_t, std::unsigned_integral offset_t = std::size_t>
+    struct csr_graph final
+    {
+        using edge_t = weighted_vertex<vertex_t, weight_t>;
+        using edges_t = csr_edges<vertex_t, weight_t>;
+
+        // (from, to, weight).
+        using edge_tuple_t = std::tuple<vertex_t, vertex_t, weight_t>;
+
+        constexpr explicit csr_graph(const std::vector<std::vector<edge_t>> &adjacency_lists)
+            : Offsets(require_positive(adjacency_lists.size(), "vertex count") + 1U)
+        {
+            const auto vertex_count = adjacency_lists.size();
+            std::size_t edge_count{};
+
+            for (std::size_t from{}; from < vertex_count; ++from)
+            {
+                edge_count += adjacency_lists[from].size();
+                check_edge_count(edge_count, vertex_count);
+
+                Offsets[from + 1U] = static_cast<offset_t>(edge_count);
+            }
+
+            Targets.reserve(edge_count);
+            Weights.reserve(edge_count);
+
+            for (const auto &edges : adjacency_lists)
+            {
+                for (const auto &edge : edges)
+                {
+                    Targets.push_back(edge.vertex);
+                    Weights.push_back(edge.weight);
+                }
+            }
+        }
+
+        template<class edge_t1>
+        constexpr explicit csr_graph(const graph<vertex_t, weight_t, edge_t1> &source)
+            : csr_graph(source.adjacency_lists())
+        {
+        }
+
+        // Build from an edge list without materializing the adjacency lists - use for huge graphs.
+        // The edges of a vertex keep their relative order.
+        // Time O(n + m).
+        constexpr csr_graph(const std::size_t vertex_count, const std::vector<edge_tuple_t> &edges)
+            : Offsets(require_positive(vertex_count, "vertex count") + 1U)
+            , Targets(edges.size())
+            , Weights(edges.size())
+        {
+            check_edge_count(edges.size(), vertex_count);
+
+            for (const auto &[from, tod, weight] : edges)
+            {
+                check_vertex(from, vertex_count);
+                check_vertex(tod, vertex_count);
+
+                ++Offsets[static_cast<std::size_t>(from) + 1U];
+            }
+
+            for (std::size_t from{}; from < vertex_count; ++from)
+            {
+                Offsets[from + 1U] += Offsets[from];
+            }
+
+            std::vector<offset_t> positions(Offsets.cbegin(), Offsets.cend() - 1);
+
+            for (const auto &[from, tod, weight] : edges)
+            {
+                const auto pos = static_cast<std::size_t>(positions[from]++);
+                Targets[pos] = tod;
+                Weights[pos] = weight;
+            }
+        }
+
+        // Take the ready arrays e.g. when loading from a file.
+        constexpr csr_graph(
+            std::vector<offset_t> &&offsets, std::vector<vertex_t> &&targets, std::vector<weight_t> &&weights)
+            : Offsets(std::move(offsets))
+            , Targets(std::move(targets))
+            , Weights(std::move(weights))
+        {
+            const auto vertex_count = require_positive(Offsets.size(), "offsets size") - 1U;
+            require_positive(vertex_count, "vertex count");
+            check_edge_count(Targets.size(), vertex_count);
+
+            require_equal(Targets.size(), "targets size", Weights.size());
+            require_equal(offset_t{}, "first offset", Offsets[0]);
+            require_equal(Targets.size(), "last offset", static_cast<std::size_t>(Offsets.back()));
+
+            if (!std::is_sorted(Offsets.cbegin(), Offsets.cend())) [[unlikely]]
+            {
+                throw std::invalid_argument("The CSR graph offsets must be non-decreasing.");
+            }
+
+            for (const auto &tod : Targets)
+            {
+                check_vertex(tod, vertex_count);
+            }
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Offsets.size() - 1U;
+        }
+
+        [[nodiscard]] constexpr auto edge_count() const noexcept -> std::size_t
+        {
+            return Targets.size();
+        }
+
+        [[nodiscard]] constexpr auto operator[] (const std::size_t from) const -> edges_t
+        {
+            assert(from < size());
+
+            const auto first = static_cast<std::size_t>(Offsets[from]);
+            const auto last = static_cast<std::size_t>(Offsets[from + 1U]);
+            assert(first <= last && last <= Targets.size());
+
+            return edges_t{ Targets.data() + first, Weights.data() + first, last - first };
+        }
+
+        [[nodiscard]] constexpr auto at(const std::size_t from) const -> edges_t
+        {
+            require_greater(size(), from, "csr graph vertex");
+
+            return (*this)[from];
+        }
+
+        [[nodiscard]] constexpr auto offsets() const &noexcept -> const std::vector<offset_t> &
+        {
+            return Offsets;
+        }
+
+        [[nodiscard]] constexpr auto targets() const &noexcept -> const std::vector<vertex_t> &
+        {
+            return Targets;
+        }
+
+        [[nodiscard]] constexpr auto weights() const &noexcept -> const std::vector<weight_t> &
+        {
+            return Weights;
+        }
+
+private:
+        inline static constexpr void check_edge_count(const std::size_t edge_count, const std::size_t vertex_count)
+        {
+            if (static_cast<std::size_t>(std::numeric_limits<offset_t>::max()) < edge_count) [[unlikely]]
+            {
+                auto str = ::Standard::Algorithms::Utilities::w_stream();
+                str << "Too many edges " << edge_count << " for the offset type in the CSR graph of " << vertex_count
+                    << " vertices.";
+                throw_exception(str);
+            }
+        }
+
+        inline static constexpr void check_vertex(const vertex_t &vertex, const std::size_t vertex_count)
+        {
+            if (vertex < vertex_t{} || vertex_count <= static_cast<std::size_t>(vertex)) [[unlikely]]
+            {
+                auto str = ::Standard::Algorithms::Utilities::w_stream();
+                str << "The vertex (" << vertex << ") must be inclusively between 0 and " << (vertex_count - 1U) << ".";
+                throw_exception(str);
+            }
+        }
+
+        std::vector<offset_t> Offsets;
+        std::vector<vertex_t> Targets{};
+        std::vector<weight_t> Weights{};
+    };
+} // namespace Standard::Algorithms::Graphs
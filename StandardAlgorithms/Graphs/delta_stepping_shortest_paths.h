@@ -0,0 +1,314 @@
+#pragma once
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/require_utilities.h"
+#include"adjacency_graph.h"
+#include"csr_graph.h"
+#include<atomic>
+#include<cstdint>
+#include<tuple>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    // Return true when the value has been decreased.
+    template<class weight_t>
+    [[nodiscard]] inline auto atomic_fetch_min(weight_t &value, const weight_t &cand) noexcept -> bool
+    {
+        std::atomic_ref<weight_t> ref(value);
+
+        for (auto cur = ref.load(std::memory_order_relaxed); cand < cur;)
+        {
+            if (ref.compare_exchange_weak(cur, cand, std::memory_order_relaxed))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    template<class vertex_t, class weight_t>
+    struct delta_stepping_context final
+    {
+        using graph_t = csr_graph<vertex_t, weight_t>;
+
+        // NOLINTNEXTLINE
+        weight_t delta{};
+
+        // NOLINTNEXTLINE
+        weight_t inf{};
+
+        // The distances are in [current * delta, current * delta + max weight],
+        // so a circular array of buckets is enough.
+        // NOLINTNEXTLINE
+        std::vector<std::vector<vertex_t>> buckets{};
+
+        // NOLINTNEXTLINE
+        std::size_t current{};
+
+        // Including the stale copies.
+        // NOLINTNEXTLINE
+        std::size_t pending{};
+
+        // NOLINTNEXTLINE
+        std::vector<std::vector<vertex_t>> thread_updates{};
+
+        [[nodiscard]] constexpr auto bucket_of(const weight_t &distance) const noexcept -> std::size_t
+        {
+            assert(!(distance < weight_t{}) && distance < inf);
+
+            return static_cast<std::size_t>(distance / delta);
+        }
+
+        constexpr void push(const vertex_t vertex, const weight_t &distance)
+        {
+            const auto index = bucket_of(distance);
+            assert(current <= index && index - current < buckets.size());
+
+            buckets[index % buckets.size()].push_back(vertex);
+            ++pending;
+        }
+    };
+
+    // Relax the out-going edges of the vertices in parallel, and put the improved ones into the buckets.
+    template<class vertex_t, class weight_t>
+    void delta_stepping_relax(const csr_graph<vertex_t, weight_t> &edges, const std::vector<vertex_t> &vertices,
+        std::vector<weight_t> &distances, delta_stepping_context<vertex_t, weight_t> &context)
+    {
+        constexpr std::int64_t chunk = 64;
+
+        const auto count = static_cast<std::int64_t>(vertices.size());
+        auto &thread_updates = context.thread_updates;
+
+#pragma omp parallel default(none) shared(edges, vertices, distances, thread_updates, count)
+        {
+            auto &updates = thread_updates[omp_thread_index()];
+
+#pragma omp for schedule(dynamic, chunk)
+            for (std::int64_t index = 0; index < count; ++index)
+            {
+                const auto &from = vertices[index];
+                const auto dist_from = std::atomic_ref<weight_t>(distances[from]).load(std::memory_order_relaxed);
+
+                for (const auto &edge : edges[from])
+                {
+                    const auto cand = static_cast<weight_t>(dist_from + edge.weight);
+
+                    if (atomic_fetch_min(distances[edge.vertex], cand))
+                    {
+                        updates.push_back(edge.vertex);
+                    }
+                }
+            }
+        }
+
+        for (auto &updates : thread_updates)
+        {
+            for (const auto &vertex : updates)
+            {// The same vertex might have been improved several times.
+                context.push(vertex, distances[vertex]);
+            }
+
+            updates.clear();
+        }
+    }
+
+    // Any vertex can have a parent along a tight edge: dist[from] + weight == dist[to].
+    // A parallel breadth first search over the tight edges gives a tree even with zero weight cycles.
+    template<class vertex_t, class weight_t>
+    void delta_stepping_parents(const weighted_adjacency_graph auto &graph, const vertex_t source,
+        const std::vector<weight_t> &distances, std::vector<vertex_t> &parents,
+        std::vector<std::vector<vertex_t>> &thread_updates)
+    {
+        constexpr std::int64_t chunk = 64;
+        constexpr auto absent = static_cast<vertex_t>(-1);
+
+        parents.assign(graph.size(), absent);
+        parents[source] = source;
+
+        std::vector<vertex_t> frontier{ source };
+
+        do
+        {
+            const auto count = static_cast<std::int64_t>(frontier.size());
+
+#pragma omp parallel default(none) shared(graph, distances, parents, thread_updates, frontier, count, absent)
+            {
+                auto &next = thread_updates[omp_thread_index()];
+
+#pragma omp for schedule(dynamic, chunk)
+                for (std::int64_t index = 0; index < count; ++index)
+                {
+                    const auto &from = frontier[index];
+                    const auto &dist_from = distances[from];
+
+                    for (const auto &edge : graph[from])
+                    {
+                        const auto tod = static_cast<vertex_t>(edge.vertex);
+                        if (static_cast<weight_t>(dist_from + edge.weight) != distances[tod])
+                        {
+                            continue;
+                        }
+
+                        auto expected = absent;
+
+                        if (std::atomic_ref<vertex_t>(parents[tod]).compare_exchange_strong(
+                                expected, from, std::memory_order_relaxed))
+                        {
+                            next.push_back(tod);
+                        }
+                    }
+                }
+            }
+
+            frontier.clear();
+
+            for (auto &next : thread_updates)
+            {
+                frontier.insert(frontier.end(), next.cbegin(), next.cend());
+                next.clear();
+            }
+        } while (!frontier.empty());
+
+        parents[source] = absent;
+    }
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Delta-stepping parallel single source shortest paths for non-negative weights.
+    // The vertices with the tentative distance in [i*delta, (i+1)*delta) form the bucket i.
+    // The light edges (weight <= delta) of a bucket are relaxed in parallel phases
+    // until the bucket stops changing; then its heavy edges are relaxed once.
+    // When the delta is not positive, it is chosen as the max weight divided by the average degree.
+    // Unreachable vertices have the distance "inf", and the parent -1.
+    // Work O(n + m) on average for random weights; the span depends on the delta.
+    template<std::signed_integral vertex_t, class weight_t>
+    void delta_stepping_shortest_paths(const weighted_adjacency_graph auto &graph, const vertex_t source,
+        std::vector<weight_t> &distances, std::vector<vertex_t> &parents,
+        const weight_t inf = std::numeric_limits<weight_t>::max() / 2, weight_t delta = {})
+    {
+        const auto size = require_positive(graph.size(), "graph size");
+
+        if (source < vertex_t{} || size <= static_cast<std::size_t>(source)) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The source " << source << " must be in [0, " << (size - 1U) << "].";
+            throw_exception(str);
+        }
+
+        require_positive(inf, "infinite weight");
+
+        using graph_t = csr_graph<vertex_t, weight_t>;
+        using edge_tuple_t = typename graph_t::edge_tuple_t;
+
+        weight_t max_weight{};
+        std::size_t edge_count{};
+
+        for (std::size_t from{}; from < size; ++from)
+        {
+            for (const auto &edge : graph[from])
+            {
+                if (edge.weight < weight_t{}) [[unlikely]]
+                {
+                    throw std::invalid_argument("The delta-stepping edge weights must be non-negative.");
+                }
+
+                max_weight = std::max(max_weight, static_cast<weight_t>(edge.weight));
+                ++edge_count;
+            }
+        }
+
+        if (!(weight_t{} < delta))
+        {
+            const auto average_degree = static_cast<weight_t>(std::max<std::size_t>(1U, edge_count / size));
+
+            delta = static_cast<weight_t>(max_weight / average_degree);
+
+            if constexpr (std::is_integral_v<weight_t>)
+            {
+                delta = std::max(delta, static_cast<weight_t>(1));
+            }
+            else if (!(weight_t{} < delta))
+            {
+                delta = static_cast<weight_t>(1);
+            }
+        }
+
+        std::vector<edge_tuple_t> light_list;
+        std::vector<edge_tuple_t> heavy_list;
+
+        for (std::size_t from{}; from < size; ++from)
+        {
+            for (const auto &edge : graph[from])
+            {
+                auto &list = edge.weight <= delta ? light_list : heavy_list;
+                list.emplace_back(static_cast<vertex_t>(from), static_cast<vertex_t>(edge.vertex), edge.weight);
+            }
+        }
+
+        const graph_t light(size, light_list);
+        const graph_t heavy(size, heavy_list);
+
+        light_list = {};
+        heavy_list = {};
+
+        Inner::delta_stepping_context<vertex_t, weight_t> context{ delta, inf };
+        context.buckets.resize(static_cast<std::size_t>(max_weight / delta) + 2U);
+        context.thread_updates.resize(omp_thread_count());
+
+        distances.assign(size, inf);
+        distances[source] = weight_t{};
+        context.push(source, weight_t{});
+
+        // To skip the duplicates in a phase.
+        constexpr auto none = std::numeric_limits<std::size_t>::max();
+
+        std::vector<std::size_t> light_phase_stamps(size, none);
+        std::vector<std::size_t> heavy_stamps(size, none);
+
+        std::vector<vertex_t> frontier;
+        std::vector<vertex_t> removed;
+        std::size_t phase{};
+
+        while (0U < context.pending)
+        {
+            auto &bucket = context.buckets[context.current % context.buckets.size()];
+            removed.clear();
+
+            while (!bucket.empty())
+            {
+                frontier.clear();
+                context.pending -= bucket.size();
+
+                for (const auto &vertex : bucket)
+                {
+                    if (context.bucket_of(distances[vertex]) != context.current || light_phase_stamps[vertex] == phase)
+                    {// Stale or duplicate.
+                        continue;
+                    }
+
+                    light_phase_stamps[vertex] = phase;
+                    frontier.push_back(vertex);
+
+                    if (heavy_stamps[vertex] != context.current)
+                    {
+                        heavy_stamps[vertex] = context.current;
+                        removed.push_back(vertex);
+                    }
+                }
+
+                bucket.clear();
+                ++phase;
+
+                Inner::delta_stepping_relax<vertex_t, weight_t>(light, frontier, distances, context);
+            }
+
+            Inner::delta_stepping_relax<vertex_t, weight_t>(heavy, removed, distances, context);
+
+            ++context.current;
+        }
+
+        Inner::delta_stepping_parents<vertex_t, weight_t>(graph, source, distances, parents, context.thread_updates);
+    }
+} // namespace Standard::Algorithms::Graphs
@@ -0,0 +1,138 @@
+#include"delta_stepping_shortest_paths_tests.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"delta_stepping_shortest_paths.h"
+#include"dijkstra.h"
+
+namespace
+{
+    using vertex_t = std::int32_t;
+    using weight_t = std::int64_t;
+    using graph_t = Standard::Algorithms::Graphs::graph<vertex_t, weight_t>;
+
+    constexpr auto absent_parent = Standard::Algorithms::Graphs::absent_parent;
+    constexpr weight_t infinite_weight = std::numeric_limits<weight_t>::max() / 2;
+
+    [[nodiscard]] auto random_graph(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd) -> graph_t
+    {
+        constexpr auto min_size = 2;
+        constexpr auto max_size = 200;
+        constexpr auto max_weight = 1'000;
+
+        const auto size = rnd(min_size, max_size);
+        const auto edges = rnd(0, size * 4);
+        const auto weight_limit = rnd(0, 1) == 0 ? 1 : max_weight;
+
+        graph_t graph(size);
+
+        for (std::int32_t index{}; index < edges; ++index)
+        {
+            const auto from = rnd(0, size - 1);
+            const auto tod = rnd(0, size - 1);
+
+            if (from != tod)
+            {
+                constexpr auto add_reverse_edge = false;
+
+                // Zero weights are allowed.
+                graph.add_edge(from, tod, rnd(0, weight_limit), add_reverse_edge);
+            }
+        }
+
+        return graph;
+    }
+
+    void verify_parents(const graph_t &graph, const vertex_t source, const std::vector<weight_t> &distances,
+        const std::vector<vertex_t> &parents, const std::string &name)
+    {
+        const auto size = static_cast<vertex_t>(graph.size());
+        ::Standard::Algorithms::ert::are_equal(graph.size(), parents.size(), name + " parents size");
+        ::Standard::Algorithms::ert::are_equal(absent_parent, parents[source], name + " source parent");
+
+        for (vertex_t vertex{}; vertex < size; ++vertex)
+        {
+            if (vertex == source)
+            {
+                continue;
+            }
+
+            if (distances[vertex] == infinite_weight)
+            {
+                ::Standard::Algorithms::ert::are_equal(absent_parent, parents[vertex], name + " unreachable parent");
+                continue;
+            }
+
+            // The parent chain must reach the source without a cycle.
+            auto cur = vertex;
+
+            for (vertex_t steps{}; cur != source; ++steps)
+            {
+                Standard::Algorithms::require_greater(size, steps, name + " parent chain length");
+
+                const auto &parent = parents.at(cur);
+                Standard::Algorithms::require_less_equal(0, parent, name + " parent");
+
+                const auto &edges = graph.adjacency_lists()[parent];
+                const auto has = std::any_of(edges.cbegin(), edges.cend(),
+                    [&](const auto &edge)
+                    {
+                        return edge.vertex == cur && distances[parent] + edge.weight == distances[cur];
+                    });
+
+                if (!has) [[unlikely]]
+                {
+                    throw std::runtime_error(name + " no tight edge to " + std::to_string(cur));
+                }
+
+                cur = parent;
+            }
+        }
+    }
+
+    void random_test(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd)
+    {
+        const auto graph = random_graph(rnd);
+        const auto source = rnd(0, static_cast<vertex_t>(graph.size() - 1U));
+
+        std::vector<weight_t> expected;
+        std::vector<vertex_t> parents;
+
+        Standard::Algorithms::Graphs::dijkstra_prior_que<vertex_t, weight_t>::run(
+            graph, absent_parent, infinite_weight, source, expected, parents);
+
+        // The dijkstra_prior_que has (inf - 1) for the unreachable.
+        for (auto &dist : expected)
+        {
+            if (dist == infinite_weight - 1)
+            {
+                dist = infinite_weight;
+            }
+        }
+
+        const Standard::Algorithms::Graphs::csr_graph<vertex_t, weight_t> csr(graph);
+        std::vector<weight_t> distances;
+
+        for (const weight_t delta : { 0, 1, 7, 1'000'000 })
+        {
+            const auto name = "size " + std::to_string(graph.size()) + ", delta " + std::to_string(delta);
+
+            Standard::Algorithms::Graphs::delta_stepping_shortest_paths<vertex_t, weight_t>(
+                csr, source, distances, parents, infinite_weight, delta);
+
+            ::Standard::Algorithms::ert::are_equal(expected, distances, name + " distances");
+            verify_parents(graph, source, distances, parents, name);
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Tests::delta_stepping_shortest_paths_tests()
+{
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+    constexpr auto steps = 20;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        random_test(rnd);
+    }
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Graphs::Tests
+{
+    void delta_stepping_shortest_paths_tests();
+}
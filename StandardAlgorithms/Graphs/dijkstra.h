@@ -1,5 +1,7 @@
 #pragma once
 #include"../Utilities/is_debug.h"
+#include"adjacency_graph.h"
+#include"csr_graph.h"
 #include"graph.h"
 #include"priority_queue_molodetz.h"
 #include<set>
@@ -38,7 +40,7 @@ namespace Standard::Algorithms::Graphs
     constexpr auto absent_parent = -1;
 
     // Time O(n+m*log(n)) - suitable for a sparse graph.
-    template<class graph_t, class weight_t>
+    template<weighted_adjacency_graph graph_t, class weight_t>
     constexpr void dijkstra_sparse(const graph_t &graph, const std::int32_t source, std::vector<weight_t> &distances,
         std::vector<std::int32_t> &parents, std::set<std::pair<weight_t, std::int32_t>> &dist_vertex_temp,
         const weight_t &inf = std::numeric_limits<weight_t>::max() / 2)
@@ -93,7 +95,7 @@ namespace Standard::Algorithms::Graphs
     }
 
     // Time O(n*n) - good for a dense graph.
-    template<class graph_t, class weight_t>
+    template<weighted_adjacency_graph graph_t, class weight_t>
     constexpr void dijkstra_dense(const graph_t &graph, std::vector<bool> &processed, std::int32_t source,
         std::vector<weight_t> &distances, std::vector<std::int32_t> &parents,
         const weight_t &inf = std::numeric_limits<weight_t>::max() / 2)
@@ -173,11 +175,29 @@ namespace Standard::Algorithms::Graphs
             const vertex_t source_vertex,
             // Returned minimum distances from "sourceVertex" to given vertex.
             std::vector<weight_t> &distances, std::vector<vertex_t> &parent_vertices)
+        {
+            run_on_adjacency<is_small_size>(
+                graph.adjacency_lists(), absent_parent, infinite_weight, source_vertex, distances, parent_vertices);
+        }
+
+        template<bool is_small_size = false, std::unsigned_integral offset_t>
+        static constexpr void run(const csr_graph<vertex_t, weight_t, offset_t> &graph, const vertex_t &absent_parent,
+            const weight_t infinite_weight, const vertex_t source_vertex, std::vector<weight_t> &distances,
+            std::vector<vertex_t> &parent_vertices)
+        {
+            run_on_adjacency<is_small_size>(
+                graph, absent_parent, infinite_weight, source_vertex, distances, parent_vertices);
+        }
+
+        // Any weighted adjacency graph e.g. a csr_graph, or std::vector<std::vector<edge_t>>.
+        template<bool is_small_size = false>
+        static constexpr void run_on_adjacency(const weighted_adjacency_graph auto &adjacency_lists,
+            const vertex_t &absent_parent, const weight_t infinite_weight, const vertex_t source_vertex,
+            std::vector<weight_t> &distances, std::vector<vertex_t> &parent_vertices)
         {
             require_positive(infinite_weight, "infiniteWeight");
             require_positive(infinite_weight - 1, "infiniteWeight - 1");
 
-            const auto &adjacency_lists = graph.adjacency_lists();
             const auto vertex_count = adjacency_lists.size();
             if (vertex_count < 2U) [[unlikely]]
             {
@@ -212,13 +232,10 @@ namespace Standard::Algorithms::Graphs
                 que.pop();
 
                 const auto &adjacency_list = adjacency_lists[top.vertex];
-                const auto adjacency_list_size = adjacency_list.size();
                 const auto top_distance = distances[top.vertex];
 
-                for (std::size_t index{}; index < adjacency_list_size; ++index)
+                for (const auto &vertex2 : adjacency_list)
                 {
-                    const auto &vertex2 = adjacency_list[index];
-
                     const auto new_distance = static_cast<weight_t>(top_distance + vertex2.weight);
 
                     auto &dist = distances[vertex2.vertex];
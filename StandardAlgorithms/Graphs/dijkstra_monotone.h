@@ -0,0 +1,178 @@
+#pragma once
+#include"adjacency_graph.h"
+#include"bucket_queue.h"
+#include"dijkstra.h"
+#include"radix_heap.h"
+#include<type_traits>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    template<class vertex_t, std::integral weight_t>
+    constexpr void dijkstra_monotone_check(const std::size_t vertex_count, const weight_t infinite_weight,
+        const vertex_t source_vertex, const vertex_t &absent_parent, std::vector<weight_t> &distances,
+        std::vector<vertex_t> &parent_vertices)
+    {
+        require_positive(infinite_weight, "infiniteWeight");
+        require_positive(infinite_weight - 1, "infiniteWeight - 1");
+
+        if (vertex_count < 2U) [[unlikely]]
+        {
+            throw std::runtime_error("The graph must have at least 2 vertices.");
+        }
+
+        if (source_vertex < vertex_t{} || vertex_count <= static_cast<std::size_t>(source_vertex)) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The sourceVertex " << source_vertex << " must be in [0, " << (vertex_count - 1U) << "].";
+            throw_exception(str);
+        }
+
+        distances.assign(vertex_count, infinite_weight - 1);
+        parent_vertices.assign(vertex_count, absent_parent);
+
+        distances[source_vertex] = {};
+    }
+
+    // Only the reached vertices are pushed, maybe several times - the stale ones are skipped.
+    template<class vertex_t, std::integral weight_t, class que_t>
+    constexpr void dijkstra_monotone_lazy(const weighted_adjacency_graph auto &adjacency_lists, que_t &que,
+        const vertex_t source_vertex, std::vector<weight_t> &distances, std::vector<vertex_t> &parent_vertices)
+    {
+        using key_t = typename que_t::key_t;
+
+        que.push(key_t{}, source_vertex);
+
+        do
+        {
+            const auto [top_key, top_vertex] = que.pop();
+            const auto top_distance = distances[top_vertex];
+
+            if (static_cast<key_t>(top_distance) != top_key)
+            {// A stale copy - the vertex has been reached by a shorter path.
+                assert(top_distance < static_cast<weight_t>(top_key));
+                continue;
+            }
+
+            const auto &adjacency_list = adjacency_lists[top_vertex];
+
+            for (const auto &vertex2 : adjacency_list)
+            {
+                if (vertex2.weight < weight_t{}) [[unlikely]]
+                {
+                    auto str = ::Standard::Algorithms::Utilities::w_stream();
+                    str << "The edge weight " << vertex2.weight << " from " << top_vertex << " to " << vertex2.vertex
+                        << " must be non-negative.";
+                    throw_exception(str);
+                }
+
+                const auto new_distance = static_cast<weight_t>(top_distance + vertex2.weight);
+
+                auto &dist = distances[vertex2.vertex];
+                if (!(new_distance < dist))
+                {
+                    continue;
+                }
+
+                dist = new_distance;
+                parent_vertices[vertex2.vertex] = top_vertex;
+                que.push(static_cast<key_t>(new_distance), static_cast<vertex_t>(vertex2.vertex));
+            }
+        } while (!que.is_empty());
+    }
+
+    [[nodiscard]] constexpr auto max_edge_weight(const weighted_adjacency_graph auto &adjacency_lists)
+    {
+        using weight_t = std::remove_cvref_t<decltype(adjacency_lists[0][0].weight)>;
+
+        weight_t result{};
+
+        for (std::size_t from{}; from < adjacency_lists.size(); ++from)
+        {
+            for (const auto &edge : adjacency_lists[from])
+            {
+                result = std::max(result, edge.weight);
+            }
+        }
+
+        return result;
+    }
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Dijkstra's algorithm for non-negative integer weights using a radix heap.
+    // Unlike dijkstra_prior_que, only the reached vertices are in the heap.
+    // Time O(m + n*log(C)), where C is the max edge weight.
+    template<class vertex_t, std::integral weight_t>
+    struct dijkstra_radix_heap final
+    {
+        dijkstra_radix_heap() = delete;
+
+        static constexpr void run(const graph<vertex_t, weight_t> &graph, const vertex_t &absent_parent,
+            const weight_t infinite_weight, const vertex_t source_vertex, std::vector<weight_t> &distances,
+            std::vector<vertex_t> &parent_vertices)
+        {
+            run(graph.adjacency_lists(), absent_parent, infinite_weight, source_vertex, distances, parent_vertices);
+        }
+
+        // Any weighted adjacency graph e.g. a csr_graph, or std::vector<std::vector<edge_t>>.
+        static constexpr void run(const weighted_adjacency_graph auto &adjacency_lists, const vertex_t &absent_parent,
+            const weight_t infinite_weight, const vertex_t source_vertex, std::vector<weight_t> &distances,
+            std::vector<vertex_t> &parent_vertices)
+        {
+            Inner::dijkstra_monotone_check<vertex_t, weight_t>(adjacency_lists.size(), infinite_weight, source_vertex,
+                absent_parent, distances, parent_vertices);
+
+            ::Standard::Algorithms::Heaps::radix_heap<std::make_unsigned_t<weight_t>, vertex_t> que{};
+
+            Inner::dijkstra_monotone_lazy<vertex_t, weight_t>(
+                adjacency_lists, que, source_vertex, distances, parent_vertices);
+        }
+
+        static constexpr void find_path(const vertex_t &absent_parent, const std::vector<vertex_t> &parent_vertices,
+            const vertex_t target_vertex, std::vector<vertex_t> &path)
+        {
+            dijkstra_prior_que<vertex_t, weight_t>::find_path(absent_parent, parent_vertices, target_vertex, path);
+        }
+    };
+
+    // Dial's algorithm for small non-negative integer weights using (C + 1) buckets,
+    // where C is the max edge weight.
+    // Time O(m + n*C) in the worst case, and often O(m + D) where D is the max distance.
+    template<class vertex_t, std::integral weight_t>
+    struct dijkstra_dial final
+    {
+        dijkstra_dial() = delete;
+
+        static constexpr void run(const graph<vertex_t, weight_t> &graph, const vertex_t &absent_parent,
+            const weight_t infinite_weight, const vertex_t source_vertex, std::vector<weight_t> &distances,
+            std::vector<vertex_t> &parent_vertices)
+        {
+            run(graph.adjacency_lists(), absent_parent, infinite_weight, source_vertex, distances, parent_vertices);
+        }
+
+        // Any weighted adjacency graph e.g. a csr_graph, or std::vector<std::vector<edge_t>>.
+        static constexpr void run(const weighted_adjacency_graph auto &adjacency_lists, const vertex_t &absent_parent,
+            const weight_t infinite_weight, const vertex_t source_vertex, std::vector<weight_t> &distances,
+            std::vector<vertex_t> &parent_vertices)
+        {
+            Inner::dijkstra_monotone_check<vertex_t, weight_t>(adjacency_lists.size(), infinite_weight, source_vertex,
+                absent_parent, distances, parent_vertices);
+
+            using key_t = std::make_unsigned_t<weight_t>;
+
+            const auto max_weight = static_cast<weight_t>(Inner::max_edge_weight(adjacency_lists));
+
+            ::Standard::Algorithms::Heaps::bucket_queue<key_t, vertex_t> que(static_cast<key_t>(max_weight));
+
+            Inner::dijkstra_monotone_lazy<vertex_t, weight_t>(
+                adjacency_lists, que, source_vertex, distances, parent_vertices);
+        }
+
+        static constexpr void find_path(const vertex_t &absent_parent, const std::vector<vertex_t> &parent_vertices,
+            const vertex_t target_vertex, std::vector<vertex_t> &path)
+        {
+            dijkstra_prior_que<vertex_t, weight_t>::find_path(absent_parent, parent_vertices, target_vertex, path);
+        }
+    };
+} // namespace Standard::Algorithms::Graphs
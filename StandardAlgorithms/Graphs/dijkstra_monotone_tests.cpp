@@ -0,0 +1,189 @@
+#include"dijkstra_monotone_tests.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"csr_graph.h"
+#include"dijkstra_monotone.h"
+#include<algorithm>
+#include<set>
+
+namespace
+{
+    using vertex_t = std::int32_t;
+    using weight_t = std::int64_t;
+    using graph_t = Standard::Algorithms::Graphs::graph<vertex_t, weight_t>;
+
+    constexpr auto absent_parent = Standard::Algorithms::Graphs::absent_parent;
+    constexpr weight_t infinite_weight = std::numeric_limits<weight_t>::max() / 2;
+
+    // Pop the keys in the same order as a multiset does.
+    void monotone_queue_test(auto &que, const std::uint32_t max_span, const std::string &name)
+    {
+        constexpr auto steps = 500;
+
+        Standard::Algorithms::Utilities::random_t<std::uint32_t> rnd{};
+        std::multiset<std::uint32_t> expected;
+        std::uint32_t last{};
+
+        for (std::int32_t step{}; step < steps; ++step)
+        {
+            const auto push_count = rnd(0U, 3U);
+
+            for (std::uint32_t index{}; index < push_count; ++index)
+            {
+                const auto key = rnd(last, last + max_span);
+                que.push(key, step);
+                expected.insert(key);
+            }
+
+            ::Standard::Algorithms::ert::are_equal(expected.size(), que.size(), name + " size");
+
+            if (expected.empty())
+            {
+                continue;
+            }
+
+            const auto top = que.pop().first;
+            ::Standard::Algorithms::ert::are_equal(*expected.cbegin(), top, name + " top");
+
+            expected.erase(expected.cbegin());
+            last = top;
+        }
+    }
+
+    [[nodiscard]] auto random_graph(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd,
+        const weight_t max_weight) -> graph_t
+    {
+        constexpr auto min_size = 2;
+        constexpr auto max_size = 40;
+
+        const auto size = rnd(min_size, max_size);
+        const auto edges = rnd(0, size * 3);
+
+        graph_t graph(size);
+
+        for (std::int32_t index{}; index < edges; ++index)
+        {
+            const auto from = rnd(0, size - 1);
+            const auto tod = rnd(0, size - 1);
+
+            if (from != tod)
+            {
+                constexpr auto add_reverse_edge = false;
+
+                graph.add_edge(from, tod, rnd(0, static_cast<std::int32_t>(max_weight)), add_reverse_edge);
+            }
+        }
+
+        return graph;
+    }
+
+    void verify_parents(const graph_t &graph, const std::vector<weight_t> &distances,
+        const std::vector<vertex_t> &parents, const std::string &name)
+    {
+        for (vertex_t tod{}; static_cast<std::size_t>(tod) < graph.size(); ++tod)
+        {
+            const auto &parent = parents.at(tod);
+            if (parent == absent_parent)
+            {
+                continue;
+            }
+
+            const auto &edges = graph.adjacency_lists().at(parent);
+            const auto has = std::any_of(edges.cbegin(), edges.cend(),
+                [&](const auto &edge)
+                {
+                    return edge.vertex == tod && distances.at(parent) + edge.weight == distances.at(tod);
+                });
+
+            if (!has) [[unlikely]]
+            {
+                throw std::runtime_error(name + " no shortest edge from parent to " + std::to_string(tod));
+            }
+        }
+    }
+
+    void dijkstra_random_test(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd, const weight_t max_weight)
+    {
+        const auto graph = random_graph(rnd, max_weight);
+        const auto source_vertex = rnd(0, static_cast<vertex_t>(graph.size() - 1U));
+        const auto name = "max weight " + std::to_string(max_weight) + ", size " + std::to_string(graph.size()) + " ";
+
+        std::vector<weight_t> expected_distances;
+        std::vector<vertex_t> parents;
+
+        Standard::Algorithms::Graphs::dijkstra_prior_que<vertex_t, weight_t>::run(
+            graph, absent_parent, infinite_weight, source_vertex, expected_distances, parents);
+
+        const Standard::Algorithms::Graphs::csr_graph<vertex_t, weight_t, std::uint32_t> csr(graph);
+
+        std::vector<weight_t> distances;
+
+        const auto check = [&](const std::string &sub_name)
+        {
+            ::Standard::Algorithms::ert::are_equal(expected_distances, distances, name + sub_name + " distances");
+            verify_parents(graph, distances, parents, name + sub_name);
+        };
+
+        Standard::Algorithms::Graphs::dijkstra_radix_heap<vertex_t, weight_t>::run(
+            graph, absent_parent, infinite_weight, source_vertex, distances, parents);
+        check("dijkstra_radix_heap");
+
+        Standard::Algorithms::Graphs::dijkstra_radix_heap<vertex_t, weight_t>::run(
+            csr, absent_parent, infinite_weight, source_vertex, distances, parents);
+        check("csr dijkstra_radix_heap");
+
+        Standard::Algorithms::Graphs::dijkstra_dial<vertex_t, weight_t>::run(
+            graph, absent_parent, infinite_weight, source_vertex, distances, parents);
+        check("dijkstra_dial");
+
+        Standard::Algorithms::Graphs::dijkstra_dial<vertex_t, weight_t>::run(
+            csr, absent_parent, infinite_weight, source_vertex, distances, parents);
+        check("csr dijkstra_dial");
+
+        std::vector<vertex_t> path;
+
+        for (vertex_t target{}; static_cast<std::size_t>(target) < graph.size(); ++target)
+        {
+            Standard::Algorithms::Graphs::dijkstra_dial<vertex_t, weight_t>::find_path(
+                absent_parent, parents, target, path);
+
+            if (target == source_vertex)
+            {
+                ::Standard::Algorithms::ert::are_equal(1U, path.size(), name + "source path size");
+            }
+            else if (parents[target] != absent_parent)
+            {
+                ::Standard::Algorithms::ert::are_equal(source_vertex, path.at(0), name + "path start");
+                ::Standard::Algorithms::ert::are_equal(target, path.back(), name + "path end");
+            }
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Tests::dijkstra_monotone_tests()
+{
+    {
+        constexpr auto max_span = 1'000'000U;
+
+        Standard::Algorithms::Heaps::radix_heap<std::uint32_t, std::int32_t> heap{};
+        monotone_queue_test(heap, max_span, "radix_heap");
+    }
+    {
+        constexpr auto max_span = 100U;
+
+        Standard::Algorithms::Heaps::bucket_queue<std::uint32_t, std::int32_t> buckets(max_span);
+        monotone_queue_test(buckets, max_span, "bucket_queue");
+    }
+
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+    constexpr auto steps = 20;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        for (const weight_t max_weight : { 0, 1, 10, 1'000'000 })
+        {
+            dijkstra_random_test(rnd, max_weight);
+        }
+    }
+}
@@ -0,0 +1,333 @@
+#pragma once
+#include"../Geometry/point.h"
+#include"../Geometry/point_utilities.h"
+#include"adjacency_graph.h"
+#include"dijkstra.h"
+#include<cmath>
+#include<functional>
+#include<queue>
+#include<tuple>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // Return the reversed digraph for the backward search in the bidirectional Dijkstra.
+    // An undirected graph is its own reverse.
+    template<class vertex_t, class weight_t>
+    [[nodiscard]] constexpr auto reverse_adjacency_lists(const weighted_adjacency_graph auto &graph)
+        -> std::vector<std::vector<weighted_vertex<vertex_t, weight_t>>>
+    {
+        const auto size = graph.size();
+
+        std::vector<std::vector<weighted_vertex<vertex_t, weight_t>>> reversed(size);
+
+        for (std::size_t from{}; from < size; ++from)
+        {
+            for (const auto &edge : graph[from])
+            {
+                reversed.at(edge.vertex).emplace_back(static_cast<vertex_t>(from), edge.weight);
+            }
+        }
+
+        return reversed;
+    }
+
+    // The straight line distance to the target is admissible
+    // when each edge weight is at least the Euclidean distance between its ends.
+    template<class weight_t, class distance_t>
+    [[nodiscard]] constexpr auto euclidean_heuristic(
+        const std::vector<Geometry::point2d<distance_t>> &points, const std::size_t target)
+    {
+        return [&points, target_point = points.at(target)] [[nodiscard]] (const std::size_t vertex) -> weight_t
+        {
+            assert(vertex < points.size());
+
+            const auto squared = Geometry::dist2<long double>(points[vertex] - target_point);
+            const auto root = std::sqrt(squared);
+
+            if constexpr (std::is_integral_v<weight_t>)
+            {// Round down not to overestimate.
+                return static_cast<weight_t>(std::floor(root));
+            }
+            else
+            {
+                return static_cast<weight_t>(root);
+            }
+        };
+    }
+
+    // Single pair shortest path queries for a non-negative weight graph.
+    // Only the touched vertices are reset between the queries,
+    // so a query costs as much as the number of the visited vertices, not the graph size.
+    template<class vertex_t, class weight_t>
+    struct dijkstra_point_to_point final
+    {
+        constexpr dijkstra_point_to_point(const std::size_t vertex_count, const weight_t &infinite_weight)
+            : Infinite_weight(require_positive(infinite_weight, "infinite weight"))
+            , Forward(require_positive(vertex_count, "vertex count"), infinite_weight)
+            , Backward(vertex_count, infinite_weight)
+        {
+        }
+
+        [[nodiscard]] constexpr auto infinite_weight() const noexcept -> const weight_t &
+        {
+            return Infinite_weight;
+        }
+
+        // Stop as soon as the target is settled.
+        // Return the distance, or the infinite weight and an empty path when the target is not reachable.
+        constexpr auto early_exit(const weighted_adjacency_graph auto &graph, const vertex_t source,
+            const vertex_t target, std::vector<vertex_t> &path) -> weight_t
+        {
+            return a_star(
+                graph,
+                [] [[nodiscard]] (const std::size_t) noexcept
+                {
+                    return weight_t{};
+                },
+                source, target, path);
+        }
+
+        // The heuristic(vertex) estimates the distance from vertex to the target.
+        // It must never overestimate e.g. euclidean_heuristic.
+        // A vertex may be expanded more than once when the heuristic is admissible, but not consistent.
+        template<class heuristic_t>
+        constexpr auto a_star(const weighted_adjacency_graph auto &graph, const heuristic_t &heuristic,
+            const vertex_t source, const vertex_t target, std::vector<vertex_t> &path) -> weight_t
+        {
+            check_query(graph.size(), source, target);
+            path.clear();
+            reset(Forward);
+
+            relax(Forward, source, weight_t{}, absent_vertex(), heuristic(static_cast<std::size_t>(source)));
+
+            while (!Forward.heap.empty())
+            {
+                const auto [estimate, dist_from, from] = Forward.heap.top();
+                Forward.heap.pop();
+
+                if (dist_from != Forward.distances[from])
+                {// Stale.
+                    continue;
+                }
+
+                if (from == target)
+                {
+                    restore_forward(target, path);
+                    return dist_from;
+                }
+
+                for (const auto &edge : graph[from])
+                {
+                    assert(!(edge.weight < weight_t{}));
+
+                    const auto tod = static_cast<vertex_t>(edge.vertex);
+                    const auto cand = static_cast<weight_t>(dist_from + edge.weight);
+
+                    if (cand < Forward.distances[tod])
+                    {
+                        relax(Forward, tod, cand, from,
+                            static_cast<weight_t>(cand + heuristic(static_cast<std::size_t>(tod))));
+                    }
+                }
+            }
+
+            return Infinite_weight;
+        }
+
+        // Search from both ends, the backward search runs on the reversed graph.
+        // Stop when the sum of the two smallest keys is not less than the best path found so far.
+        constexpr auto bidirectional(const weighted_adjacency_graph auto &graph,
+            const weighted_adjacency_graph auto &reversed_graph, const vertex_t source, const vertex_t target,
+            std::vector<vertex_t> &path) -> weight_t
+        {
+            check_query(graph.size(), source, target);
+            require_equal(graph.size(), "graph size", reversed_graph.size());
+
+            path.clear();
+            reset(Forward);
+            reset(Backward);
+
+            relax(Forward, source, weight_t{}, absent_vertex(), weight_t{});
+            relax(Backward, target, weight_t{}, absent_vertex(), weight_t{});
+
+            auto best = Infinite_weight;
+            auto meeting = absent_vertex();
+
+            if (source == target)
+            {
+                best = weight_t{};
+                meeting = source;
+            }
+
+            for (;;)
+            {
+                skip_stale(Forward);
+                skip_stale(Backward);
+
+                if (Forward.heap.empty() || Backward.heap.empty())
+                {
+                    break;
+                }
+
+                const auto &forward_top = std::get<0>(Forward.heap.top());
+                const auto &backward_top = std::get<0>(Backward.heap.top());
+
+                if (!(forward_top + backward_top < best))
+                {
+                    break;
+                }
+
+                if (forward_top <= backward_top)
+                {
+                    expand(graph, Forward, Backward, best, meeting);
+                }
+                else
+                {
+                    expand(reversed_graph, Backward, Forward, best, meeting);
+                }
+            }
+
+            if (meeting == absent_vertex())
+            {
+                return Infinite_weight;
+            }
+
+            restore_forward(meeting, path);
+
+            for (auto vertex = Backward.parents[meeting]; vertex != absent_vertex(); vertex = Backward.parents[vertex])
+            {
+                path.push_back(vertex);
+            }
+
+            return best;
+        }
+
+private:
+        // Estimate or key, distance, vertex.
+        using heap_item_t = std::tuple<weight_t, weight_t, vertex_t>;
+
+        struct search_side final
+        {
+            constexpr search_side(const std::size_t vertex_count, const weight_t &infinite_weight)
+                : distances(vertex_count, infinite_weight)
+                , parents(vertex_count, absent_vertex())
+            {
+            }
+
+            // NOLINTNEXTLINE
+            std::vector<weight_t> distances;
+
+            // NOLINTNEXTLINE
+            std::vector<vertex_t> parents;
+
+            // NOLINTNEXTLINE
+            std::vector<vertex_t> touched{};
+
+            // NOLINTNEXTLINE
+            std::priority_queue<heap_item_t, std::vector<heap_item_t>, std::greater<>> heap{};
+        };
+
+        [[nodiscard]] static constexpr auto absent_vertex() noexcept -> vertex_t
+        {
+            return static_cast<vertex_t>(absent_parent);
+        }
+
+        constexpr void check_query(const std::size_t size, const vertex_t source, const vertex_t target) const
+        {
+            require_equal(Forward.distances.size(), "vertex count", size);
+
+            for (const auto &vertex : { source, target })
+            {
+                if (vertex < vertex_t{} || size <= static_cast<std::size_t>(vertex)) [[unlikely]]
+                {
+                    auto str = ::Standard::Algorithms::Utilities::w_stream();
+                    str << "The vertex " << vertex << " must be in [0, " << (size - 1U) << "].";
+                    throw_exception(str);
+                }
+            }
+        }
+
+        constexpr void reset(search_side &side) const
+        {
+            for (const auto &vertex : side.touched)
+            {
+                side.distances[vertex] = Infinite_weight;
+                side.parents[vertex] = absent_vertex();
+            }
+
+            side.touched.clear();
+            side.heap = {};
+        }
+
+        constexpr void relax(search_side &side, const vertex_t vertex, const weight_t &distance, const vertex_t parent,
+            const weight_t &key) const
+        {
+            auto &dist = side.distances[vertex];
+            if (dist == Infinite_weight)
+            {
+                side.touched.push_back(vertex);
+            }
+
+            dist = distance;
+            side.parents[vertex] = parent;
+            side.heap.emplace(key, distance, vertex);
+        }
+
+        static constexpr void skip_stale(search_side &side)
+        {
+            while (!side.heap.empty())
+            {
+                const auto &[key, dist, vertex] = side.heap.top();
+                if (dist == side.distances[vertex])
+                {
+                    return;
+                }
+
+                side.heap.pop();
+            }
+        }
+
+        constexpr void expand(const auto &graph, search_side &side, const search_side &other, weight_t &best,
+            vertex_t &meeting) const
+        {
+            const auto from = std::get<2>(side.heap.top());
+            side.heap.pop();
+
+            const auto dist_from = side.distances[from];
+
+            for (const auto &edge : graph[from])
+            {
+                assert(!(edge.weight < weight_t{}));
+
+                const auto tod = static_cast<vertex_t>(edge.vertex);
+                const auto cand = static_cast<weight_t>(dist_from + edge.weight);
+
+                if (!(cand < side.distances[tod]))
+                {
+                    continue;
+                }
+
+                relax(side, tod, cand, from, cand);
+
+                if (const auto &other_dist = other.distances[tod]; other_dist != Infinite_weight)
+                {
+                    if (const auto total = static_cast<weight_t>(cand + other_dist); total < best)
+                    {
+                        best = total;
+                        meeting = tod;
+                    }
+                }
+            }
+        }
+
+        constexpr void restore_forward(const vertex_t last, std::vector<vertex_t> &path) const
+        {
+            dijkstra_prior_que<vertex_t, weight_t>::find_path(absent_vertex(), Forward.parents, last, path);
+        }
+
+        weight_t Infinite_weight;
+        search_side Forward;
+        search_side Backward;
+    };
+} // namespace Standard::Algorithms::Graphs
@@ -0,0 +1,155 @@
+#include"dijkstra_point_to_point_tests.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"csr_graph.h"
+#include"dijkstra_point_to_point.h"
+
+namespace
+{
+    using vertex_t = std::int32_t;
+    using weight_t = std::int64_t;
+    using point_t = Standard::Algorithms::Geometry::point2d<std::int32_t>;
+    using graph_t = Standard::Algorithms::Graphs::graph<vertex_t, weight_t>;
+
+    constexpr auto absent_parent = Standard::Algorithms::Graphs::absent_parent;
+    constexpr weight_t infinite_weight = std::numeric_limits<weight_t>::max() / 2;
+
+    // The edge weights are not less than the Euclidean distances to have an admissible heuristic.
+    [[nodiscard]] auto random_geometric_digraph(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd,
+        std::vector<point_t> &points) -> graph_t
+    {
+        constexpr auto min_size = 2;
+        constexpr auto max_size = 30;
+        constexpr auto max_coordinate = 100;
+        constexpr auto max_extra = 20;
+
+        const auto size = rnd(min_size, max_size);
+
+        points.resize(size);
+
+        for (auto &point : points)
+        {
+            point = { rnd(0, max_coordinate), rnd(0, max_coordinate) };
+        }
+
+        graph_t graph(size);
+
+        const auto edges = rnd(0, size * 3);
+
+        for (std::int32_t index{}; index < edges; ++index)
+        {
+            const auto from = rnd(0, size - 1);
+            const auto tod = rnd(0, size - 1);
+
+            if (from == tod)
+            {
+                continue;
+            }
+
+            const auto squared = Standard::Algorithms::Geometry::dist2<long double>(points[from] - points[tod]);
+            const auto weight = static_cast<weight_t>(std::ceil(std::sqrt(squared))) + rnd(0, max_extra);
+
+            constexpr auto add_reverse_edge = false;
+
+            graph.add_edge(from, tod, weight, add_reverse_edge);
+        }
+
+        return graph;
+    }
+
+    void verify_path(const graph_t &graph, const vertex_t source, const vertex_t target,
+        const std::vector<vertex_t> &path, const weight_t &expected, const std::string &name)
+    {
+        if (expected == infinite_weight - 1)
+        {// Not reachable.
+            ::Standard::Algorithms::ert::are_equal(0U, path.size(), name + " empty path");
+            return;
+        }
+
+        Standard::Algorithms::require_positive(path.size(), name + " path size");
+        ::Standard::Algorithms::ert::are_equal(source, path.front(), name + " path front");
+        ::Standard::Algorithms::ert::are_equal(target, path.back(), name + " path back");
+
+        weight_t sum{};
+
+        for (std::size_t index = 1; index < path.size(); ++index)
+        {
+            const auto &edges = graph.adjacency_lists().at(path[index - 1U]);
+            auto weight = infinite_weight;
+
+            for (const auto &edge : edges)
+            {
+                if (edge.vertex == path[index])
+                {
+                    weight = std::min(weight, edge.weight);
+                }
+            }
+
+            Standard::Algorithms::require_greater(infinite_weight, weight, name + " path edge");
+            sum += weight;
+        }
+
+        ::Standard::Algorithms::ert::are_equal(expected, sum, name + " path weight");
+    }
+
+    void random_test(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd)
+    {
+        std::vector<point_t> points;
+        const auto graph = random_geometric_digraph(rnd, points);
+        const auto size = static_cast<vertex_t>(graph.size());
+
+        const Standard::Algorithms::Graphs::csr_graph<vertex_t, weight_t> csr(graph);
+        const auto reversed =
+            Standard::Algorithms::Graphs::reverse_adjacency_lists<vertex_t, weight_t>(graph.adjacency_lists());
+
+        Standard::Algorithms::Graphs::dijkstra_point_to_point<vertex_t, weight_t> searcher(
+            graph.size(), infinite_weight);
+
+        std::vector<weight_t> distances;
+        std::vector<vertex_t> parents;
+        std::vector<vertex_t> path;
+
+        for (vertex_t source{}; source < size; ++source)
+        {
+            Standard::Algorithms::Graphs::dijkstra_prior_que<vertex_t, weight_t>::run(
+                graph, absent_parent, infinite_weight, source, distances, parents);
+
+            for (vertex_t target{}; target < size; ++target)
+            {
+                const auto name = "source " + std::to_string(source) + ", target " + std::to_string(target);
+                const auto &expected = distances[target];
+                const auto expected_result = expected == infinite_weight - 1 ? infinite_weight : expected;
+
+                {
+                    const auto actual = searcher.early_exit(graph.adjacency_lists(), source, target, path);
+                    ::Standard::Algorithms::ert::are_equal(expected_result, actual, name + " early_exit");
+                    verify_path(graph, source, target, path, expected, name + " early_exit");
+                }
+                {
+                    const auto actual = searcher.bidirectional(csr, reversed, source, target, path);
+                    ::Standard::Algorithms::ert::are_equal(expected_result, actual, name + " bidirectional");
+                    verify_path(graph, source, target, path, expected, name + " bidirectional");
+                }
+                {
+                    const auto heuristic = Standard::Algorithms::Graphs::euclidean_heuristic<weight_t>(points, target);
+
+                    const auto actual = searcher.a_star(csr, heuristic, source, target, path);
+                    ::Standard::Algorithms::ert::are_equal(expected_result, actual, name + " a_star");
+                    verify_path(graph, source, target, path, expected, name + " a_star");
+                }
+            }
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Tests::dijkstra_point_to_point_tests()
+{
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+    constexpr auto steps = 10;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        random_test(rnd);
+    }
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Graphs::Tests
+{
+    void dijkstra_point_to_point_tests();
+}
@@ -1,6 +1,7 @@
 #include"dijkstra_tests.h"
 #include"../Utilities/ert.h"
 #include"bellman_ford_shortest_paths.h"
+#include"csr_graph.h"
 #include"dijkstra.h"
 #include"shortest_path_linear_programming.h"
 #include<array>
@@ -266,6 +267,82 @@ namespace
         ::Standard::Algorithms::ert::are_equal(
             expected_path.data(), expected_path.size(), path, "path in dijkstra_prior_que find_path.");
     }
+
+    // The same algorithms must work on the compressed sparse row graph.
+    constexpr void run_csr_subtest(const auto &graph, const auto &expected_min_weights, const auto &expected_parents)
+    {
+        const Standard::Algorithms::Graphs::csr_graph<std::int32_t, weight_t> csr(graph);
+
+        ::Standard::Algorithms::ert::are_equal(graph.size(), csr.size(), "csr size");
+
+        for (std::size_t from{}; from < graph.size(); ++from)
+        {
+            const auto &edges = graph.adjacency_lists()[from];
+            const auto csr_edges = csr.at(from);
+            const std::vector<typename decltype(csr_edges)::value_type> actual(csr_edges.begin(), csr_edges.end());
+
+            ::Standard::Algorithms::ert::are_equal(edges, actual, "csr edges from " + std::to_string(from));
+        }
+
+        std::vector<weight_t> distances;
+        std::vector<std::int32_t> parents;
+        std::vector<bool> used;
+
+        Standard::Algorithms::Graphs::dijkstra_prior_que<std::int32_t, weight_t>::run(
+            csr, absent_parent, infinite_weight, source_vertex, distances, parents);
+
+        ::Standard::Algorithms::ert::are_equal(
+            expected_parents.data(), vertex_count, parents, "parents in csr dijkstra_prior_que.");
+        ::Standard::Algorithms::ert::are_equal(
+            expected_min_weights.data(), vertex_count, distances, "distances in csr dijkstra_prior_que.");
+        {
+            std::set<std::pair<weight_t, std::int32_t>> dist_vertex_temp;
+
+            Standard::Algorithms::Graphs::dijkstra_sparse(
+                csr, source_vertex, distances, parents, dist_vertex_temp, infinite_weight);
+
+            ::Standard::Algorithms::ert::are_equal(
+                expected_min_weights.data(), vertex_count, distances, "distances in csr dijkstra_sparse.");
+            ::Standard::Algorithms::ert::are_equal(
+                expected_parents.data(), vertex_count, parents, "parents in csr dijkstra_sparse.");
+        }
+        {
+            Standard::Algorithms::Graphs::dijkstra_dense(csr, used, source_vertex, distances, parents, infinite_weight);
+
+            ::Standard::Algorithms::ert::are_equal(
+                expected_min_weights.data(), vertex_count, distances, "distances in csr dijkstra_dense.");
+            ::Standard::Algorithms::ert::are_equal(
+                expected_parents.data(), vertex_count, parents, "parents in csr dijkstra_dense.");
+        }
+        {
+            std::deque<std::int32_t> temp;
+            std::deque<std::int32_t> temp2;
+
+            const auto actual = Standard::Algorithms::Graphs::bellman_ford_shortest_paths_fast(
+                csr, source_vertex, distances, parents, temp, temp2, used, infinite_weight);
+
+            ::Standard::Algorithms::ert::are_equal(true, actual, "csr bellman_ford_shortest_paths_fast.");
+            ::Standard::Algorithms::ert::are_equal(expected_min_weights.data(), vertex_count, distances,
+                "distances in csr bellman_ford_shortest_paths_fast.");
+            ::Standard::Algorithms::ert::are_equal(
+                expected_parents.data(), vertex_count, parents, "parents in csr bellman_ford_shortest_paths_fast.");
+        }
+        {
+            const auto actual = Standard::Algorithms::Graphs::bellman_ford_shortest_paths_slow(
+                csr, source_vertex, distances, parents, infinite_weight);
+
+            ::Standard::Algorithms::ert::are_equal(true, actual, "csr bellman_ford_shortest_paths_slow.");
+            ::Standard::Algorithms::ert::are_equal(expected_min_weights.data(), vertex_count, distances,
+                "distances in csr bellman_ford_shortest_paths_slow.");
+            ::Standard::Algorithms::ert::are_equal(
+                expected_parents.data(), vertex_count, parents, "parents in csr bellman_ford_shortest_paths_slow.");
+        }
+
+        if (Standard::Algorithms::Graphs::has_negative_cost_cycle(csr, expected_min_weights))
+        {
+            throw std::runtime_error("The csr graph has a negative cost cycle.");
+        }
+    }
 } // namespace
 
 void Standard::Algorithms::Graphs::Tests::dijkstra_tests()
@@ -283,4 +360,5 @@ void Standard::Algorithms::Graphs::Tests::dijkstra_tests()
     verify_good_gold_dj_iskra_result(graph.adjacency_lists(), source_vertex, expected_min_weights, expected_parents);
 
     run_subtest(graph, expected_min_weights, expected_parents);
+    run_csr_subtest(graph, expected_min_weights, expected_parents);
 }
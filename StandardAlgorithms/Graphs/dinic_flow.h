@@ -0,0 +1,241 @@
+#pragma once
+#include"edmonds_karp_flow.h"
+#include"flow_residual_arcs.h"
+#include<algorithm>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // Dinic's (Dinitz's) max flow over the flat residual arcs.
+    // Each phase builds the level graph by a BFS, and then finds a blocking flow
+    // by an iterative DFS keeping the path in a vector, so a long path cannot overflow the stack.
+    // Current-arc pointers never revisit an arc that has been saturated or has led to a dead end.
+    // With the capacity scaling, a phase only uses the arcs having at least the threshold residual capacity;
+    // the threshold starts at the largest power of 2 not exceeding the max capacity, and halves until 1.
+    // Time O(v*v*e), or O(v*e*log(max capacity)) with the scaling.
+    template<std::signed_integral weight_t>
+    struct dinic_flow_engine final
+    {
+        // The "graph" MUST have all the reverse edges - same as for edmonds_karp_flow.
+        template<class edge_t>
+        constexpr explicit dinic_flow_engine(const std::vector<std::vector<edge_t>> &graph)
+            : Arcs(graph)
+            , Size(Arcs.vertex_count())
+        {
+        }
+
+        // Reuse the arcs already built by the caller, with any initial flow.
+        constexpr explicit dinic_flow_engine(flow_residual_arcs<weight_t> &&arcs)
+            : Arcs(std::move(arcs))
+            , Size(Arcs.vertex_count())
+        {
+        }
+
+        [[nodiscard]] constexpr auto max_flow(
+            const std::int32_t source, const std::int32_t sink, const bool use_capacity_scaling = false) -> weight_t
+        {
+            assert(!(source < 0) && source < Size && !(sink < 0) && sink < Size && source != sink);
+
+            constexpr weight_t one = 1;
+
+            auto threshold = one;
+
+            if (use_capacity_scaling)
+            {
+                const auto max_capacity = Arcs.residuals.empty()
+                    ? weight_t{}
+                    : *std::max_element(Arcs.residuals.cbegin(), Arcs.residuals.cend());
+
+                while (threshold <= max_capacity / 2)
+                {
+                    threshold *= 2;
+                }
+            }
+
+            weight_t total_flow{};
+
+            for (;;)
+            {
+                while (build_levels(source, sink, threshold))
+                {
+                    total_flow += blocking_flow(source, sink, threshold);
+                }
+
+                if (threshold == one)
+                {
+                    return total_flow;
+                }
+
+                threshold /= 2;
+            }
+        }
+
+        // Write the flows back.
+        template<class edge_t>
+        constexpr void get_flows(std::vector<std::vector<edge_t>> &graph) const
+        {
+            Arcs.get_flows(graph);
+        }
+
+        // Give the arcs with the flow back, e.g. to continue from the max flow.
+        [[nodiscard]] constexpr auto release_arcs() &&noexcept -> flow_residual_arcs<weight_t>
+        {
+            return std::move(Arcs);
+        }
+
+private:
+        static constexpr std::int32_t none = -1;
+
+        [[nodiscard]] constexpr auto is_admissible(
+            const std::size_t arc, const std::int32_t next_level, const weight_t &threshold) const -> bool
+        {
+            return !(Arcs.residuals[arc] < threshold) && Levels[Arcs.heads[arc]] == next_level;
+        }
+
+        // BFS from the source; the vertices farther than the sink are not needed.
+        [[nodiscard]] constexpr auto build_levels(
+            const std::int32_t source, const std::int32_t sink, const weight_t &threshold) -> bool
+        {
+            Levels.assign(Size, none);
+            Levels[source] = 0;
+
+            Bfs_queue.clear();
+            Bfs_queue.push_back(source);
+
+            for (std::size_t index{}; index < Bfs_queue.size(); ++index)
+            {
+                const auto cur = Bfs_queue[index];
+                const auto next_level = Levels[cur] + 1;
+
+                if (Levels[sink] != none && Levels[sink] < next_level)
+                {
+                    break;
+                }
+
+                for (auto arc = Arcs.first[cur]; arc < Arcs.first[cur + 1LL]; ++arc)
+                {
+                    const auto &tod = Arcs.heads[arc];
+
+                    if (Levels[tod] == none && !(Arcs.residuals[arc] < threshold))
+                    {
+                        Levels[tod] = next_level;
+                        Bfs_queue.push_back(tod);
+                    }
+                }
+            }
+
+            return Levels[sink] != none;
+        }
+
+        // The path from the source is a stack of arcs;
+        // on reaching the sink, augment and retreat to the tail of the first saturated arc.
+        [[nodiscard]] constexpr auto blocking_flow(
+            const std::int32_t source, const std::int32_t sink, const weight_t &threshold) -> weight_t
+        {
+            Currents.assign(Arcs.first.cbegin(), Arcs.first.cend() - 1);
+            Path.clear();
+
+            weight_t flow{};
+            auto vertex = source;
+
+            for (;;)
+            {
+                if (vertex == sink)
+                {
+                    auto delta = Arcs.residuals[Path.front()];
+
+                    for (const auto &arc : Path)
+                    {
+                        delta = std::min(delta, Arcs.residuals[arc]);
+                    }
+
+                    assert(!(delta < threshold));
+
+                    std::size_t saturated = Path.size();
+
+                    for (std::size_t index{}; index < Path.size(); ++index)
+                    {
+                        const auto &arc = Path[index];
+                        Arcs.push(arc, delta);
+
+                        if (Arcs.residuals[arc] < threshold && saturated == Path.size())
+                        {
+                            saturated = index;
+                        }
+                    }
+
+                    assert(saturated < Path.size());
+
+                    flow += delta;
+                    vertex = saturated == 0U ? source : Arcs.heads[Path[saturated - 1U]];
+                    Path.resize(saturated);
+                    continue;
+                }
+
+                const auto next_level = Levels[vertex] + 1;
+                const auto stop = Arcs.first[vertex + 1LL];
+
+                auto &arc = Currents[vertex];
+
+                while (arc < stop && !is_admissible(arc, next_level, threshold))
+                {
+                    ++arc;
+                }
+
+                if (arc < stop)
+                {// Advance.
+                    Path.push_back(arc);
+                    vertex = Arcs.heads[arc];
+                    continue;
+                }
+
+                // A dead end - remove it from the level graph, and retreat.
+                Levels[vertex] = none;
+
+                if (Path.empty())
+                {
+                    return flow;
+                }
+
+                Path.pop_back();
+
+                vertex = Path.empty() ? source : Arcs.heads[Path.back()];
+                ++Currents[vertex];
+            }
+        }
+
+        flow_residual_arcs<weight_t> Arcs;
+        std::int32_t Size;
+
+        std::vector<std::int32_t> Levels{};
+        std::vector<std::size_t> Currents{};
+        std::vector<std::size_t> Path{};
+        std::vector<std::int32_t> Bfs_queue{};
+    };
+
+    // Find the max flow using Dinic's algorithm.
+    // The "graph" MUST have all the reverse edges!
+    // The input, output are the same as of edmonds_karp_flow.
+    template<std::signed_integral weight_t, class edge_t>
+    constexpr auto dinic_flow(const std::int32_t source, std::vector<std::vector<edge_t>> &graph,
+        const std::int32_t destination, const bool use_capacity_scaling = false) -> weight_t
+    {
+        check_data_and_zero_flow<weight_t, edge_t>(source, graph, destination);
+
+        if (graph[source].empty())
+        {
+            return {};
+        }
+
+        dinic_flow_engine<weight_t> engine(graph);
+
+        const auto result = engine.max_flow(source, destination, use_capacity_scaling);
+        engine.get_flows(graph);
+
+        return result;
+    }
+} // namespace Standard::Algorithms::Graphs
@@ -230,4 +230,63 @@ namespace Standard::Algorithms::Graphs
         constexpr std::int32_t root{};
         Inner::dfs_et(root, context);
     }
+
+    // Euler tour of an undirected tree by an iterative DFS, so that a deep tree cannot overflow the stack.
+    // The "tour" has 2*n - 1 nodes; the adjacent tour nodes have the depths differing by 1.
+    // The "first_times[node]" is the first tour index of the node.
+    // Zero based index.
+    // Time O(n).
+    template<class edge_t>
+    constexpr void euler_tour_tree(const std::vector<std::vector<edge_t>> &tree, const std::int32_t root,
+        std::vector<std::int32_t> &tour, std::vector<std::int32_t> &first_times, std::vector<std::int32_t> &depths)
+    {
+        const auto size = static_cast<std::int32_t>(require_positive(tree.size(), "tree size"));
+        require_between(0, root, size - 1, "root");
+
+        tour.clear();
+        tour.reserve(size * 2LL - 1);
+        first_times.assign(size, -1);
+        depths.assign(size, 0);
+
+        // The node, and the index of its next child edge.
+        std::vector<std::pair<std::int32_t, std::size_t>> path{ { root, 0U } };
+        first_times[root] = 0;
+        tour.push_back(root);
+
+        while (!path.empty())
+        {
+            auto &[node, edge_index] = path.back();
+            const auto &edges = tree[node];
+
+            if (!(edge_index < edges.size()))
+            {
+                path.pop_back();
+
+                if (!path.empty())
+                {
+                    tour.push_back(path.back().first);
+                }
+
+                continue;
+            }
+
+            const auto child = static_cast<std::int32_t>(edges[edge_index++]);
+
+            if (!(first_times[child] < 0))
+            {// The parent.
+                continue;
+            }
+
+            depths[child] = depths[node] + 1;
+            first_times[child] = static_cast<std::int32_t>(tour.size());
+            tour.push_back(child);
+            path.emplace_back(child, 0U);
+        }
+
+        if (tour.size() != size * 2LLU - 1U) [[unlikely]]
+        {
+            throw std::invalid_argument("The tree must be connected, having the tour size " +
+                std::to_string(size * 2LL - 1) + ", but it is " + std::to_string(tour.size()) + ".");
+        }
+    }
 } // namespace Standard::Algorithms::Graphs
@@ -0,0 +1,275 @@
+#pragma once
+#include"../Numbers/concurrent_disjoint_set.h"
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/require_utilities.h"
+#include<algorithm>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<tuple>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    // Move the items satisfying the predicate to the front keeping the relative order, in parallel.
+    // Each thread takes a chunk; the chunk counts give the output positions.
+    // Return the number of the items satisfying the predicate.
+    template<class item_t, class predicate_t>
+    auto parallel_stable_partition(std::span<item_t> items, std::vector<item_t> &buffer,
+        std::vector<std::uint8_t> &flags, const predicate_t &predicate) -> std::size_t
+    {
+        constexpr std::size_t min_chunk = 1U << 12U;
+
+        const auto size = items.size();
+        const auto chunks = static_cast<std::int64_t>(
+            std::max<std::size_t>(1U, std::min(omp_thread_count(), size / min_chunk)));
+
+        const auto chunk_size = (size + static_cast<std::size_t>(chunks) - 1U) / static_cast<std::size_t>(chunks);
+
+        buffer.resize(std::max(buffer.size(), size));
+        flags.resize(std::max(flags.size(), size));
+
+        // The "true" count before each chunk.
+        std::vector<std::size_t> true_counts(chunks + 1, 0U);
+
+#pragma omp parallel for default(none) shared(items, flags, predicate, true_counts, chunks, chunk_size, size) \
+    schedule(static, 1)
+        for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            const auto start = static_cast<std::size_t>(chunk) * chunk_size;
+            const auto stop = std::min(size, start + chunk_size);
+            std::size_t count{};
+
+            for (auto index = start; index < stop; ++index)
+            {
+                const auto good = predicate(items[index]);
+                flags[index] = good ? 1U : 0U;
+                count += good ? 1U : 0U;
+            }
+
+            true_counts[chunk + 1] = count;
+        }
+
+        for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            true_counts[chunk + 1] += true_counts[chunk];
+        }
+
+        const auto total_true = true_counts.back();
+
+#pragma omp parallel for default(none) shared(items, buffer, flags, true_counts, chunks, chunk_size, size, total_true) \
+    schedule(static, 1)
+        for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            const auto start = static_cast<std::size_t>(chunk) * chunk_size;
+            const auto stop = std::min(size, start + chunk_size);
+
+            auto true_pos = true_counts[chunk];
+            auto false_pos = total_true + start - true_pos;
+
+            for (auto index = start; index < stop; ++index)
+            {
+                auto &pos = flags[index] != 0U ? true_pos : false_pos;
+                buffer[pos++] = items[index];
+            }
+        }
+
+        // A chunk of the buffer might have been written by other threads,
+        // so the copy starts after the parallel region above has ended.
+#pragma omp parallel for default(none) shared(items, buffer, chunks, chunk_size, size) schedule(static, 1)
+        for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+        {
+            const auto start = static_cast<std::size_t>(chunk) * chunk_size;
+            const auto stop = std::min(size, start + chunk_size);
+
+            std::copy(buffer.cbegin() + static_cast<std::ptrdiff_t>(start),
+                buffer.cbegin() + static_cast<std::ptrdiff_t>(stop),
+                items.begin() + static_cast<std::ptrdiff_t>(start));
+        }
+
+        return total_true;
+    }
+
+    template<class weight_t2, class from_to_weight_t>
+    struct filter_kruskal_context final
+    {
+        // NOLINTNEXTLINE
+        Standard::Algorithms::Numbers::concurrent_disjoint_set<std::int32_t> dsu;
+
+        // NOLINTNEXTLINE
+        std::vector<from_to_weight_t> &result_tree;
+
+        // NOLINTNEXTLINE
+        std::size_t max_tree_size{};
+
+        // NOLINTNEXTLINE
+        std::size_t base_size{};
+
+        // NOLINTNEXTLINE
+        weight_t2 weights{};
+
+        // NOLINTNEXTLINE
+        std::vector<from_to_weight_t> buffer{};
+
+        // NOLINTNEXTLINE
+        std::vector<std::uint8_t> flags{};
+
+        [[nodiscard]] constexpr auto is_done() const noexcept -> bool
+        {
+            return max_tree_size <= result_tree.size();
+        }
+    };
+
+    template<class weight_t2, class from_to_weight_t>
+    void kruskal_base(filter_kruskal_context<weight_t2, from_to_weight_t> &context,
+        std::span<from_to_weight_t> edges, const bool is_sorted)
+    {
+        if (!is_sorted)
+        {
+            std::sort(edges.begin(), edges.end(),
+                [] [[nodiscard]] (const from_to_weight_t &one, const from_to_weight_t &two)
+                {
+                    return std::get<2>(one) < std::get<2>(two);
+                });
+        }
+
+        for (const auto &edge : edges)
+        {
+            const auto &from = std::get<0>(edge);
+            const auto &tod = std::get<1>(edge);
+            const auto &weight = std::get<2>(edge);
+
+            if (!context.dsu.unite(from, tod))
+            {
+                continue;
+            }
+
+            context.result_tree.emplace_back(std::min(from, tod), std::max(from, tod), weight);
+            context.weights += weight;
+
+            if (context.is_done())
+            {
+                return;
+            }
+        }
+    }
+
+    template<class weight_t2, class from_to_weight_t>
+    void filter_kruskal_recursive(
+        filter_kruskal_context<weight_t2, from_to_weight_t> &context, std::span<from_to_weight_t> edges)
+    {
+        if (edges.empty() || context.is_done())
+        {
+            return;
+        }
+
+        if (edges.size() <= context.base_size)
+        {
+            kruskal_base(context, edges, false);
+            return;
+        }
+
+        // The median of 3.
+        auto pivot = std::get<2>(edges[0]);
+        {
+            auto middle = std::get<2>(edges[edges.size() / 2U]);
+            auto last = std::get<2>(edges.back());
+
+            if (middle < pivot)
+            {
+                std::swap(middle, pivot);
+            }
+
+            if (last < middle)
+            {
+                middle = std::max(pivot, last);
+            }
+
+            pivot = middle;
+        }
+
+        auto light_count = parallel_stable_partition(edges, context.buffer, context.flags,
+            [&pivot] [[nodiscard]] (const from_to_weight_t &edge)
+            {
+                return std::get<2>(edge) < pivot;
+            });
+
+        if (0U == light_count)
+        {// The pivot is the minimum.
+            light_count = parallel_stable_partition(edges, context.buffer, context.flags,
+                [&pivot] [[nodiscard]] (const from_to_weight_t &edge)
+                {
+                    return !(pivot < std::get<2>(edge));
+                });
+
+            if (light_count == edges.size())
+            {// All the weights are equal.
+                kruskal_base(context, edges, true);
+                return;
+            }
+        }
+
+        filter_kruskal_recursive(context, edges.first(light_count));
+
+        if (context.is_done())
+        {
+            return;
+        }
+
+        // Drop the edges inside the components found so far.
+        auto heavy = edges.subspan(light_count);
+
+        const auto &dsu = context.dsu;
+
+        const auto kept = parallel_stable_partition(heavy, context.buffer, context.flags,
+            [&dsu] [[nodiscard]] (const from_to_weight_t &edge)
+            {
+                return !dsu.are_connected(std::get<0>(edge), std::get<1>(edge));
+            });
+
+        filter_kruskal_recursive(context, heavy.first(kept));
+    }
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Filter-Kruskal minimum spanning forest: partition the edges by a pivot weight like quick sort,
+    // solve for the lighter edges, then drop in parallel the heavier edges
+    // whose ends are already connected, and solve for the rest.
+    // Only the edges that might be in the tree get sorted; the filtering and partitioning are parallel,
+    // the lock-free DSU lets the threads search while no one unites.
+    // The graph is undirected, weighted, given by an edge list (from, to, weight) - same as boruvka_mst.
+    // The graph will be reordered and might be partially sorted.
+    // 0-based vertices.
+    // Work O(e + v*log(v)*log(e/v)) on average for random weights.
+    template<class weight_t2, class weight_t, class from_to_weight_t>
+    requires(sizeof(weight_t) <= sizeof(weight_t2))
+    [[nodiscard]] auto filter_kruskal_mst(std::vector<from_to_weight_t> &editable_graph,
+        const std::int32_t vertex_count, std::vector<from_to_weight_t> &result_tree,
+        const std::size_t base_size = 1U << 14U) -> weight_t2
+    {
+        result_tree.clear();
+
+        if (vertex_count <= 1 || editable_graph.empty())
+        {
+            return {};
+        }
+
+        // An exception cannot leave a parallel region, so check the edges before it.
+        for (const auto &edge : editable_graph)
+        {
+            require_between(0, std::get<0>(edge), vertex_count - 1, "edge from");
+            require_between(0, std::get<1>(edge), vertex_count - 1, "edge to");
+        }
+
+        Inner::filter_kruskal_context<weight_t2, from_to_weight_t> context{
+            Standard::Algorithms::Numbers::concurrent_disjoint_set<std::int32_t>(vertex_count), result_tree,
+            static_cast<std::size_t>(vertex_count - 1), require_positive(base_size, "base size")
+        };
+
+        Inner::filter_kruskal_recursive(context, std::span<from_to_weight_t>(editable_graph));
+
+        return context.weights;
+    }
+} // namespace Standard::Algorithms::Graphs
@@ -0,0 +1,131 @@
+#include"filter_kruskal_mst_tests.h"
+#include"../Numbers/disjoint_set.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"filter_kruskal_mst.h"
+
+namespace
+{
+    using weight_t = std::int32_t;
+    using long_weight_t = std::int64_t;
+    using from_to_weight_t = std::tuple<std::int32_t, std::int32_t, weight_t>;
+
+    [[nodiscard]] auto kruskal_slow(std::vector<from_to_weight_t> edges, const std::int32_t vertex_count)
+        -> long_weight_t
+    {
+        std::sort(edges.begin(), edges.end(),
+            [](const auto &one, const auto &two)
+            {
+                return std::get<2>(one) < std::get<2>(two);
+            });
+
+        Standard::Algorithms::Numbers::disjoint_set<std::int32_t> dsu(vertex_count);
+        long_weight_t weights{};
+
+        for (const auto &[from, tod, weight] : edges)
+        {
+            if (dsu.unite(from, tod))
+            {
+                weights += weight;
+            }
+        }
+
+        return weights;
+    }
+
+    void check_forest(const std::vector<from_to_weight_t> &tree, const std::int32_t vertex_count,
+        const std::vector<from_to_weight_t> &edges, const long_weight_t &weights, const std::string &name)
+    {
+        Standard::Algorithms::Numbers::disjoint_set<std::int32_t> expected_dsu(vertex_count);
+
+        for (const auto &[from, tod, weight] : edges)
+        {
+            expected_dsu.unite(from, tod);
+        }
+
+        ::Standard::Algorithms::ert::are_equal(static_cast<std::size_t>(vertex_count - expected_dsu.count()),
+            tree.size(), name + " tree size");
+
+        Standard::Algorithms::Numbers::disjoint_set<std::int32_t> dsu(vertex_count);
+        long_weight_t sum{};
+
+        for (const auto &[from, tod, weight] : tree)
+        {
+            ::Standard::Algorithms::ert::are_equal(true, from < tod, name + " from < to");
+            ::Standard::Algorithms::ert::are_equal(true, dsu.unite(from, tod), name + " no cycle");
+
+            sum += weight;
+        }
+
+        ::Standard::Algorithms::ert::are_equal(weights, sum, name + " tree weight");
+    }
+
+    void random_test(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd)
+    {
+        constexpr auto max_size = 2'000;
+        constexpr auto max_weight = 1'000'000;
+
+        const auto vertex_count = rnd(1, max_size);
+        const auto edge_count = rnd(0, vertex_count * 8);
+        const auto weight_limit = rnd(0, 2) == 0 ? 3 : max_weight;
+
+        std::vector<from_to_weight_t> edges;
+
+        for (std::int32_t index{}; index < edge_count; ++index)
+        {
+            const auto from = rnd(0, vertex_count - 1);
+            const auto tod = rnd(0, vertex_count - 1);
+
+            if (from != tod)
+            {
+                edges.emplace_back(from, tod, rnd(0, weight_limit));
+            }
+        }
+
+        const auto expected = kruskal_slow(edges, vertex_count);
+
+        for (const std::size_t base_size : { 1U, 16U, 1U << 14U })
+        {
+            const auto name = "filter_kruskal_mst vertices " + std::to_string(vertex_count) + ", edges " +
+                std::to_string(edges.size()) + ", base " + std::to_string(base_size);
+
+            auto editable = edges;
+            std::vector<from_to_weight_t> tree;
+
+            const auto actual = Standard::Algorithms::Graphs::filter_kruskal_mst<long_weight_t, weight_t>(
+                editable, vertex_count, tree, base_size);
+
+            ::Standard::Algorithms::ert::are_equal(expected, actual, name);
+            check_forest(tree, vertex_count, edges, actual, name);
+        }
+    }
+
+    void bad_edge_test()
+    {
+        std::vector<from_to_weight_t> edges{ { 0, 1, 5 }, { -1, 2, 7 } };
+        std::vector<from_to_weight_t> tree;
+
+        ::Standard::Algorithms::ert::expect_exception<std::out_of_range>(
+            "The value (0) must non exceed -1.",
+            [&edges, &tree]
+            {
+                [[maybe_unused]] const auto weights =
+                    Standard::Algorithms::Graphs::filter_kruskal_mst<long_weight_t, weight_t>(edges, 3, tree);
+            },
+            "filter Kruskal bad edge");
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Tests::filter_kruskal_mst_tests()
+{
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+    constexpr auto steps = 10;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        random_test(rnd);
+    }
+
+    bad_edge_test();
+}
@@ -0,0 +1,110 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // The residual graph of a flow network packed into flat arrays (CSR):
+    // the arcs of a vertex "from" are in [first[from], first[from + 1]),
+    // so that scanning a vertex touches consecutive memory.
+    // An arc "arc" has the reverse arc reverses[arc].
+    template<std::signed_integral weight_t>
+    struct flow_residual_arcs final
+    {
+        // The "graph" MUST have all the reverse edges - same as for edmonds_karp_flow.
+        template<class edge_t>
+        constexpr explicit flow_residual_arcs(const std::vector<std::vector<edge_t>> &graph)
+            : first(require_positive(graph.size(), "graph size") + 1U)
+        {
+            const auto size = static_cast<std::int32_t>(graph.size());
+
+            for (std::int32_t from{}; from < size; ++from)
+            {
+                first[from + 1LL] = first[from] + graph[from].size();
+            }
+
+            const auto arc_count = first.back();
+            heads.resize(arc_count);
+            residuals.resize(arc_count);
+            reverses.resize(arc_count);
+
+            for (std::int32_t from{}; from < size; ++from)
+            {
+                auto arc = first[from];
+
+                for (const auto &edge : graph[from])
+                {
+                    assert(!(edge.to < 0) && edge.to < size && !(edge.capacity < weight_t{}));
+
+                    heads[arc] = edge.to;
+                    residuals[arc] = static_cast<weight_t>(edge.capacity - edge.flow);
+                    reverses[arc] = first[edge.to] + static_cast<std::size_t>(edge.rev_edge_index);
+
+                    ++arc;
+                }
+            }
+
+            for (std::size_t arc{}; arc < arc_count; ++arc)
+            {
+                if (const auto &rev = reverses[arc]; arc_count <= rev || reverses[rev] != arc) [[unlikely]]
+                {
+                    auto str = ::Standard::Algorithms::Utilities::w_stream();
+                    str << "The flow graph arc " << arc << " has a bad reverse arc " << rev << ".";
+                    throw_exception(str);
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr auto vertex_count() const noexcept -> std::int32_t
+        {
+            return static_cast<std::int32_t>(first.size() - 1U);
+        }
+
+        [[nodiscard]] constexpr auto arc_count() const noexcept -> std::size_t
+        {
+            return first.back();
+        }
+
+        constexpr void push(const std::size_t arc, const weight_t delta)
+        {
+            assert(weight_t{} < delta && delta <= residuals[arc]);
+
+            residuals[arc] -= delta;
+            residuals[reverses[arc]] += delta;
+        }
+
+        // Write the flows back.
+        template<class edge_t>
+        constexpr void get_flows(std::vector<std::vector<edge_t>> &graph) const
+        {
+            const auto size = vertex_count();
+            require_equal(static_cast<std::size_t>(size), "graph size", graph.size());
+
+            for (std::int32_t from{}; from < size; ++from)
+            {
+                auto arc = first[from];
+
+                for (auto &edge : graph[from])
+                {
+                    edge.flow = static_cast<weight_t>(edge.capacity - residuals[arc]);
+                    ++arc;
+                }
+            }
+        }
+
+        // NOLINTNEXTLINE
+        std::vector<std::size_t> first;
+
+        // NOLINTNEXTLINE
+        std::vector<std::int32_t> heads{};
+
+        // NOLINTNEXTLINE
+        std::vector<weight_t> residuals{};
+
+        // NOLINTNEXTLINE
+        std::vector<std::size_t> reverses{};
+    };
+} // namespace Standard::Algorithms::Graphs
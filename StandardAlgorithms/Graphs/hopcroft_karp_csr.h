@@ -0,0 +1,452 @@
+#pragma once
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/require_utilities.h"
+#include<algorithm>
+#include<atomic>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<limits>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // Bipartite unweighted graph maximum matching due to Hopcroft, Karp over flat arrays (CSR);
+    // see also max_2c_matching_karzanov_hopcroft_karp for the 1-based adjacency lists.
+    // The left vertices are [0..left_size-1], the right ones are [0..right_size-1].
+    // The initial matching is found greedily by Karp-Sipser:
+    // a vertex having exactly 1 free neighbor is matched to it first, else a vertex of the min index.
+    // Then each phase builds the layers by a BFS from all the free left vertices,
+    // expanding a layer in parallel, and augments along vertex-disjoint shortest paths
+    // by an iterative DFS with current-arc pointers.
+    // Time O(e * sqrt(v)).
+    template<std::signed_integral int_t1 = std::int32_t>
+    struct hopcroft_karp_csr final
+    {
+        using int_t = int_t1;
+        using edge_t = std::pair<int_t, int_t>;
+
+        // The "left_neighbors[from]" are the right vertices adjacent to the left vertex "from".
+        // The graph must be simple.
+        constexpr hopcroft_karp_csr(const std::vector<std::vector<int_t>> &left_neighbors, const int_t right_size)
+            : Left_size(require_positive(static_cast<int_t>(left_neighbors.size()), "left part size"))
+            , Right_size(require_positive(right_size, "right part size"))
+            , Left_first(Left_size + 1LL)
+            , Right_first(Right_size + 1LL)
+        {
+            for (int_t from{}; from < Left_size; ++from)
+            {
+                Left_first[from + 1LL] = Left_first[from] + left_neighbors[from].size();
+
+                for (const auto &tod : left_neighbors[from])
+                {
+                    if (tod < 0 || !(tod < Right_size)) [[unlikely]]
+                    {
+                        auto str = ::Standard::Algorithms::Utilities::w_stream();
+                        str << "The left vertex " << from << " has a bad right neighbor " << tod << ".";
+                        throw_exception(str);
+                    }
+
+                    ++Right_first[tod + 1LL];
+                }
+            }
+
+            for (int_t tod{}; tod < Right_size; ++tod)
+            {
+                Right_first[tod + 1LL] += Right_first[tod];
+            }
+
+            const auto edge_count = Left_first.back();
+            assert(edge_count == Right_first.back());
+
+            Left_heads.resize(edge_count);
+            Right_heads.resize(edge_count);
+
+            auto positions = Right_first;
+
+            for (int_t from{}; from < Left_size; ++from)
+            {
+                auto arc = Left_first[from];
+
+                for (const auto &tod : left_neighbors[from])
+                {
+                    Left_heads[arc++] = tod;
+                    Right_heads[positions[tod]++] = from;
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr auto left_size() const noexcept -> int_t
+        {
+            return Left_size;
+        }
+
+        [[nodiscard]] constexpr auto right_size() const noexcept -> int_t
+        {
+            return Right_size;
+        }
+
+        // Return the matching size.
+        // The "matchings" are ordered by the left vertex.
+        [[nodiscard]] auto max_matching(std::vector<edge_t> &matchings, const bool use_greedy_init = true)
+            -> std::size_t
+        {
+            Left_matches.assign(Left_size, none);
+            Right_matches.assign(Right_size, none);
+
+            auto matching_size = use_greedy_init ? karp_sipser() : std::size_t{};
+
+            while (build_layers())
+            {
+                [[maybe_unused]] std::size_t added{};
+
+                for (const auto &from : Free_lefts)
+                {
+                    if (augment_dfs(from))
+                    {
+                        ++added;
+                    }
+                }
+
+                assert(0U < added);
+                matching_size += added;
+            }
+
+            matchings.clear();
+            matchings.reserve(matching_size);
+
+            for (int_t from{}; from < Left_size; ++from)
+            {
+                if (const auto &tod = Left_matches[from]; tod != none)
+                {
+                    assert(Right_matches[tod] == from);
+
+                    matchings.emplace_back(from, tod);
+                }
+            }
+
+            assert(matching_size == matchings.size());
+            return matching_size;
+        }
+
+private:
+        static constexpr int_t none = -1;
+        static constexpr auto infinite_distance = std::numeric_limits<int_t>::max();
+
+        // The vertices of both parts in one array: [0..Left_size) for the left, then the right ones.
+        [[nodiscard]] constexpr auto first_free_neighbor(const int_t vertex) const -> int_t
+        {
+            if (vertex < Left_size)
+            {
+                for (auto arc = Left_first[vertex]; arc < Left_first[vertex + 1LL]; ++arc)
+                {
+                    if (const auto &tod = Left_heads[arc]; Right_matches[tod] == none)
+                    {
+                        return Left_size + tod;
+                    }
+                }
+            }
+            else
+            {
+                const auto tod = vertex - Left_size;
+
+                for (auto arc = Right_first[tod]; arc < Right_first[tod + 1LL]; ++arc)
+                {
+                    if (const auto &from = Right_heads[arc]; Left_matches[from] == none)
+                    {
+                        return from;
+                    }
+                }
+            }
+
+            return none;
+        }
+
+        // Once "vertex" is matched, its free neighbors lose a free neighbor.
+        constexpr void decrease_neighbor_degrees(const int_t vertex)
+        {
+            const auto is_left = vertex < Left_size;
+            const auto index = is_left ? vertex : vertex - Left_size;
+            const auto &firsts = is_left ? Left_first : Right_first;
+            const auto &heads = is_left ? Left_heads : Right_heads;
+            const auto &other_matches = is_left ? Right_matches : Left_matches;
+            const auto shift = is_left ? Left_size : int_t{};
+
+            for (auto arc = firsts[index]; arc < firsts[index + 1LL]; ++arc)
+            {
+                const auto &other = heads[arc];
+
+                if (other_matches[other] != none)
+                {
+                    continue;
+                }
+
+                if (--Degrees[other + shift] == 1)
+                {
+                    Degree_ones.push_back(other + shift);
+                }
+            }
+        }
+
+        constexpr void match_greedy(const int_t vertex, const int_t other)
+        {
+            const auto [from, tod] = vertex < Left_size ? edge_t{ vertex, other - Left_size }
+                                                        : edge_t{ other, vertex - Left_size };
+
+            assert(Left_matches[from] == none && Right_matches[tod] == none);
+
+            Left_matches[from] = tod;
+            Right_matches[tod] = from;
+
+            decrease_neighbor_degrees(from);
+            decrease_neighbor_degrees(Left_size + tod);
+        }
+
+        // A degree 1 vertex can always be matched to its only free neighbor without losing the optimum.
+        // Time O(e).
+        [[nodiscard]] constexpr auto karp_sipser() -> std::size_t
+        {
+            Degrees.resize(static_cast<std::size_t>(Left_size) + Right_size);
+            Degree_ones.clear();
+
+            for (int_t vertex{}; vertex < Left_size + Right_size; ++vertex)
+            {
+                Degrees[vertex] = static_cast<int_t>(vertex < Left_size
+                        ? Left_first[vertex + 1LL] - Left_first[vertex]
+                        : Right_first[vertex - Left_size + 1LL] - Right_first[vertex - Left_size]);
+
+                if (Degrees[vertex] == 1)
+                {
+                    Degree_ones.push_back(vertex);
+                }
+            }
+
+            std::size_t matching_size{};
+            int_t next_left{};
+
+            for (;;)
+            {
+                int_t vertex = none;
+
+                while (!Degree_ones.empty() && vertex == none)
+                {
+                    vertex = Degree_ones.back();
+                    Degree_ones.pop_back();
+
+                    const auto is_matched = vertex < Left_size ? Left_matches[vertex] != none
+                                                               : Right_matches[vertex - Left_size] != none;
+
+                    if (is_matched || Degrees[vertex] == 0)
+                    {
+                        vertex = none;
+                    }
+                }
+
+                while (vertex == none && next_left < Left_size)
+                {
+                    if (Left_matches[next_left] == none && 0 < Degrees[next_left])
+                    {
+                        vertex = next_left;
+                    }
+
+                    ++next_left;
+                }
+
+                if (vertex == none)
+                {
+                    return matching_size;
+                }
+
+                const auto other = first_free_neighbor(vertex);
+                assert(other != none);
+
+                match_greedy(vertex, other);
+                ++matching_size;
+            }
+        }
+
+        // Expand one layer: each thread collects the reached left vertices in its own buffer.
+        // A left vertex is claimed by the thread that first sets its distance.
+        // Return true when a free right vertex is reached.
+        [[nodiscard]] auto expand_layer(const int_t next_distance) -> bool
+        {
+            const auto layer_size = static_cast<std::int64_t>(Layer.size());
+            const auto thread_count = static_cast<std::int32_t>(omp_thread_count());
+
+            Buffers.resize(thread_count);
+
+            // The team might be smaller than the max thread count, leaving some buffers unused.
+            for (auto &buffer : Buffers)
+            {
+                buffer.clear();
+            }
+
+            auto has_free_right = false;
+
+#pragma omp parallel default(none) shared(layer_size, next_distance) reduction(|| : has_free_right)
+            {
+                auto &buffer = Buffers[omp_thread_index()];
+
+#pragma omp for schedule(dynamic, 64)
+                for (std::int64_t index = 0; index < layer_size; ++index)
+                {
+                    const auto &from = Layer[index];
+
+                    for (auto arc = Left_first[from]; arc < Left_first[from + 1LL]; ++arc)
+                    {
+                        const auto &match_from = Right_matches[Left_heads[arc]];
+
+                        if (match_from == none)
+                        {
+                            has_free_right = true;
+                            continue;
+                        }
+
+                        std::atomic_ref<int_t> distance(Distances[match_from]);
+
+                        if (auto cur = infinite_distance; distance.load(std::memory_order_relaxed) == cur &&
+                            distance.compare_exchange_strong(cur, next_distance, std::memory_order_relaxed))
+                        {
+                            buffer.push_back(match_from);
+                        }
+                    }
+                }
+            }
+
+            Layer.clear();
+
+            for (const auto &buffer : Buffers)
+            {
+                Layer.insert(Layer.end(), buffer.cbegin(), buffer.cend());
+            }
+
+            return has_free_right;
+        }
+
+        // Return true when there is an augmenting path.
+        [[nodiscard]] auto build_layers() -> bool
+        {
+            Distances.assign(Left_size, infinite_distance);
+            Free_lefts.clear();
+
+            for (int_t from{}; from < Left_size; ++from)
+            {
+                if (Left_matches[from] == none)
+                {
+                    Distances[from] = 0;
+                    Free_lefts.push_back(from);
+                }
+            }
+
+            Layer = Free_lefts;
+
+            for (int_t distance{}; !Layer.empty(); ++distance)
+            {
+                if (expand_layer(distance + 1))
+                {
+                    // The vertices beyond the shortest path length are not used.
+                    Max_distance = distance;
+                    Currents.assign(Left_first.cbegin(), Left_first.cend() - 1);
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        // The path is a stack of left vertices, each having its current arc to the next right vertex.
+        [[nodiscard]] constexpr auto augment_dfs(const int_t root) -> bool
+        {
+            Path.clear();
+            Path.push_back(root);
+
+            while (!Path.empty())
+            {
+                const auto from = Path.back();
+                const auto &from_distance = Distances[from];
+                const auto stop = Left_first[from + 1LL];
+
+                auto &arc = Currents[from];
+                auto is_augmented = false;
+                auto next = none;
+
+                for (; arc < stop; ++arc)
+                {
+                    const auto &match_from = Right_matches[Left_heads[arc]];
+
+                    if (match_from == none)
+                    {
+                        if (from_distance == Max_distance)
+                        {
+                            is_augmented = true;
+                            break;
+                        }
+
+                        continue;
+                    }
+
+                    if (from_distance < Max_distance && Distances[match_from] == from_distance + 1)
+                    {
+                        next = match_from;
+                        break;
+                    }
+                }
+
+                if (is_augmented)
+                {
+                    for (const auto &left : Path)
+                    {
+                        const auto &tod = Left_heads[Currents[left]];
+                        Left_matches[left] = tod;
+                        Right_matches[tod] = left;
+                    }
+
+                    return true;
+                }
+
+                if (next != none)
+                {
+                    Path.push_back(next);
+                    continue;
+                }
+
+                // A dead end - ban the vertex, and retreat.
+                Distances[from] = infinite_distance;
+                Path.pop_back();
+
+                if (!Path.empty())
+                {
+                    ++Currents[Path.back()];
+                }
+            }
+
+            return false;
+        }
+
+        int_t Left_size;
+        int_t Right_size;
+
+        std::vector<std::size_t> Left_first;
+        std::vector<int_t> Left_heads{};
+
+        // The left neighbors of the right vertices are only used by the greedy init.
+        std::vector<std::size_t> Right_first;
+        std::vector<int_t> Right_heads{};
+
+        std::vector<int_t> Left_matches{};
+        std::vector<int_t> Right_matches{};
+
+        std::vector<int_t> Degrees{};
+        std::vector<int_t> Degree_ones{};
+
+        std::vector<int_t> Distances{};
+        std::vector<int_t> Free_lefts{};
+        std::vector<int_t> Layer{};
+        std::vector<std::vector<int_t>> Buffers{};
+        int_t Max_distance{};
+
+        std::vector<std::size_t> Currents{};
+        std::vector<int_t> Path{};
+    };
+} // namespace Standard::Algorithms::Graphs
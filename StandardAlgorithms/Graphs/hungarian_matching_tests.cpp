@@ -2,7 +2,9 @@
 #include"../Numbers/permutation.h"
 #include"../Utilities/random.h"
 #include"../Utilities/test_utilities.h"
+#include"auction_matching.h"
 #include"hungarian_matching.h"
+#include"jonker_volgenant_matching.h"
 
 namespace
 {
@@ -193,7 +195,7 @@ private:
         generate_random(tests);
     }
 
-    constexpr void run_test_case(const test_case &test)
+    void run_test_case(const test_case &test)
     {
         std::vector<std::int32_t> matchings;
 
@@ -212,6 +214,24 @@ private:
             check_matchings("hungarian_matching matchings", test.graph(), min_weight, matchings);
         }
 
+        matchings.clear();
+        {
+            const auto actual =
+                Standard::Algorithms::Graphs::jonker_volgenant_matching<long_int_t, graph_t>(test.graph(), matchings);
+
+            ::Standard::Algorithms::ert::are_equal(min_weight, actual, "jonker_volgenant_matching weight");
+            check_matchings("jonker_volgenant_matching matchings", test.graph(), min_weight, matchings);
+        }
+
+        matchings.clear();
+        {
+            const auto actual =
+                Standard::Algorithms::Graphs::auction_matching<long_int_t, graph_t>(test.graph(), matchings);
+
+            ::Standard::Algorithms::ert::are_equal(min_weight, actual, "auction_matching weight");
+            check_matchings("auction_matching matchings", test.graph(), min_weight, matchings);
+        }
+
         matchings.clear();
         {
             const auto slow = Standard::Algorithms::Graphs::min_cost_perfect_matching_slow<long_int_t, graph_t>(
@@ -227,9 +247,62 @@ private:
             check_matchings("min_cost_perfect_matching_slow matchings", test.graph(), min_weight, matchings);
         }
     }
+
+    // Too large for min_cost_perfect_matching_slow.
+    void large_random_tests()
+    {
+        constexpr auto steps = 10;
+        constexpr auto max_size = 100;
+
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+        for (std::int32_t step{}; step < steps; ++step)
+        {
+            const auto size = rnd(1, max_size);
+
+            // Few distinct costs make many ties.
+            const auto max_cost = static_cast<int_t>(rnd(0, 1) == 0 ? 3 : 1'000);
+
+            random_t rnd_cost(static_cast<int_t>(-max_cost), max_cost);
+            graph_t graph(size, std::vector<int_t>(size));
+
+            for (auto &row : graph)
+            {
+                for (auto &cost : row)
+                {
+                    cost = rnd_cost();
+                }
+            }
+
+            const auto name = "large random size " + std::to_string(size);
+
+            std::vector<std::int32_t> matchings;
+
+            const auto expected =
+                Standard::Algorithms::Graphs::hungarian_matching<long_int_t, graph_t>(graph, matchings);
+            check_matchings(name + " hungarian_matching", graph, expected, matchings);
+
+            {
+                const auto actual =
+                    Standard::Algorithms::Graphs::jonker_volgenant_matching<long_int_t, graph_t>(graph, matchings);
+
+                ::Standard::Algorithms::ert::are_equal(expected, actual, name + " jonker_volgenant_matching");
+                check_matchings(name + " jonker_volgenant_matching", graph, expected, matchings);
+            }
+            {
+                const auto actual =
+                    Standard::Algorithms::Graphs::auction_matching<long_int_t, graph_t>(graph, matchings);
+
+                ::Standard::Algorithms::ert::are_equal(expected, actual, name + " auction_matching");
+                check_matchings(name + " auction_matching", graph, expected, matchings);
+            }
+        }
+    }
 } // namespace
 
 void Standard::Algorithms::Graphs::Tests::hungarian_matching_tests()
 {
     ::Standard::Algorithms::Tests::test_utilities<test_case>::run_tests(run_test_case, generate_test_cases);
+
+    large_random_tests();
 }
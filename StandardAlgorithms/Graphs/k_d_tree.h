@@ -53,7 +53,7 @@ namespace Standard::Algorithms::Trees
         }
 
         // It is assumed that a median on dim=0 is inserted first, .. , to guarantee O(log(n)) height.
-        // todo(p2): impl. insert many/all.
+        // To build from many points at once, see "k_d_tree_flat.h".
         constexpr void insert(const tuple_t &point) noexcept(false)
         {
             if (::Standard::Algorithms::Utilities::stack_max_size <= Size) [[unlikely]]
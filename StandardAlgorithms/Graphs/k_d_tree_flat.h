@@ -0,0 +1,343 @@
+#pragma once
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/require_utilities.h"
+#include"multiway_point.h"
+#include<algorithm>
+#include<array>
+#include<bit>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Trees
+{
+    // A static k-d tree built at once from all the points, stored in a flat array in the BFS order:
+    // the children of the node at "index" are at (2*index + 1), (2*index + 2), so there are no pointers,
+    // and the top levels, visited by every query, share a few cache lines.
+    // The tree is left-balanced (complete): a subtree of n nodes takes exactly the first n BFS positions.
+    // The split dimension cycles by the depth; a node is the median of its subtree found by nth_element.
+    // The points equal to a node coordinate can be on both sides.
+    // The "distance_t" holds the squared Euclidean distances.
+    // The queries are read-only, and can run in parallel.
+    // See also "k_d_tree.h".
+    template<class point_t1, std::int32_t dimensions, class distance_t1 = double>
+    requires(0 < dimensions)
+    struct k_d_tree_flat final
+    {
+        using point_t = point_t1;
+        using distance_t = distance_t1;
+
+        // The point, and its index in the input.
+        using node_t = std::pair<point_t, std::size_t>;
+
+        // A pop pushes up to 2 children, so the stack holds at most 1 node per level, plus 1.
+        static constexpr std::size_t max_stack_size = 65;
+
+        // The subtrees of fewer points are built sequentially.
+        static constexpr std::size_t default_parallel_min_size = 1U << 14U;
+
+        // The top levels are split one level at a time in parallel,
+        // then the subtrees are built in parallel.
+        // Time O(n*log(n)).
+        explicit k_d_tree_flat(
+            const std::vector<point_t> &points, const std::size_t parallel_min_size = default_parallel_min_size)
+            : Nodes(points.size())
+        {
+            require_positive(parallel_min_size, "parallel min size");
+
+            std::vector<node_t> work;
+            work.reserve(points.size());
+
+            for (std::size_t index{}; index < points.size(); ++index)
+            {
+                work.emplace_back(points[index], index);
+            }
+
+            build(work, parallel_min_size);
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Nodes.size();
+        }
+
+        // In the BFS order.
+        [[nodiscard]] constexpr auto nodes() const &noexcept -> const std::vector<node_t> &
+        {
+            return Nodes;
+        }
+
+        // Visit the points having every coordinate in [low[dim], high[dim]].
+        template<class visit_t>
+        constexpr void find(const point_t &low, visit_t &visit, const point_t &high) const
+        {
+            if (Nodes.empty())
+            {
+                return;
+            }
+
+            const std::pair<const point_t &, const point_t &> limits{ low, high };
+
+            std::array<std::size_t, max_stack_size> stack{};
+            std::size_t stack_size = 1;
+
+            while (0U < stack_size)
+            {
+                const auto index = stack[--stack_size];
+
+                const auto &node = Nodes[index];
+                const auto dim = dimension(index);
+                const auto &coord = node.first[dim];
+
+                if (is_between<dimensions, point_t>(node.first, limits))
+                {
+                    visit(node);
+                }
+
+                if (const auto right = index * 2U + 2U; right < Nodes.size() && !(high[dim] < coord))
+                {
+                    stack[stack_size++] = right;
+                }
+
+                if (const auto left = index * 2U + 1U; left < Nodes.size() && !(coord < low[dim]))
+                {
+                    stack[stack_size++] = left;
+                }
+            }
+        }
+
+        // The "count" nearest points as {squared distance, input index}, the nearest first.
+        // Time O(log(n) * log(count)) on average for the uniform points.
+        constexpr void nearest(const point_t &query, const std::size_t count,
+            std::vector<std::pair<distance_t, std::size_t>> &result) const
+        {
+            result.clear();
+
+            if (count == 0U || Nodes.empty())
+            {
+                return;
+            }
+
+            // The max-heap of the best candidates.
+            const auto push = [&result, count](const distance_t &distance, const std::size_t input_index)
+            {
+                if (result.size() < count)
+                {
+                    result.emplace_back(distance, input_index);
+                    std::push_heap(result.begin(), result.end());
+                }
+                else if (distance < result.front().first)
+                {
+                    std::pop_heap(result.begin(), result.end());
+                    result.back() = { distance, input_index };
+                    std::push_heap(result.begin(), result.end());
+                }
+            };
+
+            const auto can_improve = [&result, count](const distance_t &bound)
+            {
+                return result.size() < count || bound < result.front().first;
+            };
+
+            search(query, push, can_improve);
+
+            std::sort_heap(result.begin(), result.end());
+        }
+
+        // The points within the "radius" (inclusive) as {squared distance, input index}, in no particular order.
+        constexpr void within_radius(const point_t &query, const distance_t &radius,
+            std::vector<std::pair<distance_t, std::size_t>> &result) const
+        {
+            result.clear();
+
+            if (radius < distance_t{})
+            {
+                return;
+            }
+
+            const auto radius_squared = static_cast<distance_t>(radius * radius);
+
+            const auto push = [&result, &radius_squared](const distance_t &distance, const std::size_t input_index)
+            {
+                if (!(radius_squared < distance))
+                {
+                    result.emplace_back(distance, input_index);
+                }
+            };
+
+            const auto can_improve = [&radius_squared](const distance_t &bound)
+            {
+                return !(radius_squared < bound);
+            };
+
+            search(query, push, can_improve);
+        }
+
+private:
+        [[nodiscard]] static constexpr auto dimension(const std::size_t index) -> std::int32_t
+        {
+            const auto depth = std::bit_width(index + 1U) - 1U;
+            return static_cast<std::int32_t>(depth % static_cast<std::uint32_t>(dimensions));
+        }
+
+        [[nodiscard]] static constexpr auto squared_distance(const point_t &one, const point_t &two) -> distance_t
+        {
+            distance_t sum{};
+
+            for (std::int32_t dim{}; dim < dimensions; ++dim)
+            {
+                const auto diff = static_cast<distance_t>(one[dim]) - static_cast<distance_t>(two[dim]);
+                sum += diff * diff;
+            }
+
+            return sum;
+        }
+
+        // The left subtree size of a complete binary tree of "size" nodes.
+        [[nodiscard]] static constexpr auto left_size(const std::size_t size) -> std::size_t
+        {
+            assert(0U < size);
+
+            if (size == 1U)
+            {
+                return 0U;
+            }
+
+            const auto height = std::bit_width(size) - 1U; // The last level number.
+            const auto half_last_level = std::size_t{ 1 } << (height - 1U);
+            const auto last_level_count = size - ((std::size_t{ 1 } << height) - 1U);
+
+            return half_last_level - 1U + std::min(last_level_count, half_last_level);
+        }
+
+        // A subtree at the BFS "index" of the points work[begin..end).
+        struct subtree final
+        {
+            std::size_t index{};
+            std::size_t begin{};
+            std::size_t end{};
+        };
+
+        // Place the median, and return the 2 child subtrees.
+        constexpr auto split(std::vector<node_t> &work, const subtree &tree) -> std::array<subtree, 2>
+        {
+            assert(tree.begin < tree.end && tree.index < Nodes.size());
+
+            const auto dim = dimension(tree.index);
+            const auto middle = tree.begin + left_size(tree.end - tree.begin);
+
+            const auto first = work.begin();
+
+            std::nth_element(first + static_cast<std::ptrdiff_t>(tree.begin),
+                first + static_cast<std::ptrdiff_t>(middle), first + static_cast<std::ptrdiff_t>(tree.end),
+                [dim](const node_t &one, const node_t &two)
+                {
+                    return one.first[dim] < two.first[dim];
+                });
+
+            Nodes[tree.index] = work[middle];
+
+            return { subtree{ tree.index * 2U + 1U, tree.begin, middle },
+                subtree{ tree.index * 2U + 2U, middle + 1U, tree.end } };
+        }
+
+        constexpr void build_sequential(std::vector<node_t> &work, const subtree &tree)
+        {
+            if (tree.begin == tree.end)
+            {
+                return;
+            }
+
+            const auto children = split(work, tree);
+
+            build_sequential(work, children[0]);
+            build_sequential(work, children[1]);
+        }
+
+        // The subtrees own disjoint parts of both the "work" and the "Nodes".
+        // The sizes of the subtrees in a level do not increase from left to right,
+        // so the last one is the smallest, and no empty subtree is split.
+        void build(std::vector<node_t> &work, const std::size_t parallel_min_size)
+        {
+            std::vector<subtree> level{ subtree{ 0U, 0U, work.size() } };
+            std::vector<subtree> next_level;
+
+            const auto enough_subtrees = omp_thread_count() * 4U;
+
+            while (level.size() < enough_subtrees && parallel_min_size <= level.back().end - level.back().begin)
+            {
+                next_level.resize(level.size() * 2U);
+
+                const auto count = static_cast<std::int64_t>(level.size());
+
+#pragma omp parallel for default(none) shared(work, level, next_level, count) schedule(static)
+                for (std::int64_t position = 0; position < count; ++position)
+                {
+                    const auto children = split(work, level[position]);
+
+                    next_level[position * 2] = children[0];
+                    next_level[position * 2 + 1] = children[1];
+                }
+
+                std::swap(level, next_level);
+            }
+
+            const auto count = static_cast<std::int64_t>(level.size());
+
+#pragma omp parallel for default(none) shared(work, level, count) schedule(dynamic, 1)
+            for (std::int64_t position = 0; position < count; ++position)
+            {
+                build_sequential(work, level[position]);
+            }
+        }
+
+        // Depth first, the child on the query side first.
+        // The far child is skipped when its slab is farther than the current bound.
+        template<class push_t, class can_improve_t>
+        constexpr void search(const point_t &query, const push_t &push, const can_improve_t &can_improve) const
+        {
+            if (Nodes.empty())
+            {
+                return;
+            }
+
+            // The index, and the squared distance to the slab of the subtree.
+            std::array<std::pair<std::size_t, distance_t>, max_stack_size> stack{};
+            std::size_t stack_size = 1;
+
+            while (0U < stack_size)
+            {
+                const auto [index, bound] = stack[--stack_size];
+
+                if (!can_improve(bound))
+                {
+                    continue;
+                }
+
+                const auto &node = Nodes[index];
+                push(squared_distance(query, node.first), node.second);
+
+                const auto dim = dimension(index);
+                const auto diff = static_cast<distance_t>(query[dim]) - static_cast<distance_t>(node.first[dim]);
+                const auto is_left_near = diff < distance_t{};
+
+                const auto near = index * 2U + (is_left_near ? 1U : 2U);
+                const auto far = index * 2U + (is_left_near ? 2U : 1U);
+
+                if (far < Nodes.size())
+                {
+                    stack[stack_size++] = { far, std::max(bound, static_cast<distance_t>(diff * diff)) };
+                }
+
+                if (near < Nodes.size())
+                {
+                    stack[stack_size++] = { near, bound };
+                }
+            }
+        }
+
+        std::vector<node_t> Nodes;
+    };
+} // namespace Standard::Algorithms::Trees
@@ -1,9 +1,178 @@
 #include"k_d_tree_tests.h"
 #include"k_d_tree.h"
+#include"k_d_tree_flat.h"
 #include"multiway_search_tree_tests.h"
+#include<array>
+
+namespace
+{
+    constexpr auto flat_dimensions = 3;
+
+    // Few distinct coordinates make many ties.
+    constexpr std::int32_t max_coordinate = 30;
+
+    using flat_point_t = std::array<std::int32_t, flat_dimensions>;
+    using distance_t = std::int64_t;
+    using flat_tree_t = Standard::Algorithms::Trees::k_d_tree_flat<flat_point_t, flat_dimensions, distance_t>;
+    using result_t = std::vector<std::pair<distance_t, std::size_t>>;
+
+    [[nodiscard]] constexpr auto squared_distance_slow(const flat_point_t &one, const flat_point_t &two) -> distance_t
+    {
+        distance_t sum{};
+
+        for (std::int32_t dim{}; dim < flat_dimensions; ++dim)
+        {
+            const auto diff = static_cast<distance_t>(one[dim]) - two[dim];
+            sum += diff * diff;
+        }
+
+        return sum;
+    }
+
+    // Several points can be at the same distance, so only the distances are compared.
+    void nearest_subtest(const std::vector<flat_point_t> &points, const flat_tree_t &tree,
+        const flat_point_t &query, const std::size_t count, result_t &actual)
+    {
+        std::vector<distance_t> expected;
+
+        for (const auto &point : points)
+        {
+            expected.push_back(squared_distance_slow(query, point));
+        }
+
+        std::sort(expected.begin(), expected.end());
+        expected.resize(std::min(count, expected.size()));
+
+        tree.nearest(query, count, actual);
+
+        std::vector<distance_t> actual_distances;
+
+        for (const auto &[distance, input_index] : actual)
+        {
+            Standard::Algorithms::require_greater(points.size(), input_index, "nearest input index");
+
+            ::Standard::Algorithms::ert::are_equal(
+                squared_distance_slow(query, points[input_index]), distance, "nearest distance");
+
+            actual_distances.push_back(distance);
+        }
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual_distances, "nearest distances");
+    }
+
+    void radius_subtest(const std::vector<flat_point_t> &points, const flat_tree_t &tree,
+        const flat_point_t &query, const distance_t &radius, result_t &actual)
+    {
+        result_t expected;
+
+        for (std::size_t index{}; index < points.size(); ++index)
+        {
+            if (const auto distance = squared_distance_slow(query, points[index]); distance <= radius * radius)
+            {
+                expected.emplace_back(distance, index);
+            }
+        }
+
+        tree.within_radius(query, radius, actual);
+        std::sort(actual.begin(), actual.end());
+        std::sort(expected.begin(), expected.end());
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "within radius");
+    }
+
+    void range_subtest(const std::vector<flat_point_t> &points, const flat_tree_t &tree, flat_point_t low,
+        flat_point_t high, std::vector<std::size_t> &actual)
+    {
+        for (std::int32_t dim{}; dim < flat_dimensions; ++dim)
+        {
+            if (high[dim] < low[dim])
+            {
+                std::swap(low[dim], high[dim]);
+            }
+        }
+
+        const std::pair<const flat_point_t &, const flat_point_t &> limits{ low, high };
+
+        std::vector<std::size_t> expected;
+
+        for (std::size_t index{}; index < points.size(); ++index)
+        {
+            if (Standard::Algorithms::Trees::is_between<flat_dimensions, flat_point_t>(points[index], limits))
+            {
+                expected.push_back(index);
+            }
+        }
+
+        actual.clear();
+
+        auto visit = [&actual](const typename flat_tree_t::node_t &node)
+        {
+            actual.push_back(node.second);
+        };
+
+        tree.find(low, visit, high);
+        std::sort(actual.begin(), actual.end());
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "range find");
+    }
+
+    void k_d_tree_flat_tests()
+    {
+        constexpr auto steps = 5;
+        constexpr auto max_size = 2'000;
+        constexpr auto queries = 20;
+
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+        result_t actual;
+        std::vector<std::size_t> actual_indexes;
+
+        for (std::int32_t step{}; step < steps; ++step)
+        {
+            const auto size = rnd(0, max_size);
+
+            const auto random_point = [&rnd]
+            {
+                flat_point_t point{};
+
+                for (auto &coord : point)
+                {
+                    coord = rnd(-max_coordinate, max_coordinate);
+                }
+
+                return point;
+            };
+
+            std::vector<flat_point_t> points(size);
+            std::generate(points.begin(), points.end(), random_point);
+
+            const flat_tree_t tree(points);
+            ::Standard::Algorithms::ert::are_equal(points.size(), tree.size(), "flat tree size");
+
+            // The default parallel min size is never reached here.
+            const flat_tree_t parallel_tree(points, static_cast<std::size_t>(rnd(1, 64)));
+            ::Standard::Algorithms::ert::are_equal(
+                true, tree.nodes() == parallel_tree.nodes(), "flat tree built in parallel");
+
+            for (std::int32_t query{}; query < queries; ++query)
+            {
+                const auto center = random_point();
+
+                for (const auto *const built : { &tree, &parallel_tree })
+                {
+                    nearest_subtest(points, *built, center, static_cast<std::size_t>(rnd(0, 10)), actual);
+                    radius_subtest(points, *built, center, rnd(0, max_coordinate), actual);
+                    range_subtest(points, *built, center, random_point(), actual_indexes);
+                }
+            }
+        }
+    }
+} // namespace
 
 void Standard::Algorithms::Trees::Tests::k_d_tree_tests()
 {
     using tree_t = Standard::Algorithms::Trees::k_d_tree<tuple_t, dimensions>;
     multiway_search_tree_tests<tree_t>();
+
+    k_d_tree_flat_tests();
 }
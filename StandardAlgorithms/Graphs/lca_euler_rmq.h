@@ -0,0 +1,275 @@
+#pragma once
+#include"../Numbers/logarithm.h"
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/require_utilities.h"
+#include"euler_tour.h"
+#include<algorithm>
+#include<array>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Trees
+{
+    // Online lowest common ancestor LCA in O(1) time per query, due to
+    // Bender, Farach-Colton: the LCA of 2 nodes is the min depth node in the Euler tour between their first visits.
+    // The adjacent tour depths differ by +-1, so the tour is cut into blocks of 8 items;
+    // a block is one of 2**7 types by the +-1 steps, and the min inside any block range is read from
+    // a shared table of 128*8*8 bytes. The block minimums are queried by a sparse table.
+    // Unlike the original blocks of log(n)/2 items, which make the space truly linear,
+    // the fixed 8 keeps the in-block table constant, and the offsets in bytes;
+    // the sparse table then has n/8 * log(n) items, fewer than 4 per tour item for any 32-bit tour.
+    // Zero based nodes.
+    // Time and space O(n + n/8 * log(n)) to preprocess.
+    template<class edge_t = std::int32_t>
+    struct lca_euler_rmq final
+    {
+        static constexpr std::int32_t block_size = 8;
+
+        constexpr explicit lca_euler_rmq(const std::vector<std::vector<edge_t>> &tree, const std::int32_t root = 0)
+        {
+            std::vector<std::int32_t> depths;
+            Standard::Algorithms::Graphs::euler_tour_tree(tree, root, Tour, First_times, depths);
+
+            const auto tour_size = static_cast<std::int32_t>(Tour.size());
+            const auto block_count = (tour_size + block_size - 1) / block_size;
+
+            Tour_depths.resize(block_count * static_cast<std::size_t>(block_size));
+
+            for (std::int32_t index{}; index < tour_size; ++index)
+            {
+                Tour_depths[index] = depths[Tour[index]];
+            }
+
+            // The padding goes up to keep the +-1 steps; it is never queried.
+            for (auto index = tour_size; index < static_cast<std::int32_t>(Tour_depths.size()); ++index)
+            {
+                Tour_depths[index] = Tour_depths[index - 1] + 1;
+            }
+
+            build_in_block_table();
+            build_blocks(block_count);
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::int32_t
+        {
+            return static_cast<std::int32_t>(First_times.size());
+        }
+
+        // Time O(1).
+        [[nodiscard]] constexpr auto lca(const std::int32_t one, const std::int32_t two) const -> std::int32_t
+        {
+            assert(!(one < 0) && one < size() && !(two < 0) && two < size());
+
+            auto start = First_times[one];
+            auto stop = First_times[two];
+
+            if (stop < start)
+            {
+                std::swap(start, stop);
+            }
+
+            return Tour[min_index(start, stop)];
+        }
+
+        // Answer many queries in parallel; "answers[index]" is the LCA of "queries[index]".
+        // The queries are first turned into the tour ranges, and sorted by the range start with a counting sort,
+        // so that the nearby ranges share the cache lines of the tour and the sparse table.
+        // Time O(q + n).
+        void lca_batch(const std::vector<std::pair<std::int32_t, std::int32_t>> &queries,
+            std::vector<std::int32_t> &answers) const
+        {
+            const auto query_count = static_cast<std::int64_t>(queries.size());
+            answers.resize(queries.size());
+
+            if (query_count == 0)
+            {
+                return;
+            }
+
+            // There are at most as many buckets as queries.
+            const auto tour_size = static_cast<std::int64_t>(Tour.size());
+
+            std::uint32_t shift{};
+
+            while (query_count < ((tour_size - 1) >> shift) + 1)
+            {
+                ++shift;
+            }
+
+            std::vector<std::int64_t> bucket_starts(((tour_size - 1) >> shift) + 2);
+            std::vector<std::pair<std::int32_t, std::int32_t>> ranges(queries.size());
+
+            for (std::int64_t index{}; index < query_count; ++index)
+            {
+                const auto &[one, two] = queries[index];
+                assert(!(one < 0) && one < size() && !(two < 0) && two < size());
+
+                auto &range = ranges[index];
+                range = std::minmax(First_times[one], First_times[two]);
+
+                ++bucket_starts[(range.first >> shift) + 1U];
+            }
+
+            for (std::size_t index = 1; index < bucket_starts.size(); ++index)
+            {
+                bucket_starts[index] += bucket_starts[index - 1U];
+            }
+
+            // The range, and the query index.
+            std::vector<std::pair<std::pair<std::int32_t, std::int32_t>, std::int64_t>> sorted(queries.size());
+
+            for (std::int64_t index{}; index < query_count; ++index)
+            {
+                const auto &range = ranges[index];
+                sorted[bucket_starts[range.first >> shift]++] = { range, index };
+            }
+
+#pragma omp parallel for default(none) shared(answers, sorted, query_count) schedule(static)
+            for (std::int64_t position = 0; position < query_count; ++position)
+            {
+                const auto &[range, index] = sorted[position];
+
+                answers[index] = Tour[min_index(range.first, range.second)];
+            }
+        }
+
+private:
+        // The index of the min depth in Tour_depths[start..stop], both inclusive.
+        [[nodiscard]] constexpr auto min_index(const std::int32_t start, const std::int32_t stop) const -> std::int32_t
+        {
+            assert(!(start < 0) && start <= stop && stop < static_cast<std::int32_t>(Tour.size()));
+
+            const auto start_block = start / block_size;
+            const auto stop_block = stop / block_size;
+
+            if (start_block == stop_block)
+            {
+                return in_block_min(start_block, start % block_size, stop % block_size);
+            }
+
+            auto best = in_block_min(start_block, start % block_size, block_size - 1);
+
+            if (const auto cand = in_block_min(stop_block, 0, stop % block_size);
+                Tour_depths[cand] < Tour_depths[best])
+            {
+                best = cand;
+            }
+
+            if (start_block + 1 < stop_block)
+            {
+                if (const auto cand = blocks_min(start_block + 1, stop_block - 1);
+                    Tour_depths[cand] < Tour_depths[best])
+                {
+                    best = cand;
+                }
+            }
+
+            return best;
+        }
+
+        [[nodiscard]] constexpr auto in_block_min(
+            const std::int32_t block, const std::int32_t start, const std::int32_t stop) const -> std::int32_t
+        {
+            assert(!(start < 0) && start <= stop && stop < block_size);
+
+            const auto &offset = In_block[Block_types[block]][start][stop];
+            return block * block_size + offset;
+        }
+
+        // The min depth tour index among the blocks [start_block..stop_block].
+        [[nodiscard]] constexpr auto blocks_min(const std::int32_t start_block, const std::int32_t stop_block) const
+            -> std::int32_t
+        {
+            assert(!(start_block < 0) && start_block <= stop_block);
+
+            const auto width = static_cast<std::uint32_t>(stop_block - start_block + 1);
+            const auto level = static_cast<std::size_t>(::Standard::Algorithms::Numbers::log_base_2_down(width));
+
+            const auto &mins = Sparse[level];
+            const auto &one = mins[start_block];
+            const auto &two = mins[stop_block + 1 - (1 << level)];
+
+            return Tour_depths[two] < Tour_depths[one] ? two : one;
+        }
+
+        // For all 128 block types, the min offset of every in-block range.
+        constexpr void build_in_block_table()
+        {
+            for (std::uint32_t type{}; type < In_block.size(); ++type)
+            {
+                for (std::int32_t start{}; start < block_size; ++start)
+                {
+                    std::int32_t depth{};
+                    std::int32_t min_depth{};
+                    auto best = start;
+
+                    In_block[type][start][start] = static_cast<std::uint8_t>(start);
+
+                    for (auto stop = start + 1; stop < block_size; ++stop)
+                    {
+                        const auto is_up = ((type >> static_cast<std::uint32_t>(stop - 1)) & 1U) != 0U;
+                        depth += is_up ? 1 : -1;
+
+                        if (depth < min_depth)
+                        {
+                            min_depth = depth, best = stop;
+                        }
+
+                        In_block[type][start][stop] = static_cast<std::uint8_t>(best);
+                    }
+                }
+            }
+        }
+
+        constexpr void build_blocks(const std::int32_t block_count)
+        {
+            Block_types.resize(block_count);
+            Sparse.assign(1, std::vector<std::int32_t>(block_count));
+
+            for (std::int32_t block{}; block < block_count; ++block)
+            {
+                const auto first = block * block_size;
+                std::uint8_t type{};
+
+                for (std::int32_t index = 1; index < block_size; ++index)
+                {
+                    if (Tour_depths[first + index - 1] < Tour_depths[first + index])
+                    {
+                        type |= static_cast<std::uint8_t>(1U << static_cast<std::uint32_t>(index - 1));
+                    }
+                }
+
+                Block_types[block] = type;
+                Sparse[0][block] = first + In_block[type][0][block_size - 1];
+            }
+
+            for (std::int32_t width = 2; width <= block_count; width *= 2)
+            {
+                const auto &prevs = Sparse.back();
+                std::vector<std::int32_t> currs(block_count - width + 1);
+
+                for (std::int32_t block{}; block < static_cast<std::int32_t>(currs.size()); ++block)
+                {
+                    const auto &one = prevs[block];
+                    const auto &two = prevs[block + width / 2];
+                    currs[block] = Tour_depths[two] < Tour_depths[one] ? two : one;
+                }
+
+                Sparse.push_back(std::move(currs));
+            }
+        }
+
+        std::vector<std::int32_t> Tour{};
+        std::vector<std::int32_t> First_times{};
+        std::vector<std::int32_t> Tour_depths{};
+
+        std::array<std::array<std::array<std::uint8_t, block_size>, block_size>, 1U << (block_size - 1U)> In_block{};
+        std::vector<std::uint8_t> Block_types{};
+
+        // The min depth tour index of 2**level blocks starting from a block.
+        std::vector<std::vector<std::int32_t>> Sparse{};
+    };
+} // namespace Standard::Algorithms::Trees
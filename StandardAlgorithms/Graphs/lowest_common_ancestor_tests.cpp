@@ -1,6 +1,8 @@
 #include"lowest_common_ancestor_tests.h"
+#include"../Utilities/random.h"
 #include"../Utilities/test_utilities.h"
 #include"euler_tour.h"
+#include"lca_euler_rmq.h"
 #include"lowest_common_ancestor.h"
 #include"lowest_common_ancestor_offline_fast.h"
 #include"simple_binary_lca.h"
@@ -131,6 +133,95 @@ namespace
 
         return tests;
     }
+
+    using lca_t =
+        Standard::Algorithms::Trees::lowest_common_ancestor<std::int32_t, std::int32_t (*)(const std::int32_t &)>;
+
+    // The "tree" is zero based, the "lca2" is one based.
+    void check_lca_euler_rmq(
+        const std::string &name, const std::vector<std::vector<std::int32_t>> &tree, const lca_t &lca2)
+    {
+        const auto size = static_cast<std::int32_t>(tree.size());
+        const Standard::Algorithms::Trees::lca_euler_rmq<std::int32_t> fast(tree);
+
+        ::Standard::Algorithms::ert::are_equal(size, fast.size(), name + " lca_euler_rmq size");
+
+        std::vector<std::pair<std::int32_t, std::int32_t>> queries;
+
+        for (std::int32_t one{}; one < size; ++one)
+        {
+            for (std::int32_t two{}; two < size; ++two)
+            {
+                const auto expected = lca2.lca(one + 1, two + 1) - 1;
+                const auto actual = fast.lca(one, two);
+
+                if (expected != actual) [[unlikely]]
+                {
+                    ::Standard::Algorithms::ert::are_equal(expected, actual,
+                        name + " lca_euler_rmq " + std::to_string(one) + ", " + std::to_string(two));
+                }
+
+                queries.emplace_back(one, two);
+            }
+        }
+
+        std::vector<std::int32_t> answers;
+        fast.lca_batch(queries, answers);
+
+        ::Standard::Algorithms::ert::are_equal(queries.size(), answers.size(), name + " lca_batch size");
+
+        for (std::size_t index{}; index < queries.size(); ++index)
+        {
+            const auto &[one, two] = queries[index];
+
+            if (const auto expected = fast.lca(one, two); expected != answers[index]) [[unlikely]]
+            {
+                ::Standard::Algorithms::ert::are_equal(expected, answers[index],
+                    name + " lca_batch " + std::to_string(one) + ", " + std::to_string(two));
+            }
+        }
+    }
+
+    void lca_euler_rmq_random_tests()
+    {
+        constexpr auto steps = 5;
+        constexpr auto max_size = 100;
+
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+        for (std::int32_t step{}; step < steps; ++step)
+        {
+            const auto size = rnd(1, max_size);
+
+            // A random parent, or mostly a path to test the deep trees.
+            const auto is_deep = rnd(0, 1) == 0;
+
+            std::vector<std::vector<std::int32_t>> tree(size);
+
+            for (std::int32_t node = 1; node < size; ++node)
+            {
+                const auto parent = is_deep && rnd(0, 3) != 0 ? node - 1 : rnd(0, node - 1);
+
+                tree[parent].push_back(node);
+                tree[node].push_back(parent);
+            }
+
+            lca_t lca2(&Standard::Algorithms::Trees::node_to<std::int32_t>);
+            auto &tree2 = lca2.reset(std::max(2, size));
+
+            for (std::int32_t from{}; from < size; ++from)
+            {
+                for (const auto &tod : tree[from])
+                {
+                    tree2[from + 1LL].push_back(tod + 1);
+                }
+            }
+
+            lca2.dfs(1);
+
+            check_lca_euler_rmq("random " + std::to_string(size), tree, lca2);
+        }
+    }
 } // namespace
 
 void Standard::Algorithms::Trees::Tests::lowest_common_ancestor_tests()
@@ -308,4 +399,19 @@ void Standard::Algorithms::Trees::Tests::lca_euler_tour_tests()
     }
 
     ::Standard::Algorithms::ert::are_equal(expected_tour, tour2, "euler_tour2");
+
+    {
+        std::vector<std::int32_t> tour3;
+        std::vector<std::int32_t> times3;
+        std::vector<std::int32_t> depths3;
+
+        Standard::Algorithms::Graphs::euler_tour_tree(tree, 0, tour3, times3, depths3);
+
+        ::Standard::Algorithms::ert::are_equal(expected_tour, tour3, "euler_tour_tree");
+        ::Standard::Algorithms::ert::are_equal(expected_times, times3, "euler_tour_tree first times");
+    }
+
+    check_lca_euler_rmq("euler tour tree", tree, lca2);
+
+    lca_euler_rmq_random_tests();
 }
@@ -2,7 +2,9 @@
 #include"../Numbers/hash_utilities.h"
 #include"../Utilities/random.h"
 #include"../Utilities/test_utilities.h"
+#include"create_random_graph.h"
 #include"graph_helper.h"
+#include"hopcroft_karp_csr.h"
 #include"max_2c_matching_karzanov_hopcroft_karp.h"
 #include<unordered_set>
 
@@ -181,6 +183,42 @@ private:
             { { 1, 2 }, { 2, 1 }, { 3, 3 } } });
     }
 
+    using csr_int_t = std::int32_t;
+    using csr_matching_t = Standard::Algorithms::Graphs::hopcroft_karp_csr<csr_int_t>;
+    using csr_edge_t = typename csr_matching_t::edge_t;
+
+    void check_csr_matching(const std::string &name, const std::vector<std::vector<csr_int_t>> &left_neighbors,
+        const csr_int_t right_size, const std::size_t expected_size)
+    {
+        const auto left_size = static_cast<csr_int_t>(left_neighbors.size());
+
+        csr_matching_t csr(left_neighbors, right_size);
+
+        for (const auto use_greedy_init : { true, false })
+        {
+            const auto suffix = name + (use_greedy_init ? " Karp-Sipser" : " no greedy init");
+
+            std::vector<csr_edge_t> matchings;
+            const auto actual = csr.max_matching(matchings, use_greedy_init);
+
+            ::Standard::Algorithms::ert::are_equal(expected_size, actual, suffix + " hopcroft_karp_csr size");
+            ::Standard::Algorithms::ert::are_equal(expected_size, matchings.size(), suffix + " matchings size");
+
+            demand_bipartite_matching(left_size, matchings, right_size);
+
+            for (const auto &[from, tod] : matchings)
+            {
+                const auto &rights = left_neighbors.at(from);
+
+                if (std::find(rights.cbegin(), rights.cend(), tod) == rights.cend()) [[unlikely]]
+                {
+                    throw std::runtime_error(suffix + " the matching edge {" + std::to_string(from) + ", " +
+                        std::to_string(tod) + "} is not in the graph.");
+                }
+            }
+        }
+    }
+
     void run_test_case(const test_case &test)
     {
         max_matching_t graph({ test.left_size(), test.right_size() });
@@ -194,10 +232,58 @@ private:
         graph.max_matching(matchings);
 
         ::Standard::Algorithms::ert::are_equal(test.expected_matchings(), matchings, "max matching");
+
+        // The CSR variant is 0-based.
+        std::vector<std::vector<csr_int_t>> left_neighbors(test.left_size());
+
+        for (const auto &edge : test.edges())
+        {
+            left_neighbors[edge.first - 1U].push_back(static_cast<csr_int_t>(edge.second - 1U));
+        }
+
+        check_csr_matching(test.name(), left_neighbors, static_cast<csr_int_t>(test.right_size()),
+            test.expected_matchings().size());
+    }
+
+    void random_tests()
+    {
+        constexpr auto steps = 10;
+        constexpr csr_int_t max_size = 200;
+
+        Standard::Algorithms::Utilities::random_t<csr_int_t> rnd{};
+
+        for (auto step = 0; step < steps; ++step)
+        {
+            const auto left_size = rnd(1, max_size);
+            const auto right_size = rnd(1, max_size);
+            const auto edge_count = rnd(0, left_size * 3);
+
+            const auto left_neighbors = Standard::Algorithms::Graphs::create_random_bipartite_graph<csr_int_t>(
+                left_size, right_size, edge_count);
+
+            max_matching_t graph({ static_cast<int_t>(left_size), static_cast<int_t>(right_size) });
+
+            for (csr_int_t from{}; from < left_size; ++from)
+            {
+                for (const auto &tod : left_neighbors[from])
+                {
+                    graph.add_edge({ static_cast<int_t>(from + 1), static_cast<int_t>(tod + 1) });
+                }
+            }
+
+            std::vector<edge_t> matchings;
+            graph.max_matching(matchings);
+
+            const auto name = "random " + std::to_string(left_size) + " x " + std::to_string(right_size);
+
+            check_csr_matching(name, left_neighbors, right_size, matchings.size());
+        }
     }
 } // namespace
 
 void Standard::Algorithms::Graphs::Tests::max_2c_matching_karzanov_hopcroft_karp_tests()
 {
     Standard::Algorithms::Tests::test_utilities<test_case>::run_tests(run_test_case, generate_test_cases);
+
+    random_tests();
 }
@@ -2,11 +2,13 @@
 #include"../Utilities/random.h"
 #include"../Utilities/test_utilities.h"
 #include"create_random_graph.h"
-#include"dinic_flow_old.h"
+#include"dinic_flow.h"
 #include"edmonds_karp_flow.h"
 #include"flow_edge.h"
 #include"max_flow_graph.h"
+#include"min_cost_flow_graph.h"
 #include"min_cost_max_flow_graph.h"
+#include"push_relabel_flow.h"
 #include"weighted_vertex.h"
 #include<unordered_map>
 
@@ -201,19 +203,6 @@ namespace
 
         const auto has_flow = 0 < expected_flow;
         {
-            // std::vector<std::vector<test_edge_t>> actualFlows;
-
-            // const auto actual_flow = PushRelabelMaxFlow<weight_t, test_edge_t>::Compute(graph, sourceIndex,
-            // actualFlows, sink);
-
-            // if (has_flow)
-            //{
-            //     ::Standard::Algorithms::ert::are_equal(expectedFlow, actual_flow, name + " Push-Relabel Total flow");
-            // todo(p3): finish. ::Standard::Algorithms::ert::are_equal(expected_flows, actualFlows, "Flows");
-            // }
-            // else
-            //     expectedFlow = actual_flow;
-        } {
             auto lam = [source_index, sink] [[nodiscard]] (std::vector<std::vector<edge_t>> & graph2)
             {
                 const auto flo = edmonds_karp_flow<weight_t>(source_index, graph2, sink);
@@ -230,11 +219,39 @@ namespace
         {
             auto lam = [source_index, sink] [[nodiscard]] (std::vector<std::vector<edge_t>> & graph2)
             {
-                const auto actual_flow = dinic_flow_old<weight_t>(source_index, graph2, sink);
+                const auto flo = push_relabel_flow<weight_t>(source_index, graph2, sink);
+                return flo;
+            };
+
+            const auto actual_flow =
+                run_alg(name + " Push-Relabel", graph, expected_flow, expected_flows, lam, has_flow);
+            ::Standard::Algorithms::ert::are_equal(expected_flow, actual_flow, name + " Push-Relabel flow");
+        }
+        {
+            auto lam = [source_index, sink] [[nodiscard]] (std::vector<std::vector<edge_t>> & graph2)
+            {
+                const auto actual_flow = dinic_flow<weight_t>(source_index, graph2, sink);
                 return actual_flow;
             };
 
-            run_alg(name + " Dinic", graph, expected_flow, expected_flows, lam, has_flow);
+            const auto actual_flow = run_alg(name + " Dinic", graph, expected_flow, expected_flows, lam, has_flow);
+            ::Standard::Algorithms::ert::are_equal(expected_flow, actual_flow, name + " Dinic flow");
+        }
+        {
+            auto lam = [source_index, sink] [[nodiscard]] (std::vector<std::vector<edge_t>> & graph2)
+            {
+                constexpr auto use_capacity_scaling = true;
+
+                const auto actual_flow = dinic_flow<weight_t>(source_index, graph2, sink, use_capacity_scaling);
+                return actual_flow;
+            };
+
+            // The flow may take other edges; the flows are validated in flow_test_random_large.
+            constexpr auto check_flows = false;
+
+            const auto actual_flow =
+                run_alg(name + " Dinic scaling", graph, expected_flow, expected_flows, lam, check_flows);
+            ::Standard::Algorithms::ert::are_equal(expected_flow, actual_flow, name + " Dinic scaling flow");
         }
         {
             Standard::Algorithms::Graphs::max_flow_graph<weight_t, max_size, edge_t> graph2(source_index, sink, size);
@@ -263,6 +280,19 @@ namespace
                 check_edge_flows(name2, expected_flows, graph2.graph(), size);
             }
         }
+        for (const auto &use_cost_scaling : { false, true })
+        {
+            Standard::Algorithms::Graphs::min_cost_flow_graph<weight_t, cost_t, edge_t> graph2;
+            graph2.init(size);
+            add_adges(graph, graph2);
+
+            const auto name2 = name + (use_cost_scaling ? " min_cost_flow_graph cost scaling" : " min_cost_flow_graph");
+            const auto mfc = use_cost_scaling ? graph2.min_cost_max_flow_cost_scaling(source_index, sink)
+                                              : graph2.min_cost_max_flow(source_index, sink);
+
+            ::Standard::Algorithms::ert::are_equal(expected_flow, mfc.first, name2 + " flow");
+            ::Standard::Algorithms::ert::are_equal(cost_t{}, mfc.second, name2 + " cost");
+        }
     }
 
     constexpr void flow_test1()
@@ -435,6 +465,118 @@ namespace
         }
     }
 
+    // Capacity, skew symmetry, and conservation.
+    void check_valid_flow(const std::string &name, const std::vector<std::vector<edge_t>> &graph,
+        const std::int32_t source, const std::int32_t sink, const weight_t &total_flow)
+    {
+        const auto size = static_cast<std::int32_t>(graph.size());
+
+        for (std::int32_t from{}; from < size; ++from)
+        {
+            weight_t out_flow{};
+
+            for (const auto &edge : graph[from])
+            {
+                Standard::Algorithms::require_less_equal(edge.flow, edge.capacity, name + " capacity");
+
+                const auto &rev = graph[edge.to][edge.rev_edge_index];
+                ::Standard::Algorithms::ert::are_equal(-edge.flow, rev.flow, name + " reverse flow");
+
+                out_flow += edge.flow;
+            }
+
+            const auto expected = from == source ? total_flow : from == sink ? -total_flow : weight_t{};
+
+            ::Standard::Algorithms::ert::are_equal(
+                expected, out_flow, name + " conservation at " + std::to_string(from));
+        }
+    }
+
+    // Larger graphs than the max_size.
+    void flow_test_random_large()
+    {
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+        constexpr auto steps = 10;
+        constexpr auto max_vertices = 300;
+
+        for (std::int32_t step{}; step < steps; ++step)
+        {
+            const auto size = rnd(2, max_vertices);
+            const auto max_capacity = rnd(1, 2) == 1 ? 1 : 1'000;
+
+            std::vector<std::vector<test_edge_t>> graph(size);
+            std::vector<std::unordered_map<std::int32_t, std::int32_t>> uniques(size);
+
+            const auto edge_count = rnd(0, size * 6);
+
+            for (std::int32_t index{}; index < edge_count; ++index)
+            {
+                const auto from = rnd(0, size - 1);
+                const auto tod = rnd(0, size - 1);
+
+                if (from != tod && uniques[from].emplace(tod, 0).second)
+                {
+                    graph[from].emplace_back(tod, rnd(0, max_capacity));
+                }
+            }
+
+            const auto source = rnd(0, size - 1);
+            auto sink = rnd(0, size - 2);
+            sink += source <= sink ? 1 : 0;
+
+            const auto name = "flow_test_random_large size " + std::to_string(size);
+
+            auto expected_graph = to_flow_graph(graph);
+            const auto expected = edmonds_karp_flow<weight_t>(source, expected_graph, sink);
+            check_valid_flow(name + " Edmonds-Karp", expected_graph, source, sink, expected);
+
+            auto actual_graph = to_flow_graph(graph);
+            const auto actual = push_relabel_flow<weight_t>(source, actual_graph, sink);
+            ::Standard::Algorithms::ert::are_equal(expected, actual, name + " Push-Relabel");
+            check_valid_flow(name + " Push-Relabel", actual_graph, source, sink, actual);
+
+            for (const auto &use_capacity_scaling : { false, true })
+            {
+                const auto name2 = name + (use_capacity_scaling ? " Dinic scaling" : " Dinic");
+
+                auto dinic_graph = to_flow_graph(graph);
+                const auto dinic = dinic_flow<weight_t>(source, dinic_graph, sink, use_capacity_scaling);
+                ::Standard::Algorithms::ert::are_equal(expected, dinic, name2);
+                check_valid_flow(name2, dinic_graph, source, sink, dinic);
+            }
+        }
+    }
+
+    // A recursive DFS might overflow the stack on a long path.
+    void flow_test_long_path()
+    {
+        constexpr auto size = 100'000;
+        constexpr weight_t max_capacity = 1'000;
+
+        Standard::Algorithms::Utilities::random_t<weight_t> rnd(1, max_capacity);
+
+        std::vector<std::vector<test_edge_t>> graph(size);
+        auto expected = max_capacity;
+
+        for (std::int32_t from{}; from < size - 1; ++from)
+        {
+            const auto capacity = rnd();
+            graph[from].emplace_back(from + 1, capacity);
+            expected = std::min(expected, capacity);
+        }
+
+        for (const auto &use_capacity_scaling : { false, true })
+        {
+            const auto name = std::string("flow_test_long_path") + (use_capacity_scaling ? " Dinic scaling" : " Dinic");
+
+            auto flow_graph = to_flow_graph(graph);
+            const auto actual = dinic_flow<weight_t>(0, flow_graph, size - 1, use_capacity_scaling);
+            ::Standard::Algorithms::ert::are_equal(expected, actual, name);
+            check_valid_flow(name, flow_graph, 0, size - 1, actual);
+        }
+    }
+
     constexpr void min_cost_test()
     {
         constexpr auto size = 5;
@@ -478,6 +620,129 @@ namespace
         };
 
         check_edge_flows(name, expected_flows, graph.graph(), size);
+
+        for (const auto &use_cost_scaling : { false, true })
+        {
+            Standard::Algorithms::Graphs::min_cost_flow_graph<weight_t, cost_t, edge_t> graph2(size);
+
+            // NOLINTNEXTLINE
+            graph2.add_edge(1, 2, 10, 100);
+            // NOLINTNEXTLINE
+            graph2.add_edge(1, 4, 7, 10);
+            // NOLINTNEXTLINE
+            graph2.add_edge(2, 3, 20, 1'000);
+            // NOLINTNEXTLINE
+            graph2.add_edge(3, 4, 30, 10'000);
+
+            const auto name2 = name + (use_cost_scaling ? " min_cost_flow_graph cost scaling" : " min_cost_flow_graph");
+
+            if (use_cost_scaling)
+            {// No flow limit.
+                const auto mfc2 = graph2.min_cost_max_flow_cost_scaling(1, 4);
+
+                ::Standard::Algorithms::ert::are_equal(
+                    // NOLINTNEXTLINE
+                    std::make_pair(17, cost_t(111'070)), mfc2, name2 + " flow_cost");
+
+                continue;
+            }
+
+            const auto mfc2 = graph2.min_cost_max_flow(
+                // NOLINTNEXTLINE
+                1, 4, 9);
+
+            ::Standard::Algorithms::ert::are_equal(mfc, mfc2, name2 + " flow_cost");
+            check_edge_flows(name2, expected_flows, graph2.graph(), size);
+        }
+    }
+
+    // Successive shortest paths vs cost scaling; the negative costs are only in a DAG.
+    void min_cost_flow_test_random()
+    {
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+        constexpr auto steps = 20;
+        constexpr auto max_vertices = 200;
+        constexpr auto max_cost = 1'000;
+
+        for (std::int32_t step{}; step < steps; ++step)
+        {
+            const auto size = rnd(2, step < steps / 2 ? max_size : max_vertices);
+            const auto has_negative = rnd(0, 1) == 1;
+
+            std::vector<std::tuple<std::int32_t, std::int32_t, weight_t, cost_t>> edges;
+            std::vector<std::unordered_map<std::int32_t, std::int32_t>> uniques(size);
+
+            const auto edge_count = rnd(0, size * 5);
+
+            for (std::int32_t index{}; index < edge_count; ++index)
+            {
+                auto from = rnd(0, size - 1);
+                auto tod = rnd(0, size - 1);
+
+                if (has_negative && tod < from)
+                {// A DAG.
+                    std::swap(from, tod);
+                }
+
+                if (from == tod || !uniques[from].emplace(tod, 0).second || !uniques[tod].emplace(from, 0).second)
+                {
+                    continue;
+                }
+
+                const auto min_cost = has_negative ? -max_cost : 0;
+                edges.emplace_back(from, tod, rnd(1, max_cost), rnd(min_cost, max_cost));
+            }
+
+            const auto source = rnd(0, size - 1);
+            auto sink = rnd(0, size - 2);
+            sink += source <= sink ? 1 : 0;
+
+            const auto name = "min_cost_flow_test_random size " + std::to_string(size);
+
+            std::pair<weight_t, cost_t> expected{};
+
+            for (const auto &use_cost_scaling : { false, true })
+            {
+                Standard::Algorithms::Graphs::min_cost_flow_graph<weight_t, cost_t, edge_t> graph(size);
+
+                for (const auto &[from, tod, capacity, unit_cost] : edges)
+                {
+                    graph.add_edge(from, tod, capacity, unit_cost);
+                }
+
+                const auto name2 = name + (use_cost_scaling ? " cost scaling" : " successive shortest paths");
+                const auto actual = use_cost_scaling ? graph.min_cost_max_flow_cost_scaling(source, sink)
+                                                     : graph.min_cost_max_flow(source, sink);
+
+                if (use_cost_scaling)
+                {
+                    ::Standard::Algorithms::ert::are_equal(expected, actual, name2);
+                }
+                else
+                {
+                    expected = actual;
+                }
+
+                check_valid_flow(name2, graph.graph(), source, sink, actual.first);
+
+                if (has_negative || max_size < size)
+                {
+                    continue;
+                }
+
+                Standard::Algorithms::Graphs::min_cost_max_flow_graph<weight_t, cost_t, max_size, edge_t> graph2;
+                graph2.init(size);
+
+                for (const auto &[from, tod, capacity, unit_cost] : edges)
+                {
+                    graph2.add_edge(from, tod, capacity, unit_cost);
+                }
+
+                const auto expected2 = graph2.min_cost_max_flow(source, sink);
+                ::Standard::Algorithms::ert::are_equal(expected2, actual, name2 + " vs min_cost_max_flow_graph");
+            }
+        }
     }
 } // namespace
 
@@ -486,5 +751,8 @@ void Standard::Algorithms::Graphs::Tests::max_flow_tests()
     flow_test1();
     flow_test2();
     flow_test_random();
+    flow_test_random_large();
+    flow_test_long_path();
     min_cost_test();
+    min_cost_flow_test_random();
 }
@@ -0,0 +1,464 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include"dinic_flow.h"
+#include"flow_edge.h"
+#include"flow_residual_arcs.h"
+#include<algorithm>
+#include<cassert>
+#include<concepts>
+#include<cstddef>
+#include<cstdint>
+#include<functional>
+#include<limits>
+#include<optional>
+#include<queue>
+#include<stdexcept>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // Min cost max flow for large graphs, sized at run time unlike min_cost_max_flow_graph.
+    // The residual graph is packed into flat arcs, see flow_residual_arcs.h.
+    // The unit costs may be negative, but there must be no negative cost cycle.
+    //
+    // - min_cost_max_flow: successive shortest paths.
+    // The Johnson potentials keep the reduced costs non-negative,
+    // so each shortest path is found by Dijkstra stopping at the sink.
+    // Bellman-Ford runs once only when some cost is negative.
+    // Time O(f * e*log(v)) where f is the number of augmentations, at most the max flow.
+    //
+    // - min_cost_max_flow_cost_scaling: Goldberg-Tarjan cost scaling.
+    // A max flow is found by Dinic's algorithm, and then its cost is lowered by the push-relabel refinements
+    // of epsilon-optimal flows, dividing epsilon by the "alpha" each time.
+    // The costs are multiplied by (v + 1) so that a 1-optimal flow is optimal.
+    // Time O(v*v*e*log(v*C)) where C is the max absolute unit cost; it does not depend on the flow value.
+    template<std::signed_integral weight_t, std::signed_integral cost_t,
+        class edge_t = cost_flow_edge<weight_t, cost_t>>
+    requires(sizeof(weight_t) <= sizeof(cost_t))
+    struct min_cost_flow_graph final
+    {
+        constexpr explicit min_cost_flow_graph(std::int32_t size = {})
+            : Graph(require_non_negative(size, "size"))
+        {
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::int32_t
+        {
+            return static_cast<std::int32_t>(Graph.size());
+        }
+
+        [[nodiscard]] constexpr auto graph() const &noexcept -> const std::vector<std::vector<edge_t>> &
+        {
+            return Graph;
+        }
+
+        [[nodiscard]] constexpr auto graph() &noexcept -> std::vector<std::vector<edge_t>> &
+        {
+            return Graph;
+        }
+
+        constexpr void init(const std::int32_t size, bool clear_graph = true)
+        {
+            require_greater(size, 1, "size");
+
+            if (clear_graph)
+            {
+                Graph.clear();
+            }
+
+            Graph.resize(size);
+        }
+
+        constexpr void add_edge(
+            const std::int32_t from, const std::int32_t tod, const weight_t &capacity, const cost_t &unit_cost = {})
+        {
+            assert(!(from < 0) && from < size() && !(tod < 0) && tod < size() && from != tod);
+            assert(weight_t{} < capacity && -inf < unit_cost && unit_cost < inf);
+
+            auto &edges_to = Graph[tod];
+            const auto rev = static_cast<std::int32_t>(edges_to.size());
+
+            auto &edges_from = Graph[from];
+            const auto rev2 = static_cast<std::int32_t>(edges_from.size());
+
+            edges_from.push_back({ tod, rev, capacity, weight_t{}, unit_cost });
+            edges_to.push_back({ from, rev2, weight_t{}, weight_t{}, static_cast<cost_t>(-unit_cost) });
+        }
+
+        // The edge flows are set.
+        [[nodiscard]] constexpr auto min_cost_max_flow(const std::int32_t source, const std::int32_t sink,
+            const weight_t limit_flow = std::numeric_limits<weight_t>::max()) -> std::pair<weight_t, cost_t>
+        {
+            require_positive(limit_flow, "limit flow");
+
+            prepare(source, sink);
+            init_potentials(source);
+
+            weight_t total_flow{};
+            cost_t sum_cost{};
+
+            while (total_flow < limit_flow && dijkstra(source, sink))
+            {
+                auto added_flow = static_cast<weight_t>(limit_flow - total_flow);
+
+                for (auto vertex = sink; vertex != source;)
+                {
+                    const auto &arc = Parent_arcs[vertex];
+                    added_flow = std::min(added_flow, Arcs->residuals[arc]);
+                    vertex = Arcs->heads[Arcs->reverses[arc]];
+                }
+
+                assert(weight_t{} < added_flow);
+
+                for (auto vertex = sink; vertex != source;)
+                {
+                    const auto &arc = Parent_arcs[vertex];
+                    Arcs->push(arc, added_flow);
+                    sum_cost += Arc_costs[arc] * static_cast<cost_t>(added_flow);
+                    vertex = Arcs->heads[Arcs->reverses[arc]];
+                }
+
+                total_flow += added_flow;
+            }
+
+            Arcs->get_flows(Graph);
+
+            return { total_flow, sum_cost };
+        }
+
+        // The edge flows are set.
+        // The "alpha" is how many times the epsilon shrinks in one refinement.
+        [[nodiscard]] constexpr auto min_cost_max_flow_cost_scaling(
+            const std::int32_t source, const std::int32_t sink, const cost_t alpha = 8) -> std::pair<weight_t, cost_t>
+        {
+            require_greater(alpha, cost_t{ 1 }, "alpha");
+
+            prepare(source, sink);
+
+            weight_t total_flow{};
+            {
+                // Start from the max flow in the arcs built by "prepare".
+                dinic_flow_engine<weight_t> dinic(std::move(*Arcs));
+                total_flow = dinic.max_flow(source, sink);
+                Arcs.emplace(std::move(dinic).release_arcs());
+            }
+
+            const auto vertex_count = size();
+            const auto multiplier = static_cast<cost_t>(vertex_count + 1LL);
+
+            cost_t epsilon{};
+
+            for (auto &cost : Arc_costs)
+            {
+                cost *= multiplier;
+                epsilon = std::max(epsilon, static_cast<cost_t>(cost < cost_t{} ? -cost : cost));
+            }
+
+            Potentials.assign(vertex_count, cost_t{});
+
+            while (1 < epsilon)
+            {
+                epsilon = std::max(cost_t{ 1 }, static_cast<cost_t>(epsilon / alpha));
+                refine(epsilon);
+            }
+
+            Arcs->get_flows(Graph);
+
+            cost_t sum_cost{};
+
+            for (const auto &edges : Graph)
+            {
+                for (const auto &edge : edges)
+                {
+                    if (weight_t{} < edge.flow)
+                    {
+                        sum_cost += edge.unit_cost * static_cast<cost_t>(edge.flow);
+                    }
+                }
+            }
+
+            return { total_flow, sum_cost };
+        }
+
+private:
+        static constexpr cost_t inf = std::numeric_limits<cost_t>::max() / 2;
+        static constexpr std::size_t none = std::numeric_limits<std::size_t>::max();
+
+        constexpr void prepare(const std::int32_t source, const std::int32_t sink)
+        {
+            const auto vertex_count = size();
+            require_greater(vertex_count, 1, "size");
+            require_between(0, source, vertex_count - 1, "source");
+            require_between(0, sink, vertex_count - 1, "sink");
+            require_not_equal(source, "source", sink);
+
+            Arc_costs.clear();
+
+            for (auto &edges : Graph)
+            {
+                for (auto &edge : edges)
+                {
+                    edge.flow = weight_t{};
+                    Arc_costs.push_back(edge.unit_cost);
+                }
+            }
+
+            Arcs.emplace(Graph);
+        }
+
+        // Bellman-Ford (queue-based), needed only for the negative costs.
+        constexpr void init_potentials(const std::int32_t source)
+        {
+            const auto vertex_count = size();
+            const auto arc_count = Arcs->arc_count();
+
+            Potentials.assign(vertex_count, cost_t{});
+
+            {
+                auto has_negative = false;
+
+                for (std::size_t arc{}; arc < arc_count; ++arc)
+                {
+                    has_negative |= weight_t{} < Arcs->residuals[arc] && Arc_costs[arc] < cost_t{};
+                }
+
+                if (!has_negative)
+                {
+                    return;
+                }
+            }
+
+            Distances.assign(vertex_count, inf);
+            Distances[source] = cost_t{};
+
+            std::vector<std::int32_t> relax_counts(vertex_count, 0);
+            std::vector<bool> in_queue(vertex_count, false);
+            std::queue<std::int32_t> que;
+            que.push(source);
+            in_queue[source] = true;
+
+            while (!que.empty())
+            {
+                const auto from = que.front();
+                que.pop();
+                in_queue[from] = false;
+
+                for (auto arc = Arcs->first[from]; arc < Arcs->first[from + 1LL]; ++arc)
+                {
+                    const auto &tod = Arcs->heads[arc];
+                    const auto cand = static_cast<cost_t>(Distances[from] + Arc_costs[arc]);
+
+                    if (!(weight_t{} < Arcs->residuals[arc]) || !(cand < Distances[tod]))
+                    {
+                        continue;
+                    }
+
+                    Distances[tod] = cand;
+
+                    if (in_queue[tod])
+                    {
+                        continue;
+                    }
+
+                    if (vertex_count < ++relax_counts[tod]) [[unlikely]]
+                    {
+                        throw std::runtime_error("The min cost flow graph has a negative cost cycle.");
+                    }
+
+                    in_queue[tod] = true;
+                    que.push(tod);
+                }
+            }
+
+            for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+            {
+                if (Distances[vertex] < inf)
+                {
+                    Potentials[vertex] = Distances[vertex];
+                }
+            }
+        }
+
+        // Dijkstra on the reduced costs until the sink is settled.
+        // The potentials are then raised by min(distance, sink distance) keeping the reduced costs non-negative.
+        [[nodiscard]] constexpr auto dijkstra(const std::int32_t source, const std::int32_t sink) -> bool
+        {
+            using heap_item_t = std::pair<cost_t, std::int32_t>;
+
+            const auto vertex_count = size();
+
+            Distances.assign(vertex_count, inf);
+            Parent_arcs.assign(vertex_count, none);
+            Distances[source] = cost_t{};
+
+            std::priority_queue<heap_item_t, std::vector<heap_item_t>, std::greater<>> heap{};
+            heap.emplace(cost_t{}, source);
+
+            while (!heap.empty())
+            {
+                const auto [distance, from] = heap.top();
+                heap.pop();
+
+                if (Distances[from] < distance)
+                {
+                    continue;
+                }
+
+                if (from == sink)
+                {
+                    break;
+                }
+
+                for (auto arc = Arcs->first[from]; arc < Arcs->first[from + 1LL]; ++arc)
+                {
+                    if (!(weight_t{} < Arcs->residuals[arc]))
+                    {
+                        continue;
+                    }
+
+                    const auto &tod = Arcs->heads[arc];
+                    const auto reduced = static_cast<cost_t>(Arc_costs[arc] + Potentials[from] - Potentials[tod]);
+                    assert(!(reduced < cost_t{}));
+
+                    if (const auto cand = static_cast<cost_t>(distance + reduced); cand < Distances[tod])
+                    {
+                        Distances[tod] = cand;
+                        Parent_arcs[tod] = arc;
+                        heap.emplace(cand, tod);
+                    }
+                }
+            }
+
+            const auto sink_distance = Distances[sink];
+
+            if (!(sink_distance < inf))
+            {
+                return false;
+            }
+
+            for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+            {
+                Potentials[vertex] += std::min(Distances[vertex], sink_distance);
+            }
+
+            return true;
+        }
+
+        [[nodiscard]] constexpr auto reduced_cost(const std::int32_t from, const std::size_t arc) const -> cost_t
+        {
+            return static_cast<cost_t>(Arc_costs[arc] + Potentials[from] - Potentials[Arcs->heads[arc]]);
+        }
+
+        // Make an epsilon-optimal flow from a (epsilon * alpha)-optimal one:
+        // saturate the negative reduced cost arcs, and push the excesses along the admissible arcs,
+        // which have a negative reduced cost, lowering the potentials when there is none.
+        constexpr void refine(const cost_t &epsilon)
+        {
+            const auto vertex_count = size();
+
+            Excesses.assign(vertex_count, weight_t{});
+
+            for (std::int32_t from{}; from < vertex_count; ++from)
+            {
+                for (auto arc = Arcs->first[from]; arc < Arcs->first[from + 1LL]; ++arc)
+                {
+                    if (const auto residual = Arcs->residuals[arc];
+                        weight_t{} < residual && reduced_cost(from, arc) < cost_t{})
+                    {
+                        Arcs->push(arc, residual);
+                        Excesses[from] -= residual;
+                        Excesses[Arcs->heads[arc]] += residual;
+                    }
+                }
+            }
+
+            Currents.assign(Arcs->first.cbegin(), Arcs->first.cend() - 1);
+
+            std::queue<std::int32_t> active;
+
+            for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+            {
+                if (weight_t{} < Excesses[vertex])
+                {
+                    active.push(vertex);
+                }
+            }
+
+            while (!active.empty())
+            {
+                const auto vertex = active.front();
+                active.pop();
+
+                discharge(vertex, epsilon, active);
+            }
+        }
+
+        constexpr void discharge(const std::int32_t vertex, const cost_t &epsilon, std::queue<std::int32_t> &active)
+        {
+            const auto stop = Arcs->first[vertex + 1LL];
+
+            while (weight_t{} < Excesses[vertex])
+            {
+                auto &arc = Currents[vertex];
+
+                for (; arc < stop; ++arc)
+                {
+                    if (!(weight_t{} < Arcs->residuals[arc]) || !(reduced_cost(vertex, arc) < cost_t{}))
+                    {
+                        continue;
+                    }
+
+                    const auto &tod = Arcs->heads[arc];
+                    const auto delta = std::min(Excesses[vertex], Arcs->residuals[arc]);
+                    const auto was_inactive = !(weight_t{} < Excesses[tod]);
+
+                    Arcs->push(arc, delta);
+                    Excesses[vertex] -= delta;
+                    Excesses[tod] += delta;
+
+                    if (was_inactive && weight_t{} < Excesses[tod])
+                    {
+                        active.push(tod);
+                    }
+
+                    if (Excesses[vertex] == weight_t{})
+                    {
+                        return;
+                    }
+                }
+
+                relabel(vertex, epsilon);
+            }
+        }
+
+        // The new potential makes the cheapest residual arc have the reduced cost -epsilon.
+        constexpr void relabel(const std::int32_t vertex, const cost_t &epsilon)
+        {
+            auto best = -inf;
+
+            for (auto arc = Arcs->first[vertex]; arc < Arcs->first[vertex + 1LL]; ++arc)
+            {
+                if (weight_t{} < Arcs->residuals[arc])
+                {
+                    best = std::max(best, static_cast<cost_t>(Potentials[Arcs->heads[arc]] - Arc_costs[arc]));
+                }
+            }
+
+            // A vertex with an excess has received it by an arc, whose reverse arc is residual.
+            assert(-inf < best);
+
+            Potentials[vertex] = static_cast<cost_t>(best - epsilon);
+            Currents[vertex] = Arcs->first[vertex];
+        }
+
+        std::vector<std::vector<edge_t>> Graph;
+        std::optional<flow_residual_arcs<weight_t>> Arcs{};
+        std::vector<cost_t> Arc_costs{};
+        std::vector<cost_t> Potentials{};
+        std::vector<cost_t> Distances{};
+        std::vector<std::size_t> Parent_arcs{};
+        std::vector<weight_t> Excesses{};
+        std::vector<std::size_t> Currents{};
+    };
+} // namespace Standard::Algorithms::Graphs
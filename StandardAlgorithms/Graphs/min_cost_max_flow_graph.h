@@ -178,7 +178,7 @@ private:
             }
         }
 
-        // todo(p3): faster.
+        // See min_cost_flow_graph.h for the faster ones.
         [[nodiscard]] constexpr auto find_flow(const std::pair<std::int32_t, std::int32_t> &source_sink) -> bool
         {
             const auto &source = source_sink.first;
@@ -241,12 +241,14 @@ private:
                 auto &other = Graph[vertex][rev];
                 other.flow -= added_flow;
 
+                // A reverse edge has a negative cost.
                 const auto add = static_cast<cost_t>(edge.unit_cost * static_cast<cost_t>(added_flow));
                 cost += add;
-                assert(cost_t{} <= add && cost_t{} <= cost);
 
                 vertex = Parents[vertex];
             } while (vertex != source);
+
+            assert(cost_t{} <= cost);
         }
 
         static constexpr cost_t inf = std::numeric_limits<cost_t>::max() / 2;
@@ -0,0 +1,359 @@
+#pragma once
+#include"../Numbers/disjoint_set.h"
+#include"../Utilities/has_openmp.h"
+#include"min_cut_stoer_wagner_sparse.h" // min_cut_adjacency_lists, min_cut_smaller_side
+#include<algorithm>
+#include<bit>
+#include<cassert>
+#include<cmath>
+#include<cstddef>
+#include<cstdint>
+#include<limits>
+#include<numbers>
+#include<random>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    template<class long_int_t>
+    struct karger_edge final
+    {
+        // NOLINTNEXTLINE
+        std::int32_t from{};
+
+        // NOLINTNEXTLINE
+        std::int32_t tod{};
+
+        // NOLINTNEXTLINE
+        long_int_t weight{};
+    };
+
+    // One trial: a recursive contraction, owning its random engine.
+    template<class long_int_t>
+    struct karger_stein_trial final
+    {
+        using edges_t = std::vector<karger_edge<long_int_t>>;
+
+        static constexpr std::int32_t base_size = 6;
+
+        constexpr explicit karger_stein_trial(const std::uint64_t seed)
+            : Engine(seed)
+        {
+        }
+
+        // Return the cut cost, and the side flags of the "vertex_count" vertices.
+        [[nodiscard]] auto run(const edges_t &edges, const std::int32_t vertex_count)
+            -> std::pair<long_int_t, std::vector<bool>>
+        {
+            assert(1 < vertex_count);
+
+            if (vertex_count <= base_size)
+            {
+                return brute_force(edges, vertex_count);
+            }
+
+            // The min cut survives the contraction to this size with the probability at least 1/2.
+            const auto target = static_cast<std::int32_t>(std::ceil(1.0 + vertex_count / std::numbers::sqrt2));
+
+            std::pair<long_int_t, std::vector<bool>> best{ std::numeric_limits<long_int_t>::max(), {} };
+            std::vector<std::int32_t> labels;
+
+            for (auto branch = 0; branch < 2; ++branch)
+            {
+                const auto contracted = contract(edges, vertex_count, target, labels);
+                auto cand = run(contracted, target);
+
+                if (!(cand.first < best.first))
+                {
+                    continue;
+                }
+
+                best.first = cand.first;
+                best.second.resize(vertex_count);
+
+                for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+                {
+                    best.second[vertex] = cand.second[labels[vertex]];
+                }
+            }
+
+            return best;
+        }
+
+private:
+        // Contracting a random edge, chosen with the probability proportional to its weight, until "target"
+        // vertices remain is the same as uniting the ends in the increasing order of
+        // the exponentially distributed keys of the rate equal to the weight.
+        // The vertices get new labels [0..target); the parallel edges are summed.
+        [[nodiscard]] auto contract(const edges_t &edges, const std::int32_t vertex_count,
+            const std::int32_t target, std::vector<std::int32_t> &labels) -> edges_t
+        {
+            assert(1 < target && target < vertex_count);
+
+            Keyed.clear();
+            Keyed.reserve(edges.size());
+
+            std::uniform_real_distribution<double> unit(0.0, 1.0);
+
+            for (std::size_t index{}; index < edges.size(); ++index)
+            {
+                const auto uniform = 1.0 - unit(Engine); // (0, 1]
+                const auto key = -std::log(uniform) / static_cast<double>(edges[index].weight);
+
+                Keyed.emplace_back(key, index);
+            }
+
+            std::sort(Keyed.begin(), Keyed.end());
+
+            Standard::Algorithms::Numbers::disjoint_set<std::int32_t> dsu(vertex_count);
+
+            for (std::size_t index{}; index < Keyed.size() && target < dsu.count(); ++index)
+            {
+                const auto &edge = edges[Keyed[index].second];
+                dsu.unite(edge.from, edge.tod);
+            }
+
+            // A connected graph cannot stop short of the target.
+            assert(dsu.count() == target);
+
+            labels.assign(vertex_count, -1);
+
+            std::int32_t label{};
+
+            for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+            {
+                if (const auto root = dsu.parent(vertex); labels[root] < 0)
+                {
+                    labels[root] = label++;
+                }
+            }
+
+            for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+            {
+                labels[vertex] = labels[dsu.parent(vertex)];
+            }
+
+            edges_t contracted;
+
+            for (const auto &edge : edges)
+            {
+                const auto from = labels[edge.from];
+                const auto tod = labels[edge.tod];
+
+                if (from != tod)
+                {
+                    contracted.push_back({ std::min(from, tod), std::max(from, tod), edge.weight });
+                }
+            }
+
+            std::sort(contracted.begin(), contracted.end(),
+                [](const auto &one, const auto &two)
+                {
+                    return one.from < two.from || (one.from == two.from && one.tod < two.tod);
+                });
+
+            std::size_t count{};
+
+            for (const auto &edge : contracted)
+            {
+                if (0U < count && contracted[count - 1U].from == edge.from && contracted[count - 1U].tod == edge.tod)
+                {
+                    contracted[count - 1U].weight += edge.weight;
+                }
+                else
+                {
+                    contracted[count++] = edge;
+                }
+            }
+
+            contracted.resize(count);
+
+            return contracted;
+        }
+
+        // The vertex 0 is always on the side "false".
+        // Time O(2**v * e).
+        [[nodiscard]] static constexpr auto brute_force(const edges_t &edges, const std::int32_t vertex_count)
+            -> std::pair<long_int_t, std::vector<bool>>
+        {
+            assert(1 < vertex_count && vertex_count <= base_size);
+
+            const auto masks = 1U << static_cast<std::uint32_t>(vertex_count - 1);
+
+            auto best_cost = std::numeric_limits<long_int_t>::max();
+            std::uint32_t best_mask{};
+
+            for (std::uint32_t mask = 1; mask < masks; ++mask)
+            {
+                const auto sides = mask << 1U;
+                long_int_t cost{};
+
+                for (const auto &edge : edges)
+                {
+                    if (((sides >> static_cast<std::uint32_t>(edge.from)) ^
+                            (sides >> static_cast<std::uint32_t>(edge.tod))) &
+                        1U)
+                    {
+                        cost += edge.weight;
+                    }
+                }
+
+                if (cost < best_cost)
+                {
+                    best_cost = cost, best_mask = sides;
+                }
+            }
+
+            std::vector<bool> flags(vertex_count);
+
+            for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+            {
+                flags[vertex] = ((best_mask >> static_cast<std::uint32_t>(vertex)) & 1U) != 0U;
+            }
+
+            return { best_cost, std::move(flags) };
+        }
+
+        std::mt19937_64 Engine;
+        std::vector<std::pair<double, std::size_t>> Keyed{};
+    };
+
+    // A disconnected graph has a zero cut: return the smallest component; else an empty vector.
+    template<class long_int_t>
+    [[nodiscard]] constexpr auto min_cut_zero_component(
+        const std::vector<karger_edge<long_int_t>> &edges, const std::int32_t vertex_count) -> std::vector<std::size_t>
+    {
+        Standard::Algorithms::Numbers::disjoint_set<std::int32_t> dsu(vertex_count);
+
+        for (const auto &edge : edges)
+        {
+            dsu.unite(edge.from, edge.tod);
+        }
+
+        if (dsu.count() == 1)
+        {
+            return {};
+        }
+
+        std::vector<std::int32_t> sizes(vertex_count);
+
+        for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+        {
+            ++sizes[dsu.parent(vertex)];
+        }
+
+        auto min_root = dsu.parent(0);
+
+        for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+        {
+            if (0 < sizes[vertex] && sizes[vertex] < sizes[min_root])
+            {
+                min_root = vertex;
+            }
+        }
+
+        std::vector<std::size_t> members;
+
+        for (std::int32_t vertex{}; vertex < vertex_count; ++vertex)
+        {
+            if (dsu.parent(vertex) == min_root)
+            {
+                members.push_back(vertex);
+            }
+        }
+
+        return members;
+    }
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Karger-Stein Monte Carlo global min cut of an undirected graph given by an edge list;
+    // the input, output are the same as of min_cut_stoer_wagner_sparse.
+    // A trial contracts random edges down to n/sqrt(2) + 1 vertices twice independently,
+    // recursing on each contracted graph; a graph of at most 6 vertices is solved exactly.
+    // A trial finds a min cut with the probability Omega(1/log(n)); the independent trials run in parallel,
+    // each having its own random engine seeded by "seed + trial", so the result does not depend on the thread count.
+    // By default, there are log2(n)**2 trials for a high success probability.
+    // The returned cut is always a valid cut, at least as heavy as the min cut.
+    // 0-based vertices.
+    // Time O(trials * n*n*log(n)**2) for the contractions by sorting.
+    template<class long_int_t, class from_to_weight_t>
+    [[nodiscard]] auto min_cut_karger_stein(const std::vector<from_to_weight_t> &edges,
+        const std::int32_t vertex_count, std::int32_t trials = 0, const std::uint64_t seed = 0)
+        -> std::pair<std::vector<std::size_t>, long_int_t>
+    {
+        require_non_negative(vertex_count, "vertex count");
+        require_non_negative(trials, "trials");
+
+        if (vertex_count <= 1)
+        {
+            return {};
+        }
+
+        const auto size = static_cast<std::size_t>(vertex_count);
+
+        std::vector<Inner::karger_edge<long_int_t>> simple_edges;
+        {
+            const auto graph = Inner::min_cut_adjacency_lists<long_int_t>(edges, vertex_count);
+
+            for (std::int32_t from{}; from < vertex_count; ++from)
+            {
+                for (const auto &[tod, weight] : graph[from])
+                {
+                    if (from < tod)
+                    {
+                        simple_edges.push_back({ from, tod, weight });
+                    }
+                }
+            }
+        }
+
+        if (auto members = Inner::min_cut_zero_component(simple_edges, vertex_count); !members.empty())
+        {
+            return { Inner::min_cut_smaller_side(std::move(members), size), long_int_t{} };
+        }
+
+        if (trials == 0)
+        {
+            const auto log_size = static_cast<std::int32_t>(std::bit_width(size));
+            trials = log_size * log_size;
+        }
+
+        std::vector<std::pair<long_int_t, std::vector<bool>>> results(trials);
+
+#pragma omp parallel for default(none) shared(simple_edges, vertex_count, trials, seed, results) schedule(dynamic, 1)
+        for (std::int32_t trial = 0; trial < trials; ++trial)
+        {
+            Inner::karger_stein_trial<long_int_t> runner(seed + static_cast<std::uint64_t>(trial));
+
+            results[trial] = runner.run(simple_edges, vertex_count);
+        }
+
+        // The first best trial wins.
+        std::size_t best{};
+
+        for (std::size_t index = 1; index < results.size(); ++index)
+        {
+            if (results[index].first < results[best].first)
+            {
+                best = index;
+            }
+        }
+
+        const auto &flags = results[best].second;
+
+        std::vector<std::size_t> members;
+
+        for (std::size_t vertex{}; vertex < size; ++vertex)
+        {
+            if (flags[vertex])
+            {
+                members.push_back(vertex);
+            }
+        }
+
+        return { Inner::min_cut_smaller_side(std::move(members), size), results[best].first };
+    }
+} // namespace Standard::Algorithms::Graphs
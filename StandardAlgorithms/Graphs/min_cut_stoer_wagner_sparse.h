@@ -0,0 +1,279 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include<algorithm>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<queue>
+#include<tuple>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    // Check the edge list, and return the vertex adjacency lists without the self-loops and zero weights.
+    template<class long_int_t, class from_to_weight_t>
+    [[nodiscard]] constexpr auto min_cut_adjacency_lists(const std::vector<from_to_weight_t> &edges,
+        const std::int32_t vertex_count) -> std::vector<std::vector<std::pair<std::int32_t, long_int_t>>>
+    {
+        std::vector<std::vector<std::pair<std::int32_t, long_int_t>>> graph(vertex_count);
+
+        for (const auto &edge : edges)
+        {
+            const auto &from = std::get<0>(edge);
+            const auto &tod = std::get<1>(edge);
+            const auto &weight = std::get<2>(edge);
+
+            if (from < 0 || !(from < vertex_count) || tod < 0 || !(tod < vertex_count) || weight < decltype(weight){})
+                [[unlikely]]
+            {
+                auto str = ::Standard::Algorithms::Utilities::w_stream();
+                str << "Bad min cut edge {" << from << ", " << tod << ", " << weight << "}, vertex count "
+                    << vertex_count << ".";
+                throw_exception(str);
+            }
+
+            if (from == tod || weight == decltype(weight){})
+            {
+                continue;
+            }
+
+            graph[from].emplace_back(tod, static_cast<long_int_t>(weight));
+            graph[tod].emplace_back(from, static_cast<long_int_t>(weight));
+        }
+
+        return graph;
+    }
+
+    // Return the smaller side of a cut, sorted; "members" is one side.
+    [[nodiscard]] constexpr auto min_cut_smaller_side(std::vector<std::size_t> members, const std::size_t vertex_count)
+        -> std::vector<std::size_t>
+    {
+        assert(!members.empty() && members.size() < vertex_count);
+
+        std::sort(members.begin(), members.end());
+
+        if (members.size() * 2U <= vertex_count)
+        {
+            return members;
+        }
+
+        std::vector<std::size_t> others;
+        others.reserve(vertex_count - members.size());
+
+        auto ite = members.cbegin();
+
+        for (std::size_t vertex{}; vertex < vertex_count; ++vertex)
+        {
+            if (ite != members.cend() && *ite == vertex)
+            {
+                ++ite;
+            }
+            else
+            {
+                others.push_back(vertex);
+            }
+        }
+
+        return others;
+    }
+
+    template<class long_int_t>
+    struct stoer_wagner_sparse_context final
+    {
+        using adjacency_t = std::vector<std::vector<std::pair<std::int32_t, long_int_t>>>;
+
+        constexpr explicit stoer_wagner_sparse_context(adjacency_t &&graph)
+            : Graph(std::move(graph))
+            , Size(static_cast<std::int32_t>(Graph.size()))
+            , Owners(Size)
+            , Members(Size)
+            , Keys(Size)
+            , Is_added(Size)
+            , Positions(Size, none)
+        {
+            for (std::int32_t vertex{}; vertex < Size; ++vertex)
+            {
+                Owners[vertex] = vertex;
+                Members[vertex].push_back(vertex);
+                Alives.push_back(vertex);
+            }
+        }
+
+        // The maximum adjacency order by a lazy max-heap: the stale entries are skipped.
+        // Return the last 2 vertices and the cut of the phase, separating the last vertex.
+        [[nodiscard]] auto phase() -> std::tuple<std::int32_t, std::int32_t, long_int_t>
+        {
+            assert(1U < Alives.size());
+
+            for (const auto &vertex : Alives)
+            {
+                Keys[vertex] = {};
+                Is_added[vertex] = false;
+                Heap.emplace(long_int_t{}, vertex);
+            }
+
+            std::int32_t previous = none;
+            std::int32_t last = none;
+            long_int_t last_key{};
+
+            while (!Heap.empty())
+            {
+                const auto [key, vertex] = Heap.top();
+                Heap.pop();
+
+                if (Is_added[vertex] || key != Keys[vertex])
+                {
+                    continue;
+                }
+
+                Is_added[vertex] = true;
+                previous = last, last = vertex, last_key = key;
+
+                for (const auto &[neighbor, weight] : Graph[vertex])
+                {
+                    const auto &owner = Owners[neighbor];
+
+                    if (Is_added[owner])
+                    {
+                        continue;
+                    }
+
+                    Keys[owner] += weight;
+                    Heap.emplace(Keys[owner], owner);
+                }
+            }
+
+            assert(previous != none && last != none);
+            return { previous, last, last_key };
+        }
+
+        // Move the "last" into the "previous", summing the parallel edges.
+        constexpr void merge(const std::int32_t previous, const std::int32_t last)
+        {
+            assert(previous != last && Owners[previous] == previous && Owners[last] == last);
+
+            for (const auto &member : Members[last])
+            {
+                Owners[member] = previous;
+            }
+
+            Members[previous].insert(Members[previous].end(), Members[last].cbegin(), Members[last].cend());
+            Members[last].clear();
+            Members[last].shrink_to_fit();
+
+            auto &edges = Graph[previous];
+            edges.insert(edges.end(), Graph[last].cbegin(), Graph[last].cend());
+            Graph[last].clear();
+            Graph[last].shrink_to_fit();
+
+            std::size_t count{};
+
+            for (const auto &[neighbor, weight] : edges)
+            {
+                const auto owner = Owners[neighbor];
+
+                if (owner == previous)
+                {
+                    continue;
+                }
+
+                if (auto &position = Positions[owner]; position == none)
+                {
+                    position = static_cast<std::int32_t>(count);
+                    edges[count++] = { owner, weight };
+                }
+                else
+                {
+                    edges[position].second += weight;
+                }
+            }
+
+            edges.resize(count);
+
+            for (const auto &edge : edges)
+            {
+                Positions[edge.first] = none;
+            }
+
+            Alives.erase(std::find(Alives.begin(), Alives.end(), last));
+        }
+
+        [[nodiscard]] constexpr auto alive_count() const noexcept -> std::size_t
+        {
+            return Alives.size();
+        }
+
+        [[nodiscard]] constexpr auto members(const std::int32_t vertex) const & -> const std::vector<std::size_t> &
+        {
+            return Members[vertex];
+        }
+
+private:
+        static constexpr std::int32_t none = -1;
+
+        adjacency_t Graph;
+        std::int32_t Size;
+
+        // The vertices merged into one are represented by the "owner".
+        // Other lists can still have the merged vertices - they are mapped to the owners on the fly.
+        std::vector<std::int32_t> Owners;
+        std::vector<std::vector<std::size_t>> Members;
+        std::vector<std::int32_t> Alives{};
+
+        std::vector<long_int_t> Keys;
+        std::vector<bool> Is_added;
+        std::vector<std::int32_t> Positions;
+        std::priority_queue<std::pair<long_int_t, std::int32_t>> Heap{};
+    };
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Stoer Wagner global min cut (edge connectivity) of a sparse undirected graph given by an edge list
+    // of {from, to, weight} tuples; the output is the same as of min_cut_stoer_wagner:
+    // the smaller vertex set, sorted, and the cut cost.
+    // The weights must be non-negative; the self-loops are ignored, the parallel edges are summed.
+    // Each phase orders the vertices by the maximum adjacency using a binary heap with lazy deletion,
+    // and then merges the last 2 vertices along with their adjacency lists.
+    // 0-based vertices.
+    // Time O(v * (v + e) * log(v)), space O(v + e).
+    template<class long_int_t, class from_to_weight_t>
+    [[nodiscard]] auto min_cut_stoer_wagner_sparse(const std::vector<from_to_weight_t> &edges,
+        const std::int32_t vertex_count) -> std::pair<std::vector<std::size_t>, long_int_t>
+    {
+        require_non_negative(vertex_count, "vertex count");
+
+        if (vertex_count <= 1)
+        {
+            return {};
+        }
+
+        Inner::stoer_wagner_sparse_context<long_int_t> context(
+            Inner::min_cut_adjacency_lists<long_int_t>(edges, vertex_count));
+
+        const auto size = static_cast<std::size_t>(vertex_count);
+
+        std::vector<std::size_t> min_vertices;
+        long_int_t min_cost{};
+
+        while (1U < context.alive_count())
+        {
+            const auto [previous, last, cost] = context.phase();
+            const auto &members = context.members(last);
+            const auto min_size = std::min(members.size(), size - members.size());
+
+            if (min_vertices.empty() || cost < min_cost || (cost == min_cost && min_size < min_vertices.size()))
+            {
+                min_vertices = Inner::min_cut_smaller_side(members, size);
+                min_cost = cost;
+            }
+
+            context.merge(previous, last);
+        }
+
+        assert(!min_vertices.empty() && min_vertices.size() < size && !(min_cost < long_int_t{}));
+
+        return { std::move(min_vertices), min_cost };
+    }
+} // namespace Standard::Algorithms::Graphs
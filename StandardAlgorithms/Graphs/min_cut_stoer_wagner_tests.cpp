@@ -4,7 +4,9 @@
 #include"../Utilities/test_utilities.h"
 #include"create_random_graph.h"
 #include"max_flow_graph.h"
+#include"min_cut_karger_stein.h"
 #include"min_cut_stoer_wagner.h"
+#include"min_cut_stoer_wagner_sparse.h"
 #include<optional>
 
 namespace
@@ -306,7 +308,105 @@ namespace
         validate_min_cut(name, graph, actual.first, actual.second);
     }
 
-    constexpr void run_test_case(const test_case &test)
+    using edge_list_t = std::vector<std::tuple<std::int32_t, std::int32_t, int_t>>;
+
+    [[nodiscard]] constexpr auto to_edge_list(const full_cost_graph_t &graph) -> edge_list_t
+    {
+        const auto size = static_cast<std::int32_t>(graph.size());
+
+        edge_list_t edges;
+
+        for (std::int32_t from{}; from < size; ++from)
+        {
+            for (auto tod = from + 1; tod < size; ++tod)
+            {
+                if (const auto &cost = graph[from][tod]; int_t{} < cost)
+                {
+                    edges.emplace_back(from, tod, cost);
+                }
+            }
+        }
+
+        return edges;
+    }
+
+    // Several min cuts might exist, so only the cost is compared.
+    // Karger-Stein is Monte Carlo, and it is certain to find a min cut only in a graph of at most 6 vertices,
+    // which covers all the fixed graphs; a larger graph's cut must be valid and not lighter than the min cut.
+    void run_sparse_min_cuts(
+        const std::string &name, const full_cost_graph_t &graph, const int_t &expected_cost)
+    {
+        constexpr std::size_t max_exact_size = 6;
+
+        const auto edges = to_edge_list(graph);
+        const auto size = static_cast<std::int32_t>(graph.size());
+
+        {
+            const auto actual = Standard::Algorithms::Graphs::min_cut_stoer_wagner_sparse<int_t>(edges, size);
+
+            ::Standard::Algorithms::ert::are_equal(expected_cost, actual.second, name + " min_cut_stoer_wagner_sparse");
+            validate_min_cut(name + " min_cut_stoer_wagner_sparse", graph, actual.first, actual.second);
+        }
+        {
+            constexpr std::uint64_t seed = 17;
+
+            const auto actual = Standard::Algorithms::Graphs::min_cut_karger_stein<int_t>(edges, size, 0, seed);
+
+            if (graph.size() <= max_exact_size)
+            {
+                ::Standard::Algorithms::ert::are_equal(expected_cost, actual.second, name + " min_cut_karger_stein");
+            }
+            else
+            {
+                Standard::Algorithms::require_less_equal(expected_cost, actual.second, name + " min_cut_karger_stein");
+            }
+
+            validate_min_cut(name + " min_cut_karger_stein", graph, actual.first, actual.second);
+        }
+    }
+
+    void sparse_random_tests()
+    {
+        constexpr auto steps = 5;
+        constexpr int_t max_size = ::Standard::Algorithms::is_debug ? 40 : 100;
+        constexpr int_t max_weight = 20;
+
+        Standard::Algorithms::Utilities::random_t<int_t> rnd{};
+
+        for (std::int32_t step{}; step < steps; ++step)
+        {
+            const auto size = rnd(min_nodes, max_size);
+            const auto edge_count = rnd(size - 1, size * 3);
+
+            full_cost_graph_t graph(size, edges_t(size));
+
+            // A spanning path, and random edges.
+            for (int_t from = 1; from < size; ++from)
+            {
+                graph[from - 1][from] = graph[from][from - 1] = rnd(1, max_weight);
+            }
+
+            for (auto index = size - 1; index < edge_count; ++index)
+            {
+                const auto from = rnd(0, size - 1);
+                const auto tod = rnd(0, size - 1);
+
+                if (from != tod)
+                {
+                    graph[from][tod] = graph[tod][from] = rnd(1, max_weight);
+                }
+            }
+
+            auto cop = graph;
+            const auto expected = Standard::Algorithms::Graphs::min_cut_stoer_wagner<int_t>(cop);
+
+            validate_min_cut("sparse random min_cut_stoer_wagner", graph, expected.first, expected.second);
+
+            run_sparse_min_cuts("sparse random " + std::to_string(size), graph, expected.second);
+        }
+    }
+
+    void run_test_case(const test_case &test)
     {
         const auto &graph = test.input();
         const auto expected = Standard::Algorithms::Graphs::min_cut_slow<int_t, int_t>(graph);
@@ -327,10 +427,14 @@ namespace
 
             verify_test_result("min_cut_via_flow", expected.first.size(), expected.second, test, actual);
         }
+
+        run_sparse_min_cuts(test.name(), graph, expected.second);
     }
 } // namespace
 
 void Standard::Algorithms::Graphs::Tests::min_cut_stoer_wagner_tests()
 {
     Standard::Algorithms::Tests::test_utilities<test_case>::run_tests(run_test_case, generate_test_cases);
+
+    sparse_random_tests();
 }
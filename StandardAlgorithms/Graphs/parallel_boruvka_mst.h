@@ -0,0 +1,256 @@
+#pragma once
+#include"../Numbers/prefix_sum.h"
+#include"../Utilities/has_openmp.h"
+#include"filter_kruskal_mst.h" // parallel_stable_partition
+#include<atomic>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<tuple>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs::Inner
+{
+    template<class weight_t>
+    struct boruvka_edge final
+    {
+        // The components of the ends.
+        // NOLINTNEXTLINE
+        std::int32_t from{};
+
+        // NOLINTNEXTLINE
+        std::int32_t tod{};
+
+        // NOLINTNEXTLINE
+        weight_t weight{};
+
+        // The position in the input graph to break the ties, and to output the original ends.
+        // NOLINTNEXTLINE
+        std::int64_t id{};
+    };
+
+    // The edges are distinct by (weight, id), so the chosen edges make no cycle.
+    template<class weight_t>
+    [[nodiscard]] constexpr auto is_lighter_boruvka_edge(
+        const boruvka_edge<weight_t> &one, const boruvka_edge<weight_t> &two) noexcept -> bool
+    {
+        return one.weight < two.weight || (!(two.weight < one.weight) && one.id < two.id);
+    }
+
+    // Return false when there is no edge between the components.
+    template<class weight_t>
+    [[nodiscard]] auto boruvka_cheapest_edges(const std::vector<boruvka_edge<weight_t>> &edges,
+        const std::int32_t component_count, std::vector<std::int64_t> &cheapest) -> bool
+    {
+        constexpr std::int64_t none = -1;
+
+        cheapest.assign(component_count, none);
+
+        const auto edge_count = static_cast<std::int64_t>(edges.size());
+
+#pragma omp parallel for default(none) shared(edges, cheapest, edge_count, none) schedule(static)
+        for (std::int64_t index = 0; index < edge_count; ++index)
+        {
+            const auto &edge = edges[index];
+            assert(edge.from != edge.tod);
+
+            for (const auto &component : { edge.from, edge.tod })
+            {
+                std::atomic_ref<std::int64_t> ref(cheapest[component]);
+
+                for (auto cur = ref.load(std::memory_order_relaxed);
+                     cur == none || is_lighter_boruvka_edge(edge, edges[cur]);)
+                {
+                    if (ref.compare_exchange_weak(cur, index, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+
+        return 0 < edge_count;
+    }
+
+    // Each component is hooked to the other end of its cheapest edge.
+    // When 2 components have chosen the same edge, the smaller one becomes the root.
+    // The hooking components add their edges to the tree.
+    template<class weight_t2, class weight_t, class from_to_weight_t>
+    [[nodiscard]] auto boruvka_hook(const std::vector<from_to_weight_t> &graph,
+        const std::vector<boruvka_edge<weight_t>> &edges, const std::vector<std::int64_t> &cheapest,
+        std::vector<std::int32_t> &parents, std::vector<from_to_weight_t> &result_tree) -> weight_t2
+    {
+        const auto component_count = static_cast<std::int32_t>(cheapest.size());
+        parents.resize(component_count);
+
+#pragma omp parallel for default(none) shared(edges, cheapest, parents, component_count) schedule(static)
+        for (std::int32_t component = 0; component < component_count; ++component)
+        {
+            const auto &best = cheapest[component];
+            if (best < 0)
+            {// Isolated.
+                parents[component] = component;
+                continue;
+            }
+
+            const auto &edge = edges[best];
+            const auto other = edge.from == component ? edge.tod : edge.from;
+            const auto is_root = cheapest[other] == best && component < other;
+
+            parents[component] = is_root ? component : other;
+        }
+
+        weight_t2 weights{};
+
+        for (std::int32_t component{}; component < component_count; ++component)
+        {
+            if (parents[component] == component)
+            {
+                continue;
+            }
+
+            const auto &original = graph[edges[cheapest[component]].id];
+            const auto &from = std::get<0>(original);
+            const auto &tod = std::get<1>(original);
+            const auto &weight = std::get<2>(original);
+
+            result_tree.emplace_back(std::min(from, tod), std::max(from, tod), weight);
+            weights += weight;
+        }
+
+        return weights;
+    }
+
+    // Pointer jumping until each component points to its root,
+    // then number the roots by a parallel prefix sum.
+    // Return the new component count.
+    inline auto boruvka_contract(std::vector<std::int32_t> &parents, std::vector<std::int32_t> &buffer,
+        std::vector<std::int32_t> &roots, std::vector<std::int32_t> &new_labels) -> std::int32_t
+    {
+        const auto component_count = static_cast<std::int32_t>(parents.size());
+        buffer.resize(component_count);
+
+        for (auto changed = true; changed;)
+        {
+            changed = false;
+
+#pragma omp parallel for default(none) shared(parents, buffer, component_count) reduction(|| : changed) \
+    schedule(static)
+            for (std::int32_t component = 0; component < component_count; ++component)
+            {
+                const auto &grand = parents[parents[component]];
+                changed = changed || grand != parents[component];
+                buffer[component] = grand;
+            }
+
+            std::swap(parents, buffer);
+        }
+
+        roots.resize(component_count);
+
+#pragma omp parallel for default(none) shared(parents, roots, component_count) schedule(static)
+        for (std::int32_t component = 0; component < component_count; ++component)
+        {
+            roots[component] = parents[component] == component ? 1 : 0;
+        }
+
+        // The number of the roots before a component.
+        Standard::Algorithms::Numbers::parallel_prefix_sum(std::span<const std::int32_t>(roots), new_labels);
+
+        return new_labels.back();
+    }
+} // namespace Standard::Algorithms::Graphs::Inner
+
+namespace Standard::Algorithms::Graphs
+{
+    // Parallel Boruvka minimum spanning forest.
+    // Each round, every component finds its cheapest edge by an atomic min over all the edges in parallel,
+    // the components are merged along these edges by pointer jumping,
+    // and the edges inside a component are dropped by a parallel compaction.
+    // The number of components at least halves each round.
+    // The graph is undirected, weighted, given by an edge list (from, to, weight) - same as boruvka_mst,
+    // but it is not edited.
+    // 0-based vertices.
+    // Work O(e*log(v)), span O(log(v)**2) rounds times the edge scan.
+    template<class weight_t2, class weight_t, class from_to_weight_t>
+    requires(sizeof(weight_t) <= sizeof(weight_t2))
+    [[nodiscard]] auto parallel_boruvka_mst(const std::vector<from_to_weight_t> &graph,
+        const std::int32_t vertex_count, std::vector<from_to_weight_t> &result_tree) -> weight_t2
+    {
+        using edge_t = Inner::boruvka_edge<weight_t>;
+
+        result_tree.clear();
+
+        if (vertex_count <= 1 || graph.empty())
+        {
+            return {};
+        }
+
+        std::vector<edge_t> edges(graph.size());
+
+        {
+            const auto edge_count = static_cast<std::int64_t>(graph.size());
+
+#pragma omp parallel for default(none) shared(graph, edges, edge_count, vertex_count) schedule(static)
+            for (std::int64_t index = 0; index < edge_count; ++index)
+            {
+                const auto &[from, tod, weight] = graph[index];
+                assert(!(std::min(from, tod) < 0) && std::max(from, tod) < vertex_count);
+
+                edges[index] = edge_t{ static_cast<std::int32_t>(from), static_cast<std::int32_t>(tod), weight, index };
+            }
+        }
+
+        std::vector<edge_t> buffer;
+        std::vector<std::uint8_t> flags;
+
+        const auto remove_loops = [&edges, &buffer, &flags]
+        {
+            const auto kept = Inner::parallel_stable_partition(std::span<edge_t>(edges), buffer, flags,
+                [] [[nodiscard]] (const edge_t &edge)
+                {
+                    return edge.from != edge.tod;
+                });
+
+            edges.resize(kept);
+        };
+
+        remove_loops();
+
+        std::vector<std::int64_t> cheapest;
+        std::vector<std::int32_t> parents;
+        std::vector<std::int32_t> parents_buffer;
+        std::vector<std::int32_t> roots;
+        std::vector<std::int32_t> new_labels;
+
+        weight_t2 weights{};
+
+        for (auto component_count = vertex_count;
+             Inner::boruvka_cheapest_edges<weight_t>(edges, component_count, cheapest);)
+        {
+            weights += Inner::boruvka_hook<weight_t2, weight_t, from_to_weight_t>(
+                graph, edges, cheapest, parents, result_tree);
+
+            [[maybe_unused]] const auto old_count = component_count;
+
+            component_count = Inner::boruvka_contract(parents, parents_buffer, roots, new_labels);
+
+            assert(0 < component_count && component_count < old_count);
+
+            const auto edge_count = static_cast<std::int64_t>(edges.size());
+
+#pragma omp parallel for default(none) shared(edges, parents, new_labels, edge_count) schedule(static)
+            for (std::int64_t index = 0; index < edge_count; ++index)
+            {
+                auto &edge = edges[index];
+                edge.from = new_labels[parents[edge.from]];
+                edge.tod = new_labels[parents[edge.tod]];
+            }
+
+            remove_loops();
+        }
+
+        return weights;
+    }
+} // namespace Standard::Algorithms::Graphs
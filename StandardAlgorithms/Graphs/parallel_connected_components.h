@@ -0,0 +1,69 @@
+#pragma once
+#include"../Numbers/concurrent_disjoint_set.h"
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/require_utilities.h"
+#include<cstdint>
+#include<tuple>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // Connected components of an undirected graph given by an edge list,
+    // where an edge is a pair or a tuple starting with (from, to), e.g. (from, to, weight).
+    // The edges are united in parallel by a lock-free DSU; the edge list is not copied.
+    // The components are numbered 0, 1, .. in the order of their smallest vertices.
+    // Return the component count.
+    // Work O((v + e) * log(v)) in the worst case, nearly linear in practice.
+    template<std::signed_integral vertex_t, class edge_t>
+    auto parallel_connected_components(
+        const vertex_t vertex_count, const std::vector<edge_t> &edges, std::vector<vertex_t> &vertex_to_component)
+        -> vertex_t
+    {
+        require_positive(vertex_count, "vertex count");
+
+        // An exception cannot leave a parallel region, so check the edges before it.
+        for (const auto &edge : edges)
+        {
+            require_between(vertex_t{}, std::get<0>(edge), vertex_count - 1, "edge from");
+            require_between(vertex_t{}, std::get<1>(edge), vertex_count - 1, "edge to");
+        }
+
+        Standard::Algorithms::Numbers::concurrent_disjoint_set<vertex_t> dsu(vertex_count);
+
+        const auto edge_count = static_cast<std::int64_t>(edges.size());
+
+#pragma omp parallel for default(none) shared(dsu, edges, edge_count) schedule(static)
+        for (std::int64_t index = 0; index < edge_count; ++index)
+        {
+            const auto &edge = edges[index];
+
+            dsu.unite(static_cast<vertex_t>(std::get<0>(edge)), static_cast<vertex_t>(std::get<1>(edge)));
+        }
+
+        vertex_to_component.resize(vertex_count);
+
+#pragma omp parallel for default(none) shared(dsu, vertex_to_component, vertex_count) schedule(static)
+        for (vertex_t vertex = 0; vertex < vertex_count; ++vertex)
+        {
+            vertex_to_component[vertex] = dsu.parent(vertex);
+        }
+
+        constexpr vertex_t absent = -1;
+
+        std::vector<vertex_t> root_to_component(vertex_count, absent);
+        vertex_t component_count{};
+
+        for (auto &component : vertex_to_component)
+        {
+            auto &label = root_to_component[component];
+            if (label == absent)
+            {
+                label = component_count++;
+            }
+
+            component = label;
+        }
+
+        return component_count;
+    }
+} // namespace Standard::Algorithms::Graphs
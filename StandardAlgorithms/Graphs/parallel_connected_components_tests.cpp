@@ -0,0 +1,94 @@
+#include"parallel_connected_components_tests.h"
+#include"../Numbers/disjoint_set.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"parallel_connected_components.h"
+
+namespace
+{
+    using vertex_t = std::int32_t;
+    using edge_t = std::pair<vertex_t, vertex_t>;
+
+    void random_test(Standard::Algorithms::Utilities::random_t<vertex_t> &rnd)
+    {
+        constexpr auto max_size = 10'000;
+
+        const auto vertex_count = rnd(1, max_size);
+        const auto edge_count = rnd(0, vertex_count);
+
+        std::vector<edge_t> edges(edge_count);
+
+        for (auto &edge : edges)
+        {
+            edge = { rnd(0, vertex_count - 1), rnd(0, vertex_count - 1) };
+        }
+
+        Standard::Algorithms::Numbers::disjoint_set<vertex_t> dsu(vertex_count);
+
+        for (const auto &[from, tod] : edges)
+        {
+            dsu.unite(from, tod);
+        }
+
+        const auto name = "parallel_connected_components size " + std::to_string(vertex_count);
+
+        std::vector<vertex_t> components;
+
+        const auto count =
+            Standard::Algorithms::Graphs::parallel_connected_components<vertex_t>(vertex_count, edges, components);
+
+        ::Standard::Algorithms::ert::are_equal(dsu.count(), count, name + " count");
+        ::Standard::Algorithms::ert::are_equal(static_cast<std::size_t>(vertex_count), components.size(), name);
+
+        // The components are numbered in the order of their smallest vertices.
+        vertex_t next_component{};
+
+        for (vertex_t vertex{}; vertex < vertex_count; ++vertex)
+        {
+            const auto &component = components[vertex];
+
+            Standard::Algorithms::require_less_equal(component, next_component, name + " order");
+
+            if (component == next_component)
+            {
+                ++next_component;
+            }
+
+            const auto other = rnd(0, vertex_count - 1);
+
+            ::Standard::Algorithms::ert::are_equal(
+                dsu.are_connected(vertex, other), component == components[other], name + " same component");
+        }
+
+        ::Standard::Algorithms::ert::are_equal(count, next_component, name + " last component");
+    }
+
+    void bad_edge_test()
+    {
+        const std::vector<edge_t> edges{ { 0, 1 }, { 1, 3 } };
+        std::vector<vertex_t> components;
+
+        ::Standard::Algorithms::ert::expect_exception<std::out_of_range>(
+            "The value (3) must non exceed 2.",
+            [&edges, &components]
+            {
+                [[maybe_unused]] const auto count =
+                    Standard::Algorithms::Graphs::parallel_connected_components<vertex_t>(3, edges, components);
+            },
+            "parallel connected components bad edge");
+    }
+} // namespace
+
+void Standard::Algorithms::Graphs::Tests::parallel_connected_components_tests()
+{
+    Standard::Algorithms::Utilities::random_t<vertex_t> rnd{};
+
+    constexpr auto steps = 10;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        random_test(rnd);
+    }
+
+    bad_edge_test();
+}
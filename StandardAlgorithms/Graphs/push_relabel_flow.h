@@ -0,0 +1,341 @@
+#pragma once
+#include"edmonds_karp_flow.h"
+#include"flow_residual_arcs.h"
+#include<algorithm>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+
+namespace Standard::Algorithms::Graphs
+{
+    // Highest-label push-relabel max flow over the flat residual arcs.
+    // - Global relabel: the exact distances to the sink by a backward BFS, now and then.
+    // - Gap: when no vertex has the height h, the vertices above h cannot reach the sink.
+    // The first phase finds a max preflow, and the second one returns the excesses to the source.
+    // Time O(v*v*sqrt(e)).
+    template<std::signed_integral weight_t>
+    struct push_relabel_flow_engine final
+    {
+        // The "graph" MUST have all the reverse edges - same as for edmonds_karp_flow.
+        template<class edge_t>
+        constexpr explicit push_relabel_flow_engine(const std::vector<std::vector<edge_t>> &graph)
+            : Arcs(graph)
+            , Size(Arcs.vertex_count())
+        {
+        }
+
+        [[nodiscard]] constexpr auto max_flow(const std::int32_t source, const std::int32_t sink) -> weight_t
+        {
+            assert(!(source < 0) && source < Size && !(sink < 0) && sink < Size && source != sink);
+
+            init_vertex_arrays();
+
+            for (auto arc = Arcs.first[source]; arc < Arcs.first[source + 1LL]; ++arc)
+            {
+                if (weight_t{} < Arcs.residuals[arc])
+                {
+                    push(arc, source, Arcs.residuals[arc]);
+                }
+            }
+
+            // Find a max preflow.
+            run_phase(sink, source);
+
+            // The rest of the excess cannot reach the sink - return it.
+            run_phase(source, sink);
+
+            return Excesses[sink];
+        }
+
+        // Write the flows back.
+        template<class edge_t>
+        constexpr void get_flows(std::vector<std::vector<edge_t>> &graph) const
+        {
+            Arcs.get_flows(graph);
+        }
+
+private:
+        static constexpr std::int32_t none = -1;
+
+        constexpr void init_vertex_arrays()
+        {
+            Excesses.assign(Size, weight_t{});
+            Heights.assign(Size, Size);
+            Currents.assign(Arcs.first.cbegin(), Arcs.first.cend() - 1);
+
+            Layer_firsts.assign(Size, none);
+            Active_firsts.assign(Size, none);
+            Nexts.assign(Size, none);
+            Previouses.assign(Size, none);
+            Active_nexts.assign(Size, none);
+        }
+
+        constexpr void push(const std::size_t arc, const std::int32_t from, const weight_t delta)
+        {
+            Arcs.push(arc, delta);
+
+            Excesses[from] -= delta;
+            Excesses[Arcs.heads[arc]] += delta;
+        }
+
+        // The doubly linked list of all the vertices at a height below Size.
+        constexpr void add_to_layer(const std::int32_t vertex)
+        {
+            const auto &height = Heights[vertex];
+            assert(!(height < 0) && height < Size);
+
+            const auto first = Layer_firsts[height];
+            Nexts[vertex] = first;
+            Previouses[vertex] = none;
+
+            if (first != none)
+            {
+                Previouses[first] = vertex;
+            }
+
+            Layer_firsts[height] = vertex;
+            Max_height = std::max(Max_height, height);
+        }
+
+        constexpr void remove_from_layer(const std::int32_t vertex)
+        {
+            const auto &next = Nexts[vertex];
+            const auto &prev = Previouses[vertex];
+
+            if (prev == none)
+            {
+                Layer_firsts[Heights[vertex]] = next;
+            }
+            else
+            {
+                Nexts[prev] = next;
+            }
+
+            if (next != none)
+            {
+                Previouses[next] = prev;
+            }
+        }
+
+        constexpr void add_active(const std::int32_t vertex)
+        {
+            const auto &height = Heights[vertex];
+            assert(!(height < 0) && height < Size);
+
+            Active_nexts[vertex] = Active_firsts[height];
+            Active_firsts[height] = vertex;
+            Max_active_height = std::max(Max_active_height, height);
+        }
+
+        // Exact heights: BFS from the target over the arcs having residual capacity towards it.
+        // The unreached vertices are lifted to Size as they cannot reach the target.
+        constexpr void global_relabel(const std::int32_t target, const std::int32_t blocked)
+        {
+            Heights.assign(Size, Size);
+            Layer_firsts.assign(Size, none);
+            Active_firsts.assign(Size, none);
+            Max_height = 0;
+            Max_active_height = none;
+
+            Heights[target] = 0;
+            Bfs_queue.clear();
+            Bfs_queue.push_back(target);
+
+            for (std::size_t index{}; index < Bfs_queue.size(); ++index)
+            {
+                const auto cur = Bfs_queue[index];
+                const auto next_height = Heights[cur] + 1;
+
+                for (auto arc = Arcs.first[cur]; arc < Arcs.first[cur + 1LL]; ++arc)
+                {
+                    const auto &tod = Arcs.heads[arc];
+
+                    if (Heights[tod] == Size && tod != blocked && weight_t{} < Arcs.residuals[Arcs.reverses[arc]])
+                    {
+                        Heights[tod] = next_height;
+                        Bfs_queue.push_back(tod);
+                    }
+                }
+            }
+
+            for (const auto &vertex : Bfs_queue)
+            {
+                Currents[vertex] = Arcs.first[vertex];
+                add_to_layer(vertex);
+
+                if (vertex != target && weight_t{} < Excesses[vertex])
+                {
+                    add_active(vertex);
+                }
+            }
+
+            Work = 0;
+        }
+
+        // No vertex is left at the height - lift all above.
+        constexpr void gap(const std::int32_t empty_height)
+        {
+            for (auto height = empty_height + 1; height <= Max_height; ++height)
+            {
+                for (auto vertex = Layer_firsts[height]; vertex != none; vertex = Nexts[vertex])
+                {
+                    Heights[vertex] = Size;
+                }
+
+                Layer_firsts[height] = none;
+                Active_firsts[height] = none;
+            }
+
+            Max_height = empty_height - 1;
+            Max_active_height = std::min(Max_active_height, Max_height);
+        }
+
+        // Return the new height.
+        constexpr auto relabel(const std::int32_t vertex) -> std::int32_t
+        {
+            auto min_height = Size;
+            auto min_arc = Arcs.first[vertex];
+
+            for (auto arc = Arcs.first[vertex]; arc < Arcs.first[vertex + 1LL]; ++arc)
+            {
+                if (weight_t{} < Arcs.residuals[arc] && Heights[Arcs.heads[arc]] < min_height)
+                {
+                    min_height = Heights[Arcs.heads[arc]];
+                    min_arc = arc;
+                }
+            }
+
+            constexpr std::size_t relabel_cost = 12;
+            Work += relabel_cost + Arcs.first[vertex + 1LL] - Arcs.first[vertex];
+
+            Currents[vertex] = min_arc;
+
+            return min_height + 1;
+        }
+
+        constexpr void discharge(const std::int32_t vertex, const std::int32_t target)
+        {
+            for (;;)
+            {
+                const auto height = Heights[vertex];
+                const auto stop = Arcs.first[vertex + 1LL];
+
+                auto &arc = Currents[vertex];
+
+                for (; arc < stop; ++arc)
+                {
+                    const auto &tod = Arcs.heads[arc];
+
+                    if (!(weight_t{} < Arcs.residuals[arc]) || Heights[tod] + 1 != height)
+                    {
+                        continue;
+                    }
+
+                    const auto was_inactive = !(weight_t{} < Excesses[tod]);
+
+                    push(arc, vertex, std::min(Excesses[vertex], Arcs.residuals[arc]));
+
+                    if (was_inactive && tod != target)
+                    {
+                        add_active(tod);
+                    }
+
+                    if (Excesses[vertex] == weight_t{})
+                    {
+                        return;
+                    }
+                }
+
+                remove_from_layer(vertex);
+
+                if (Layer_firsts[height] == none)
+                {
+                    Heights[vertex] = Size;
+                    gap(height);
+                    return;
+                }
+
+                Heights[vertex] = relabel(vertex);
+
+                if (Size <= Heights[vertex])
+                {
+                    Heights[vertex] = Size;
+                    return;
+                }
+
+                add_to_layer(vertex);
+            }
+        }
+
+        constexpr void run_phase(const std::int32_t target, const std::int32_t blocked)
+        {
+            const auto arc_count = Arcs.arc_count();
+            const auto global_relabel_work = static_cast<std::size_t>(Size) * 12U + arc_count * 2U;
+
+            global_relabel(target, blocked);
+
+            while (0 <= Max_active_height)
+            {
+                auto &first = Active_firsts[Max_active_height];
+                if (first == none)
+                {
+                    --Max_active_height;
+                    continue;
+                }
+
+                const auto vertex = first;
+                first = Active_nexts[vertex];
+
+                discharge(vertex, target);
+
+                if (global_relabel_work < Work)
+                {
+                    global_relabel(target, blocked);
+                }
+            }
+        }
+
+        flow_residual_arcs<weight_t> Arcs;
+        std::int32_t Size;
+
+        std::vector<weight_t> Excesses{};
+        std::vector<std::int32_t> Heights{};
+        std::vector<std::size_t> Currents{};
+
+        std::vector<std::int32_t> Layer_firsts{};
+        std::vector<std::int32_t> Nexts{};
+        std::vector<std::int32_t> Previouses{};
+
+        std::vector<std::int32_t> Active_firsts{};
+        std::vector<std::int32_t> Active_nexts{};
+
+        std::vector<std::int32_t> Bfs_queue{};
+
+        std::int32_t Max_height{};
+        std::int32_t Max_active_height = none;
+        std::size_t Work{};
+    };
+
+    // Find the max flow using the highest-label push-relabel.
+    // The "graph" MUST have all the reverse edges!
+    // The input, output are the same as of edmonds_karp_flow.
+    template<std::signed_integral weight_t, class edge_t>
+    constexpr auto push_relabel_flow(
+        const std::int32_t source, std::vector<std::vector<edge_t>> &graph, const std::int32_t destination) -> weight_t
+    {
+        check_data_and_zero_flow<weight_t, edge_t>(source, graph, destination);
+
+        if (graph[source].empty())
+        {
+            return {};
+        }
+
+        push_relabel_flow_engine<weight_t> engine(graph);
+
+        const auto result = engine.max_flow(source, destination);
+        engine.get_flows(graph);
+
+        return result;
+    }
+} // namespace Standard::Algorithms::Graphs
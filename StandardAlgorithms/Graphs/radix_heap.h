@@ -0,0 +1,139 @@
+#pragma once
+#include"../Utilities/require_utilities.h"
+#include<array>
+#include<bit>
+#include<climits>
+#include<concepts>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Heaps
+{
+    // A monotone min-priority queue for unsigned integer keys:
+    // a pushed key must not be less than the last popped key, which is the case in Dijkstra's algorithm.
+    // An item is kept in the bucket by the highest bit where its key differs from the last popped key.
+    // Each item can move only to lower buckets, so it is moved at most (1 + bit count) times.
+    // There is no decrease_key - push a duplicate, and skip the stale items when popped.
+    // Time amortized: push O(1), pop O(bit count).
+    template<std::unsigned_integral key_t1, class value_t1>
+    struct radix_heap final
+    {
+        using key_t = key_t1;
+        using value_t = value_t1;
+        using item_t = std::pair<key_t, value_t>;
+
+        static constexpr auto bucket_count = sizeof(key_t) * CHAR_BIT + 1ZU;
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        [[nodiscard]] constexpr auto is_empty() const noexcept -> bool
+        {
+            return 0ZU == Size;
+        }
+
+        [[nodiscard]] constexpr auto last_key() const noexcept -> key_t
+        {
+            return Last;
+        }
+
+        constexpr void clear() noexcept
+        {
+            for (auto &bucket : Buckets)
+            {
+                bucket.clear();
+            }
+
+            Size = {};
+            Last = {};
+        }
+
+        constexpr void push(const key_t &key, const value_t &value)
+        {
+            if (key < Last) [[unlikely]]
+            {
+                auto str = ::Standard::Algorithms::Utilities::w_stream();
+                str << "The pushed key " << key << " cannot be less than the last popped key " << Last
+                    << " in the radix heap.";
+
+                throw_exception(str);
+            }
+
+            Buckets[bucket_index(key)].emplace_back(key, value);
+            ++Size;
+        }
+
+        // Return the item with a minimum key.
+        [[nodiscard]] constexpr auto pop() -> item_t
+        {
+            if (is_empty()) [[unlikely]]
+            {
+                throw std::runtime_error("Cannot pop from an empty radix heap.");
+            }
+
+            if (Buckets[0].empty())
+            {
+                redistribute();
+            }
+
+            auto &bucket = Buckets[0];
+            assert(!bucket.empty() && bucket.back().first == Last);
+
+            auto item = std::move(bucket.back());
+            bucket.pop_back();
+            --Size;
+
+            return item;
+        }
+
+private:
+        [[nodiscard]] constexpr auto bucket_index(const key_t &key) const noexcept -> std::size_t
+        {
+            assert(Last <= key);
+
+            auto index = static_cast<std::size_t>(std::bit_width(static_cast<key_t>(key ^ Last)));
+
+            assert(index < bucket_count);
+            return index;
+        }
+
+        // Find the first non-empty bucket, and spread its items among the lower buckets.
+        constexpr void redistribute()
+        {
+            assert(0ZU < Size && Buckets[0].empty());
+
+            std::size_t index = 1;
+
+            while (Buckets[index].empty())
+            {
+                ++index;
+                assert(index < bucket_count);
+            }
+
+            auto &source = Buckets[index];
+
+            Last = source[0].first;
+
+            for (const auto &item : source)
+            {
+                Last = std::min(Last, item.first);
+            }
+
+            for (auto &item : source)
+            {
+                const auto lower = bucket_index(item.first);
+                assert(lower < index);
+
+                Buckets[lower].push_back(std::move(item));
+            }
+
+            source.clear();
+        }
+
+        std::array<std::vector<item_t>, bucket_count> Buckets{};
+        std::size_t Size{};
+        key_t Last{};
+    };
+} // namespace Standard::Algorithms::Heaps
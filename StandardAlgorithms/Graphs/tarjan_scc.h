@@ -1,6 +1,10 @@
 #pragma once
+#include"../Utilities/require_utilities.h"
+#include"adjacency_graph.h"
+#include<algorithm>
 #include<array>
 #include<cstdint>
+#include<utility>
 #include<vector>
 
 namespace Standard::Algorithms::Graphs
@@ -28,4 +32,96 @@ namespace Standard::Algorithms::Graphs
     [[nodiscard]] extern auto tarjan_vertex_to_component() noexcept -> const std::array<std::int32_t, scc_max_size> &;
 
     [[nodiscard]] extern auto tarjan_components() noexcept -> std::vector<std::vector<std::int32_t>> &;
+
+    // Tarjan SCC without recursion for any adjacency graph e.g. a csr_graph, or std::vector<std::vector<int>>.
+    // Return the number of components; the vertex_to_component are in [0, count),
+    // numbered in the reverse topological order of the condensation.
+    // Time O(n + m).
+    [[nodiscard]] constexpr auto tarjan_strongly_connected_components(
+        const adjacency_graph auto &digraph, std::vector<std::int32_t> &vertex_to_component) -> std::int32_t
+    {
+        constexpr std::int32_t unvisited = -1;
+
+        const auto size = digraph.size();
+        require_greater(static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()), size, "digraph size");
+
+        vertex_to_component.assign(size, unvisited);
+
+        std::vector<std::int32_t> discovery_time(size, unvisited);
+        std::vector<std::int32_t> lower_index(size);
+        std::vector<std::int32_t> stack1;
+
+        // The vertex, and the position of its next edge to visit.
+        std::vector<std::pair<std::int32_t, std::size_t>> calls;
+
+        std::int32_t visit_cnt{};
+        std::int32_t comp_cnt{};
+
+        for (std::int32_t root{}; static_cast<std::size_t>(root) < size; ++root)
+        {
+            if (discovery_time[root] != unvisited)
+            {
+                continue;
+            }
+
+            discovery_time[root] = lower_index[root] = visit_cnt++;
+            stack1.push_back(root);
+            calls.emplace_back(root, 0ZU);
+
+            do
+            {
+                const auto from = calls.back().first;
+                const auto &edges = digraph[from];
+
+                if (auto &position = calls.back().second; position < edges.size())
+                {
+                    const auto tod = static_cast<std::int32_t>(edges[position]);
+                    ++position;
+
+                    assert(!(tod < 0) && static_cast<std::size_t>(tod) < size);
+
+                    if (discovery_time[tod] == unvisited)
+                    {
+                        discovery_time[tod] = lower_index[tod] = visit_cnt++;
+                        stack1.push_back(tod);
+                        calls.emplace_back(tod, 0ZU);
+                    }
+                    else if (vertex_to_component[tod] == unvisited)
+                    {// Still in the stack.
+                        lower_index[from] = std::min(lower_index[from], discovery_time[tod]);
+                    }
+
+                    continue;
+                }
+
+                calls.pop_back();
+
+                if (lower_index[from] == discovery_time[from])
+                {
+                    std::int32_t top{};
+
+                    do
+                    {
+                        assert(!stack1.empty());
+
+                        top = stack1.back();
+                        stack1.pop_back();
+                        vertex_to_component[top] = comp_cnt;
+                    } while (from != top);
+
+                    ++comp_cnt;
+                }
+
+                if (!calls.empty())
+                {
+                    const auto parent = calls.back().first;
+                    lower_index[parent] = std::min(lower_index[parent], lower_index[from]);
+                }
+            } while (!calls.empty());
+        }
+
+        assert(stack1.empty());
+
+        return comp_cnt;
+    }
 } // namespace Standard::Algorithms::Graphs
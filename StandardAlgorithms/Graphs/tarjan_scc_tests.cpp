@@ -1,5 +1,6 @@
 #include"tarjan_scc_tests.h"
 #include"../Utilities/test_utilities.h"
+#include"csr_graph.h"
 #include"tarjan_scc.h"
 #include<initializer_list>
 
@@ -58,9 +59,9 @@ namespace
         add_edges({ 10, 12 });
     }
 
-    void check_scc()
+    [[nodiscard]] auto expected_components() -> std::vector<std::vector<std::int32_t>>
     {
-        const std::vector<std::vector<std::int32_t>> expected_scc{ { 0 }, { 1, 2, 3 },
+        return { { 0 }, { 1, 2, 3 },
             // NOLINTNEXTLINE
             { 4, 5, 6, 7 },
             // NOLINTNEXTLINE
@@ -71,6 +72,11 @@ namespace
             { 10, 11, 12 },
             // NOLINTNEXTLINE
             { 13 } };
+    }
+
+    void check_scc()
+    {
+        const auto expected_scc = expected_components();
 
         const auto expected_size = static_cast<std::int32_t>(expected_scc.size());
         ::Standard::Algorithms::ert::are_equal(
@@ -87,6 +93,68 @@ namespace
 
         ::Standard::Algorithms::ert::are_equal(expected_scc, actual_components, "components");
     }
+
+    void check_scc_iterative(const auto &digraph, const std::string &name)
+    {
+        std::vector<std::int32_t> vertex_to_component;
+
+        const auto count =
+            Standard::Algorithms::Graphs::tarjan_strongly_connected_components(digraph, vertex_to_component);
+
+        const auto expected_scc = expected_components();
+        ::Standard::Algorithms::ert::are_equal(
+            static_cast<std::int32_t>(expected_scc.size()), count, name + " number of components");
+
+        std::vector<std::vector<std::int32_t>> actual_components(count);
+
+        for (std::int32_t vertex{}; static_cast<std::size_t>(vertex) < vertex_to_component.size(); ++vertex)
+        {
+            const auto &component = vertex_to_component[vertex];
+            Standard::Algorithms::require_less_equal(0, component, name + " component");
+
+            actual_components.at(component).push_back(vertex);
+        }
+
+        // The vertex order is ascending.
+        std::sort(actual_components.begin(), actual_components.end());
+
+        ::Standard::Algorithms::ert::are_equal(expected_scc, actual_components, name + " components");
+    }
+
+    void test_scc_iterative()
+    {
+        const auto size = Standard::Algorithms::Graphs::tarjan_graph_size();
+        const auto &graf = Standard::Algorithms::Graphs::tarjan_graph_ptr();
+
+        const std::vector<std::vector<std::int32_t>> digraph(graf.cbegin(), graf.cbegin() + size);
+        check_scc_iterative(digraph, "vector digraph");
+
+        {// A self-loop does not change the components.
+            auto with_loops = digraph;
+            with_loops.at(0).push_back(0);
+            // NOLINTNEXTLINE
+            with_loops.at(5).push_back(5);
+
+            check_scc_iterative(with_loops, "self-loop digraph");
+        }
+
+        using csr_graph_t = Standard::Algorithms::Graphs::csr_graph<std::int32_t, std::int32_t, std::uint32_t>;
+
+        std::vector<csr_graph_t::edge_tuple_t> edges;
+
+        for (std::int32_t from{}; from < size; ++from)
+        {
+            for (const auto &tod : digraph[from])
+            {
+                edges.emplace_back(from, tod, 1);
+            }
+        }
+
+        const csr_graph_t csr(size, edges);
+        ::Standard::Algorithms::ert::are_equal(edges.size(), csr.edge_count(), "csr edge count");
+
+        check_scc_iterative(csr, "csr digraph");
+    }
 } // namespace
 
 void Standard::Algorithms::Graphs::Tests::tarjan_scc_tests()
@@ -94,4 +162,5 @@ void Standard::Algorithms::Graphs::Tests::tarjan_scc_tests()
     init_digraph();
     tarjan_scc();
     check_scc();
+    test_scc_iterative();
 }
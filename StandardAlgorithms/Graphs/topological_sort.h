@@ -1,6 +1,7 @@
 #pragma once
 #include"../Numbers/color_2bit.h"
 #include"../Utilities/is_debug.h"
+#include"adjacency_graph.h"
 #include<algorithm>
 #include<concepts>
 #include<optional>
@@ -9,8 +10,8 @@
 
 namespace Standard::Algorithms::Graphs::Inner
 {
-    [[nodiscard]] constexpr auto topol_sort_dfs(
-        const auto &dag, std::size_t node, auto &colors, std::vector<std::size_t> &result, auto &sta) -> bool
+    [[nodiscard]] constexpr auto topol_sort_dfs(const adjacency_graph auto &dag, std::size_t node, auto &colors,
+        std::vector<std::size_t> &result, auto &sta) -> bool
     {
         const auto size = dag.size();
         assert(node < size);
@@ -88,7 +89,8 @@ namespace Standard::Algorithms::Graphs
     // Return the vertices sorted in the topological order.
     // Vertices must be from 0 to (size - 1).
     // If the directed graph is not acyclic, return null opt.
-    [[nodiscard]] constexpr auto topological_sort(const auto &dag) -> std::optional<std::vector<std::size_t>>
+    [[nodiscard]] constexpr auto topological_sort(const adjacency_graph auto &dag)
+        -> std::optional<std::vector<std::size_t>>
     {
         const auto size = dag.size();
 
@@ -144,7 +146,8 @@ namespace Standard::Algorithms::Graphs
     }
 
     // The vertices are ordered by their descending finish times.
-    [[nodiscard]] constexpr auto topological_sort_via_dfs(const auto &dag) -> std::optional<std::vector<std::size_t>>
+    [[nodiscard]] constexpr auto topological_sort_via_dfs(const adjacency_graph auto &dag)
+        -> std::optional<std::vector<std::size_t>>
     {
         const auto size = dag.size();
 
@@ -1,6 +1,7 @@
 #include"topological_sort_tests.h"
 #include"../Utilities/simple_test_case.h"
 #include"../Utilities/test_utilities.h"
+#include"csr_graph.h"
 #include"topological_sort.h"
 
 namespace
@@ -100,6 +101,39 @@ namespace
         {
             throw std::invalid_argument("The dag must have been acyclic in topological_sort_via_dfs.");
         }
+
+        using csr_graph_t = Standard::Algorithms::Graphs::csr_graph<std::int32_t, std::int32_t>;
+
+        std::vector<csr_graph_t::edge_tuple_t> edges;
+
+        for (std::size_t from{}; from < test.input().size(); ++from)
+        {
+            for (const auto &tod : test.input()[from])
+            {
+                edges.emplace_back(static_cast<std::int32_t>(from), static_cast<std::int32_t>(tod), 1);
+            }
+        }
+
+        const csr_graph_t csr(test.input().size(), edges);
+
+        if (const auto actual = Standard::Algorithms::Graphs::topological_sort(csr); actual.has_value()) [[likely]]
+        {
+            require_one_of("csr topological_sort", test.output(), actual.value());
+        }
+        else
+        {
+            throw std::invalid_argument("The dag must have been acyclic in csr topological_sort.");
+        }
+
+        if (const auto actual = Standard::Algorithms::Graphs::topological_sort_via_dfs(csr); actual.has_value())
+            [[likely]]
+        {
+            require_one_of("csr topological_sort_via_dfs", test.output(), actual.value());
+        }
+        else
+        {
+            throw std::invalid_argument("The dag must have been acyclic in csr topological_sort_via_dfs.");
+        }
     }
 } // namespace
 
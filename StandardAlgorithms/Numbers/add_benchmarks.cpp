@@ -0,0 +1,108 @@
+#include"add_benchmarks.h"
+#include"../Utilities/random.h"
+#include"merge_sort.h"
+#include"quick_select_kth_smallest.h"
+#include<algorithm>
+#include<cstdint>
+#include<memory>
+#include<utility>
+
+namespace
+{
+    using int_t = std::int64_t;
+
+    constexpr std::size_t one_million = 1'000'000;
+
+    // Each repetition restores the same random input in the untimed "prepare".
+    [[nodiscard]] auto make_input(const std::size_t size) -> std::shared_ptr<const std::vector<int_t>>
+    {
+        std::vector<int_t> source;
+        Standard::Algorithms::Utilities::fill_random(source, size);
+
+        return std::make_shared<const std::vector<int_t>>(std::move(source));
+    }
+
+    template<class sort_t>
+    [[nodiscard]] auto sort_setup(sort_t sorter) -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [sorter](const std::size_t size) -> Standard::Algorithms::benchmark_run
+        {
+            auto source = make_input(size);
+            auto data = std::make_shared<std::vector<int_t>>();
+
+            Standard::Algorithms::benchmark_body_t prepare = [source, data]
+            {
+                *data = *source;
+            };
+
+            Standard::Algorithms::benchmark_body_t body = [data, sorter]
+            {
+                sorter(*data);
+            };
+
+            return { std::move(body), std::move(prepare) };
+        };
+    }
+
+    template<class select_t>
+    [[nodiscard]] auto select_setup(select_t selector) -> Standard::Algorithms::benchmark_setup_t
+    {
+        return [selector](const std::size_t size) -> Standard::Algorithms::benchmark_run
+        {
+            auto source = make_input(size);
+            auto data = std::make_shared<std::vector<int_t>>();
+
+            Standard::Algorithms::benchmark_body_t prepare = [source, data]
+            {
+                *data = *source;
+            };
+
+            Standard::Algorithms::benchmark_body_t body = [data, selector]
+            {
+                selector(*data, data->size() / 2U);
+            };
+
+            return { std::move(body), std::move(prepare) };
+        };
+    }
+} // namespace
+
+void Standard::Algorithms::Numbers::Benchmarks::add_benchmarks(std::vector<benchmark_function> &benchmarks)
+{
+    // The claims in "merge_sort.h" are about 4M and 8M items.
+    const std::vector<std::size_t> sort_sizes{ one_million, 4 * one_million, 8 * one_million };
+
+    const std::vector<std::size_t> select_sizes{ one_million, 4 * one_million };
+
+    benchmarks.emplace_back("std::sort", sort_setup(
+                                             [](auto &data)
+                                             {
+                                                 std::sort(data.begin(), data.end());
+                                             }),
+        sort_sizes);
+
+    benchmarks.emplace_back("parallel_merge_sort", sort_setup(
+                                                       [](auto &data)
+                                                       {
+                                                           Standard::Algorithms::Numbers::parallel_merge_sort(data);
+                                                       }),
+        sort_sizes, "std::sort");
+
+    benchmarks.emplace_back("std::nth_element", select_setup(
+                                                    [](auto &data, const std::size_t rank)
+                                                    {
+                                                        std::nth_element(data.begin(),
+                                                            data.begin() + static_cast<std::ptrdiff_t>(rank),
+                                                            data.end());
+                                                    }),
+        select_sizes);
+
+    benchmarks.emplace_back("quick_select_kth_smallest",
+        select_setup(
+            [](auto &data, const std::size_t rank)
+            {
+                [[maybe_unused]] const auto position =
+                    Standard::Algorithms::Numbers::quick_select_kth_smallest<int_t>(data, rank);
+            }),
+        select_sizes, "std::nth_element");
+}
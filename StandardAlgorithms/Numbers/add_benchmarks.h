@@ -0,0 +1,7 @@
+#pragma once
+#include"../Utilities/benchmark_function.h"
+
+namespace Standard::Algorithms::Numbers::Benchmarks
+{
+    void add_benchmarks(std::vector<benchmark_function> &benchmarks);
+} // namespace Standard::Algorithms::Numbers::Benchmarks
@@ -20,6 +20,7 @@
 #include"coin_change_count_tests.h"
 #include"coin_line_max_sum_tests.h"
 #include"compression_simple_tests.h"
+#include"concurrent_disjoint_set_tests.h"
 #include"count_add_sub_put_parentheses_distinct_tests.h"
 #include"count_arrays_different_adjacent_same_1n_tests.h"
 #include"count_catalan_braces_tests.h"
@@ -126,6 +127,7 @@
 #include"quadratic_residue_tests.h"
 #include"quick_select_kth_smallest_tests.h"
 #include"random_not_degenerator_tests.h"
+#include"rank_select_bit_vector_tests.h"
 #include"report_differences_tests.h"
 #include"require_same_ranks_tests.h"
 #include"smawk_find_row_mins_in_tot_monotone_matrix_tests.h"
@@ -158,13 +160,16 @@
 #include"xor_queue_tests.h"
 // todo(p4): move out from Numbers
 #include"../Utilities/adl_tests.h"
+#include"../Utilities/benchmark_statistics_tests.h"
 #include"../Utilities/constructor_tests.h"
 #include"../Utilities/find_first_repetition_tests.h"
 #include"../Utilities/generatorin_tests.h"
 #include"../Utilities/is_concept_tests.h"
 #include"../Utilities/marasmus_tests.h"
+#include"../Utilities/perf_counters_tests.h"
 #include"../Utilities/specialization_tests.h"
 #include"../Utilities/stdream_tests.h"
+#include"../Utilities/test_timing_database_tests.h"
 #include"../Utilities/uniq_name_tests.h"
 #include"../Utilities/zu_string_tests.h"
 
@@ -483,6 +488,8 @@ void Standard::Algorithms::Numbers::Tests::add_tests(
 
     tests.emplace_back("disjoint_set_tests", &disjoint_set_tests, 1);
 
+    tests.emplace_back("concurrent_disjoint_set_tests", &concurrent_disjoint_set_tests, 2);
+
     tests.emplace_back("longest_increasing_subsequence_tests", &longest_increasing_subsequence_tests, 2);
 
     tests.emplace_back("sorted_arrays_median_element_tests", &sorted_arrays_median_element_tests, 2);
@@ -492,6 +499,7 @@ void Standard::Algorithms::Numbers::Tests::add_tests(
     tests.emplace_back("median_selection_tests", &median_selection_tests, 2);
 
     tests.emplace_back("hashed_bit_array_tests", &hashed_bit_array_tests, 1);
+    tests.emplace_back("rank_select_bit_vector_tests", &rank_select_bit_vector_tests, 1);
 
     tests.emplace_back("hash_utilities_tests", &hash_utilities_tests, 1);
 
@@ -505,6 +513,8 @@ void Standard::Algorithms::Numbers::Tests::add_tests(
 
     // todo(p4): move out from Numbers
     tests.emplace_back("adl_tests", &Standard::Algorithms::Utilities::Tests::adl_tests, 1);
+    tests.emplace_back(
+        "benchmark_statistics_tests", &Standard::Algorithms::Utilities::Tests::benchmark_statistics_tests, 1);
     tests.emplace_back("constructor_tests", &Standard::Algorithms::Utilities::Tests::constructor_tests, 1);
     tests.emplace_back(
         "find_first_repetition_tests", &Standard::Algorithms::Utilities::Tests::find_first_repetition_tests, 1);
@@ -512,8 +522,11 @@ void Standard::Algorithms::Numbers::Tests::add_tests(
     tests.emplace_back("is_concept_tests", &Standard::Algorithms::Utilities::Tests::is_concept_tests, 1);
     tests.emplace_back("uniq_name_tests", &Standard::Algorithms::Utilities::Tests::uniq_name_tests, 1);
     tests.emplace_back("marasmus_tests", &Standard::Algorithms::Utilities::Tests::marasmus_tests, 1);
+    tests.emplace_back("perf_counters_tests", &Standard::Algorithms::Utilities::Tests::perf_counters_tests, 1);
     tests.emplace_back("specialization_tests", &Standard::Algorithms::Utilities::Tests::specialization_tests, 1);
     tests.emplace_back("stdream_tests", &Standard::Algorithms::Utilities::Tests::stdream_tests, 1);
+    tests.emplace_back(
+        "test_timing_database_tests", &Standard::Algorithms::Utilities::Tests::test_timing_database_tests, 1);
     tests.emplace_back("zu_string_tests", &Standard::Algorithms::Utilities::Tests::zu_string_tests, 1);
     // todo(p4): move out from Numbers
 }
@@ -19,6 +19,12 @@ namespace Standard::Algorithms::Numbers
 
         [[nodiscard]] auto count_set_bits() const -> std::uint64_t;
 
+        // The bit at a position p is the bit (p % 64) of the word (p / 64).
+        [[nodiscard]] inline constexpr auto words() const &noexcept -> const std::vector<std::uint64_t> &
+        {
+            return Data;
+        }
+
 private:
         std::vector<std::uint64_t> Data{};
     };
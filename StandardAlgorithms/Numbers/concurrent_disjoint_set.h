@@ -0,0 +1,124 @@
+#pragma once
+#include"../Utilities/iota_vector.h"
+#include"../Utilities/require_utilities.h"
+#include"disjoint_set.h"
+#include<atomic>
+#include<vector>
+
+namespace Standard::Algorithms::Numbers
+{
+    // Lock-free DSU: many threads can call parent, unite, are_connected at the same time.
+    // A root is linked under the root with the larger index by a CAS, so no cycle may appear without ranks.
+    // The parent does path splitting: each visited node is pointed to its grandparent by a CAS,
+    // and a failed CAS only means that another thread has already shortened the path.
+    // See also disjoint_set.h for the single-threaded version.
+    template<std::integral int_t>
+    requires(sizeof(int_t) <= sizeof(std::size_t) && std::atomic_ref<int_t>::is_always_lock_free)
+    struct concurrent_disjoint_set final
+    {
+        constexpr explicit concurrent_disjoint_set(const int_t &size)
+            : Parents(Standard::Algorithms::Utilities::iota_vector<int_t>(require_positive(size, "size")))
+            , Disjoint_set_count(size)
+        {
+        }
+
+        [[nodiscard]] inline auto count() const noexcept -> int_t
+        {
+            return Disjoint_set_count.load(std::memory_order_acquire);
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Parents.size();
+        }
+
+        [[nodiscard]] inline auto parent(int_t node) const -> int_t
+        {
+            check_node(node);
+
+            for (;;)
+            {
+                auto par = load(node);
+                if (par == node)
+                {
+                    return node;
+                }
+
+                if (const auto grand = load(par); par != grand)
+                {
+                    std::atomic_ref<int_t>(Parents[node]).compare_exchange_weak(
+                        par, grand, std::memory_order_acq_rel, std::memory_order_relaxed);
+                }
+
+                node = par;
+            }
+        }
+
+        // Return true when this call has joined 2 sets.
+        [[maybe_unused]] inline auto unite(int_t one, int_t two) -> bool
+        {
+            for (;;)
+            {
+                one = parent(one);
+                two = parent(two);
+
+                if (one == two)
+                {
+                    return false;
+                }
+
+                if (two < one)
+                {
+                    std::swap(one, two);
+                }
+
+                // The "one" might have got a parent in between.
+                if (auto expected = one; std::atomic_ref<int_t>(Parents[one]).compare_exchange_strong(
+                        expected, two, std::memory_order_acq_rel, std::memory_order_relaxed))
+                {
+                    Disjoint_set_count.fetch_sub(1, std::memory_order_acq_rel);
+                    return true;
+                }
+            }
+        }
+
+        [[nodiscard]] inline auto are_connected(int_t one, int_t two) const -> bool
+        {
+            for (;;)
+            {
+                one = parent(one);
+                two = parent(two);
+
+                if (one == two)
+                {
+                    return true;
+                }
+
+                // When the "one" is still a root, the sets were disjoint after "two" had been found.
+                if (load(one) == one)
+                {
+                    return false;
+                }
+            }
+        }
+
+private:
+        [[nodiscard]] inline auto load(const int_t &node) const noexcept -> int_t
+        {
+            return std::atomic_ref<int_t>(Parents[node]).load(std::memory_order_acquire);
+        }
+
+        constexpr void check_node(const int_t &node) const
+        {
+            if (!(int_t{} <= node && node < static_cast<int_t>(Parents.size()))) [[unlikely]]
+            {
+                auto err = "concurrent_disjoint_set bad node " + std::to_string(node) + ".";
+
+                throw disjoint_set_exception(err);
+            }
+        }
+
+        mutable std::vector<int_t> Parents;
+        std::atomic<int_t> Disjoint_set_count;
+    };
+} // namespace Standard::Algorithms::Numbers
@@ -0,0 +1,92 @@
+#include"concurrent_disjoint_set_tests.h"
+#include"../Utilities/ert.h"
+#include"../Utilities/random.h"
+#include"concurrent_disjoint_set.h"
+#include"disjoint_set.h"
+
+namespace
+{
+    using int_t = std::int32_t;
+    using pair_t = std::pair<int_t, int_t>;
+
+    void bad_node_test()
+    {
+        constexpr int_t size = 3;
+
+        Standard::Algorithms::Numbers::concurrent_disjoint_set<int_t> dsu(size);
+
+        ::Standard::Algorithms::ert::expect_exception<Standard::Algorithms::Numbers::disjoint_set_exception>(
+            "concurrent_disjoint_set bad node 3.",
+            [&dsu]
+            {
+                return dsu.unite(0, size);
+            },
+            "concurrent_disjoint_set bad node");
+    }
+
+    void random_test(Standard::Algorithms::Utilities::random_t<int_t> &rnd)
+    {
+        constexpr auto max_size = 10'000;
+
+        const auto size = rnd(1, max_size);
+        const auto pair_count = rnd(0, size * 2);
+
+        std::vector<pair_t> pairs(pair_count);
+
+        for (auto &pair : pairs)
+        {
+            pair = { rnd(0, size - 1), rnd(0, size - 1) };
+        }
+
+        Standard::Algorithms::Numbers::disjoint_set<int_t> expected(size);
+
+        for (const auto &[one, two] : pairs)
+        {
+            expected.unite(one, two);
+        }
+
+        Standard::Algorithms::Numbers::concurrent_disjoint_set<int_t> dsu(size);
+        std::int64_t united{};
+
+#pragma omp parallel for default(none) shared(dsu, pairs, pair_count) reduction(+ : united)
+        for (int_t index = 0; index < pair_count; ++index)
+        {
+            const auto &[one, two] = pairs[index];
+
+            // Mix the reads with the writes.
+            [[maybe_unused]] const auto conn = dsu.are_connected(two, one);
+
+            united += dsu.unite(one, two) ? 1 : 0;
+        }
+
+        const auto name = "size " + std::to_string(size);
+
+        ::Standard::Algorithms::ert::are_equal(expected.count(), dsu.count(), name + " count");
+        ::Standard::Algorithms::ert::are_equal(size - expected.count(), united, name + " successful unions");
+
+        for (int_t node{}; node < size; ++node)
+        {
+            const auto other = rnd(0, size - 1);
+
+            ::Standard::Algorithms::ert::are_equal(
+                expected.are_connected(node, other), dsu.are_connected(node, other), name + " are_connected");
+
+            ::Standard::Algorithms::ert::are_equal(expected.parent(node) == expected.parent(other),
+                dsu.parent(node) == dsu.parent(other), name + " parent");
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Numbers::Tests::concurrent_disjoint_set_tests()
+{
+    bad_node_test();
+
+    Standard::Algorithms::Utilities::random_t<int_t> rnd{};
+
+    constexpr auto steps = 10;
+
+    for (std::int32_t step{}; step < steps; ++step)
+    {
+        random_test(rnd);
+    }
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Numbers::Tests
+{
+    void concurrent_disjoint_set_tests();
+}
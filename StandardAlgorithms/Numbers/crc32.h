@@ -0,0 +1,49 @@
+#pragma once
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<span>
+
+namespace Standard::Algorithms::Numbers::Inner
+{
+    // The remainders of all bytes by the reflected polynomial.
+    [[nodiscard]] constexpr auto make_crc32_table() noexcept -> std::array<std::uint32_t, 256>
+    {
+        constexpr std::uint32_t polynomial = 0xEDB8'8320U;
+
+        std::array<std::uint32_t, 256> table{};
+
+        for (std::uint32_t byte{}; auto &remainder : table)
+        {
+            remainder = byte++;
+
+            for (std::uint32_t bit{}; bit < 8U; ++bit)
+            {
+                remainder = (remainder >> 1U) ^ ((remainder & 1U) != 0U ? polynomial : 0U);
+            }
+        }
+
+        return table;
+    }
+
+    inline constexpr auto crc32_table = make_crc32_table();
+} // namespace Standard::Algorithms::Numbers::Inner
+
+namespace Standard::Algorithms::Numbers
+{
+    // CRC-32 of IEEE 802.3, zip, PNG: "123456789" gives 0xCBF43926.
+    // Pass the previous result as the "crc" to continue over several pieces.
+    // Time O(n).
+    [[nodiscard]] constexpr auto crc32(const std::span<const std::uint8_t> data, const std::uint32_t crc = 0) noexcept
+        -> std::uint32_t
+    {
+        auto remainder = ~crc;
+
+        for (const auto &byte : data)
+        {
+            remainder = (remainder >> 8U) ^ Inner::crc32_table[(remainder ^ byte) & 0xFFU];
+        }
+
+        return ~remainder;
+    }
+} // namespace Standard::Algorithms::Numbers
@@ -0,0 +1,136 @@
+#include"elias_fano.h"
+#include"../Utilities/require_utilities.h"
+#include<algorithm>
+#include<bit>
+#include<cassert>
+#include<stdexcept>
+
+namespace
+{
+    constexpr std::size_t word_bits = 64;
+
+    [[nodiscard]] constexpr auto low_mask(const std::uint32_t bits) noexcept -> std::uint64_t
+    {
+        assert(bits < word_bits);
+
+        return (std::uint64_t{ 1 } << bits) - 1U;
+    }
+} // namespace
+
+Standard::Algorithms::Numbers::elias_fano::elias_fano(const std::vector<std::uint64_t> &values)
+    : Size(values.size())
+{
+    if (Size == 0U)
+    {
+        return;
+    }
+
+    if (!std::is_sorted(values.cbegin(), values.cend())) [[unlikely]]
+    {
+        throw std::invalid_argument("The Elias-Fano values must be non-decreasing.");
+    }
+
+    Max_value = values.back();
+
+    if (const auto ratio = Max_value / Size; 0U < ratio)
+    {
+        Low_bits = static_cast<std::uint32_t>(std::bit_width(ratio)) - 1U;
+    }
+
+    const auto mask = low_mask(Low_bits);
+    const auto high_size = Size + static_cast<std::size_t>(Max_value >> Low_bits) + 1U;
+
+    Lows.assign((Size * Low_bits + word_bits - 1U) / word_bits + 1U, 0U);
+
+    bit_array highs(high_size);
+
+    for (std::size_t index{}; index < Size; ++index)
+    {
+        const auto &value = values[index];
+
+        highs.set_bit(static_cast<std::size_t>(value >> Low_bits) + index);
+
+        if (Low_bits == 0U)
+        {
+            continue;
+        }
+
+        const auto bit = index * Low_bits;
+        const auto offset = bit % word_bits;
+        const auto lowest = value & mask;
+
+        Lows[bit / word_bits] |= lowest << offset;
+
+        if (word_bits < offset + Low_bits)
+        {
+            Lows[bit / word_bits + 1U] |= lowest >> (word_bits - offset);
+        }
+    }
+
+    Highs = rank_select_bit_vector(std::move(highs), high_size);
+}
+
+[[nodiscard]] auto Standard::Algorithms::Numbers::elias_fano::access(const std::size_t index) const -> std::uint64_t
+{
+    require_greater(Size, index, "Elias-Fano index");
+
+    const auto high = static_cast<std::uint64_t>(Highs.select1(index) - index);
+
+    return (high << Low_bits) | low(index);
+}
+
+[[nodiscard]] auto Standard::Algorithms::Numbers::elias_fano::next_geq(const std::uint64_t value) const
+    -> std::size_t
+{
+    if (Size == 0U || Max_value < value)
+    {
+        return Size;
+    }
+
+    // The values having the high part "high" start after the high-th zero.
+    const auto high = static_cast<std::size_t>(value >> Low_bits);
+    auto position = high == 0U ? std::size_t{} : Highs.select0(high - 1U) + 1U;
+    auto index = position - high;
+
+    for (;; ++position)
+    {
+        assert(position < Highs.size());
+
+        if (!Highs.get_bit(position))
+        {
+            continue;
+        }
+
+        assert(index < Size);
+
+        const auto cand = (static_cast<std::uint64_t>(position - index) << Low_bits) | low(index);
+
+        if (value <= cand)
+        {
+            return index;
+        }
+
+        ++index;
+    }
+}
+
+[[nodiscard]] auto Standard::Algorithms::Numbers::elias_fano::low(const std::size_t index) const noexcept
+    -> std::uint64_t
+{
+    if (Low_bits == 0U)
+    {
+        return 0U;
+    }
+
+    const auto bit = index * Low_bits;
+    const auto offset = bit % word_bits;
+
+    auto result = Lows[bit / word_bits] >> offset;
+
+    if (word_bits < offset + Low_bits)
+    {
+        result |= Lows[bit / word_bits + 1U] << (word_bits - offset);
+    }
+
+    return result & low_mask(Low_bits);
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include"rank_select_bit_vector.h"
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+
+namespace Standard::Algorithms::Numbers
+{
+    // Elias-Fano encoding of a non-decreasing sequence of n integers not exceeding u:
+    // the low l = floor(log2(u/n)) bits of every value are packed as is;
+    // the high part h of the i-th value is stored as a one at the position (h + i) in a bit vector,
+    // having n ones and at most (u >> l) + 1 zeros.
+    // Space: n*(2 + log2(u/n)) bits plus the rank, select overhead.
+    struct elias_fano final
+    {
+        // Time O(n).
+        explicit elias_fano(const std::vector<std::uint64_t> &values = {});
+
+        [[nodiscard]] inline constexpr auto size() const noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        // The value at the "index" < size.
+        // Time O(1) on average.
+        [[nodiscard]] auto access(std::size_t index) const -> std::uint64_t;
+
+        // The index of the first value not less than the "value", or size when none.
+        // Time O(1 + the values having the same high part) on average.
+        [[nodiscard]] auto next_geq(std::uint64_t value) const -> std::size_t;
+
+private:
+        [[nodiscard]] auto low(std::size_t index) const noexcept -> std::uint64_t;
+
+        std::size_t Size;
+        std::uint32_t Low_bits{};
+        std::uint64_t Max_value{};
+        std::vector<std::uint64_t> Lows{};
+        rank_select_bit_vector Highs{};
+    };
+} // namespace Standard::Algorithms::Numbers
@@ -0,0 +1,238 @@
+#include"rank_select_bit_vector.h"
+#include"../Utilities/require_utilities.h"
+#include<algorithm>
+#include<bit>
+#include<cassert>
+
+namespace
+{
+    constexpr std::size_t word_bits = 64;
+    constexpr std::size_t block_words = 8;
+    constexpr std::size_t block_bits = word_bits * block_words;
+    constexpr std::size_t sample_rate = block_bits;
+
+    constexpr std::uint32_t sub_count_bits = 9;
+    constexpr std::uint64_t sub_count_mask = (1U << sub_count_bits) - 1U;
+
+    static_assert((block_words - 1U) * sub_count_bits < word_bits);
+
+    // The ones in the block words before the word "word_in_block".
+    // For 0, the shift is 63, reading the always zero top bit, which avoids a branch.
+    [[nodiscard]] constexpr auto sub_count(const std::uint64_t packed, const std::size_t word_in_block) noexcept
+        -> std::size_t
+    {
+        assert(word_in_block < block_words);
+
+        const auto tod = static_cast<std::uint64_t>(word_in_block) - 1U;
+        const auto shift = (tod + ((tod >> 60U) & 8U)) * sub_count_bits;
+
+        return static_cast<std::size_t>((packed >> shift) & sub_count_mask);
+    }
+
+    // The position of the one having the 0-based "rank" in the word.
+    [[nodiscard]] constexpr auto select_in_word(std::uint64_t word, std::size_t rank) noexcept -> std::size_t
+    {
+        assert(rank < static_cast<std::size_t>(std::popcount(word)));
+
+        constexpr std::uint64_t byte_mask = 0xFFU;
+
+        std::size_t position{};
+
+        for (;;)
+        {
+            const auto byte_ones = static_cast<std::size_t>(std::popcount(word & byte_mask));
+
+            if (rank < byte_ones)
+            {
+                break;
+            }
+
+            rank -= byte_ones;
+            word >>= 8U;
+            position += 8U;
+        }
+
+        for (; 0U < rank; --rank)
+        {
+            word &= word - 1U;
+        }
+
+        return position + static_cast<std::size_t>(std::countr_zero(word));
+    }
+} // namespace
+
+Standard::Algorithms::Numbers::rank_select_bit_vector::rank_select_bit_vector(
+    bit_array bits, const std::size_t size_bits)
+    : Bits(std::move(bits))
+    , Size(size_bits)
+{
+    const auto &words = Bits.words();
+    const auto word_count = (Size + word_bits - 1U) / word_bits;
+
+    require_less_equal(word_count, words.size(), "rank select bit vector words");
+
+    const auto block_count = (word_count + block_words - 1U) / block_words;
+    Counts.assign((block_count + 1U) * 2U, 0U);
+
+    std::uint64_t ones{};
+
+    for (std::size_t block{}; block <= block_count; ++block)
+    {
+        Counts[block * 2U] = ones;
+
+        std::uint64_t packed{};
+        std::uint64_t inside{};
+
+        for (std::size_t word_in_block{}; word_in_block < block_words; ++word_in_block)
+        {
+            if (0U < word_in_block)
+            {
+                packed |= inside << ((word_in_block - 1U) * sub_count_bits);
+            }
+
+            const auto index = block * block_words + word_in_block;
+
+            if (word_count <= index)
+            {
+                continue;
+            }
+
+            auto word = words[index];
+
+            // The bits past the size are ignored.
+            if (const auto used = Size - index * word_bits; used < word_bits)
+            {
+                word &= (std::uint64_t{ 1 } << used) - 1U;
+            }
+
+            inside += static_cast<std::uint64_t>(std::popcount(word));
+        }
+
+        Counts[block * 2U + 1U] = packed;
+        ones += inside;
+    }
+
+    Ones = static_cast<std::size_t>(ones);
+
+    for (std::size_t block{}, one_sample{}, zero_sample{}; block < block_count; ++block)
+    {
+        const auto ones_after = static_cast<std::size_t>(Counts[(block + 1U) * 2U]);
+        const auto zeros_after = std::min(Size, (block + 1U) * block_bits) - ones_after;
+
+        for (; one_sample * sample_rate < ones_after; ++one_sample)
+        {
+            One_samples.push_back(block);
+        }
+
+        for (; zero_sample * sample_rate < zeros_after; ++zero_sample)
+        {
+            Zero_samples.push_back(block);
+        }
+    }
+}
+
+[[nodiscard]] auto Standard::Algorithms::Numbers::rank_select_bit_vector::get_bit(const std::size_t position) const
+    -> bool
+{
+    assert(position < Size);
+
+    return ((Bits.words()[position / word_bits] >> (position % word_bits)) & 1U) != 0U;
+}
+
+[[nodiscard]] auto Standard::Algorithms::Numbers::rank_select_bit_vector::rank1(const std::size_t position) const
+    -> std::size_t
+{
+    assert(position <= Size);
+
+    const auto word = position / word_bits;
+    const auto block = word / block_words;
+
+    auto ones = static_cast<std::size_t>(Counts[block * 2U]) + sub_count(Counts[block * 2U + 1U], word % block_words);
+
+    if (const auto bits = position % word_bits; 0U < bits)
+    {
+        const auto mask = (std::uint64_t{ 1 } << bits) - 1U;
+        ones += static_cast<std::size_t>(std::popcount(Bits.words()[word] & mask));
+    }
+
+    return ones;
+}
+
+template<bool is_one>
+[[nodiscard]] auto Standard::Algorithms::Numbers::rank_select_bit_vector::select(std::size_t rank) const
+    -> std::size_t
+{
+    const auto &samples = is_one ? One_samples : Zero_samples;
+    const auto sample = rank / sample_rate;
+    assert(sample < samples.size());
+
+    // The ones, or zeros, before the block.
+    const auto before = [this](const std::size_t block) -> std::size_t
+    {
+        const auto ones = static_cast<std::size_t>(Counts[block * 2U]);
+        return is_one ? ones : block * block_bits - ones;
+    };
+
+    // The last block in [low, high] having not more than "rank" before it.
+    auto low = samples[sample];
+
+    // The block after the last is the count sentinel.
+    const auto last_block = Counts.size() / 2U - 2U;
+    auto high = sample + 1U < samples.size() ? samples[sample + 1U] : last_block;
+
+    while (low < high)
+    {
+        const auto mid = low + (high - low + 1U) / 2U;
+
+        if (before(mid) <= rank)
+        {
+            low = mid;
+        }
+        else
+        {
+            high = mid - 1U;
+        }
+    }
+
+    const auto block = low;
+    rank -= before(block);
+
+    const auto &packed = Counts[block * 2U + 1U];
+    std::size_t word_in_block{};
+
+    for (; word_in_block + 1U < block_words; ++word_in_block)
+    {
+        const auto next = word_in_block + 1U;
+        const auto ones = sub_count(packed, next);
+        const auto count = is_one ? ones : next * word_bits - ones;
+
+        if (rank < count)
+        {
+            break;
+        }
+    }
+
+    const auto ones = sub_count(packed, word_in_block);
+    rank -= is_one ? ones : word_in_block * word_bits - ones;
+
+    const auto index = block * block_words + word_in_block;
+    const auto &word = Bits.words()[index];
+
+    return index * word_bits + select_in_word(is_one ? word : ~word, rank);
+}
+
+[[nodiscard]] auto Standard::Algorithms::Numbers::rank_select_bit_vector::select1(const std::size_t rank) const
+    -> std::size_t
+{
+    require_greater(Ones, rank, "select1 rank");
+
+    return select<true>(rank);
+}
+
+[[nodiscard]] auto Standard::Algorithms::Numbers::rank_select_bit_vector::select0(const std::size_t rank) const
+    -> std::size_t
+{
+    require_greater(Size - Ones, rank, "select0 rank");
+
+    return select<false>(rank);
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include"bit_array.h"
+#include<cstddef>
+#include<cstdint>
+#include<vector>
+
+namespace Standard::Algorithms::Numbers
+{
+    // A static succinct bit vector with rank9 of Vigna: a block of 512 bits has 2 words of counts,
+    // the ones before the block, and seven 9-bit counts of the ones before the 2nd..8th word inside the block.
+    // So a rank is 2 count reads and a popcount; the counts take 25% space over the bits.
+    // A select finds the block starting from the block of a sampled position of every 512-th one (or zero),
+    // then the word by the 9-bit counts, then the bit in the word.
+    struct rank_select_bit_vector final
+    {
+        // The first "size_bits" of the "bits" are used.
+        // Time O(n/64).
+        explicit rank_select_bit_vector(bit_array bits = bit_array{}, std::size_t size_bits = 0);
+
+        [[nodiscard]] inline constexpr auto size() const noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        [[nodiscard]] inline constexpr auto ones() const noexcept -> std::size_t
+        {
+            return Ones;
+        }
+
+        [[nodiscard]] auto get_bit(std::size_t position) const -> bool;
+
+        // The number of ones in [0, position), position <= size.
+        // Time O(1).
+        [[nodiscard]] auto rank1(std::size_t position) const -> std::size_t;
+
+        [[nodiscard]] inline auto rank0(const std::size_t position) const -> std::size_t
+        {
+            return position - rank1(position);
+        }
+
+        // The position of the one having the 0-based "rank", rank < ones.
+        // Time O(1) on average, O(log(n)) worst.
+        [[nodiscard]] auto select1(std::size_t rank) const -> std::size_t;
+
+        // The position of the zero having the 0-based "rank", rank < size - ones.
+        [[nodiscard]] auto select0(std::size_t rank) const -> std::size_t;
+
+private:
+        template<bool is_one>
+        [[nodiscard]] auto select(std::size_t rank) const -> std::size_t;
+
+        bit_array Bits;
+        std::size_t Size;
+        std::size_t Ones{};
+
+        // 2 words per block of 512 bits, plus 1 block after the last.
+        std::vector<std::uint64_t> Counts{};
+
+        // The block of every 512-th one, and zero.
+        std::vector<std::size_t> One_samples{};
+        std::vector<std::size_t> Zero_samples{};
+    };
+} // namespace Standard::Algorithms::Numbers
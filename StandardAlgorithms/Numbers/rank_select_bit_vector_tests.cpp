@@ -0,0 +1,114 @@
+#include"rank_select_bit_vector_tests.h"
+#include"../Utilities/random.h"
+#include"../Utilities/test_utilities.h"
+#include"elias_fano.h"
+#include"rank_select_bit_vector.h"
+
+namespace
+{
+    using random_t = Standard::Algorithms::Utilities::random_t<std::int32_t>;
+
+    void rank_select_test(random_t &rnd, const std::size_t size, const std::int32_t one_percent)
+    {
+        Standard::Algorithms::Numbers::bit_array bits(size);
+        std::vector<bool> expected(size);
+
+        for (std::size_t index{}; index < size; ++index)
+        {
+            if (rnd(0, 99) < one_percent)
+            {
+                bits.set_bit(index);
+                expected[index] = true;
+            }
+        }
+
+        // The bits past the size must be ignored.
+        if (const auto padded = bits.words().size() * 64U; size < padded)
+        {
+            bits.set_bit(padded - 1U);
+        }
+
+        const Standard::Algorithms::Numbers::rank_select_bit_vector vec(std::move(bits), size);
+        ::Standard::Algorithms::ert::are_equal(size, vec.size(), "size");
+
+        std::size_t ones{};
+
+        for (std::size_t index{}; index <= size; ++index)
+        {
+            ::Standard::Algorithms::ert::are_equal(ones, vec.rank1(index), "rank1");
+            ::Standard::Algorithms::ert::are_equal(index - ones, vec.rank0(index), "rank0");
+
+            if (index == size)
+            {
+                break;
+            }
+
+            ::Standard::Algorithms::ert::are_equal(expected[index], vec.get_bit(index), "get_bit");
+
+            if (expected[index])
+            {
+                ::Standard::Algorithms::ert::are_equal(index, vec.select1(ones), "select1");
+                ++ones;
+            }
+            else
+            {
+                ::Standard::Algorithms::ert::are_equal(index, vec.select0(index - ones), "select0");
+            }
+        }
+
+        ::Standard::Algorithms::ert::are_equal(ones, vec.ones(), "ones");
+    }
+
+    void elias_fano_test(random_t &rnd, const std::size_t size, const std::int32_t max_step)
+    {
+        std::vector<std::uint64_t> values(size);
+
+        for (std::uint64_t value = static_cast<std::uint64_t>(rnd(0, max_step)); auto &item : values)
+        {
+            item = value;
+            value += static_cast<std::uint64_t>(rnd(0, max_step));
+        }
+
+        const Standard::Algorithms::Numbers::elias_fano encoded(values);
+        ::Standard::Algorithms::ert::are_equal(size, encoded.size(), "Elias-Fano size");
+
+        for (std::size_t index{}; index < size; ++index)
+        {
+            ::Standard::Algorithms::ert::are_equal(values[index], encoded.access(index), "Elias-Fano access");
+        }
+
+        const auto max_value = values.empty() ? std::uint64_t{} : values.back() + 2U;
+
+        for (std::uint64_t value{}; value <= max_value; ++value)
+        {
+            const auto expected = static_cast<std::size_t>(
+                std::lower_bound(values.cbegin(), values.cend(), value) - values.cbegin());
+
+            ::Standard::Algorithms::ert::are_equal(expected, encoded.next_geq(value), "Elias-Fano next_geq");
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Numbers::Tests::rank_select_bit_vector_tests()
+{
+    random_t rnd{};
+
+    // Several select samples, and a partial last block.
+    constexpr std::size_t large_size = 5'000;
+
+    for (const auto &size : { std::size_t{}, std::size_t{ 1 }, std::size_t{ 64 }, std::size_t{ 512 }, large_size })
+    {
+        for (const auto &one_percent : { 0, 3, 50, 97, 100 })
+        {
+            rank_select_test(rnd, size, one_percent);
+        }
+    }
+
+    for (const auto &size : { std::size_t{}, std::size_t{ 1 }, std::size_t{ 100 }, std::size_t{ 1'000 } })
+    {
+        for (const auto &max_step : { 0, 1, 10, 1'000 })
+        {
+            elias_fano_test(rnd, size, max_step);
+        }
+    }
+}
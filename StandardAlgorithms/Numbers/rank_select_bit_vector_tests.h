@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Numbers::Tests
+{
+    void rank_select_bit_vector_tests();
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include<array>
+#include<cstddef>
+#include<cstdint>
+
+namespace Standard::Algorithms::Numbers
+{
+    // A 40-bit unsigned integer packed into 5 bytes, having no alignment padding:
+    // an array of them indexes up to 1 TB using 5 bytes per item instead of 8.
+    // A value is truncated to its low 40 bits; the arithmetic is done after the conversion to std::uint64_t.
+    struct uint40_t final
+    {
+        static constexpr std::uint32_t bits = 40;
+        static constexpr std::uint64_t max_value = (std::uint64_t{ 1 } << bits) - 1U;
+
+        constexpr uint40_t() noexcept = default;
+
+        constexpr explicit uint40_t(const std::uint64_t value) noexcept
+        {
+            for (std::size_t index{}; index < Bytes.size(); ++index)
+            {
+                Bytes[index] = static_cast<std::uint8_t>(value >> (index * 8U));
+            }
+        }
+
+        [[nodiscard]] constexpr explicit(false) operator std::uint64_t () const noexcept // NOLINTNEXTLINE
+        {
+            // Spelled out so that the compiler merges the bytes into 2 loads.
+            return static_cast<std::uint64_t>(Bytes[0]) | (static_cast<std::uint64_t>(Bytes[1]) << 8U) |
+                (static_cast<std::uint64_t>(Bytes[2]) << 16U) | (static_cast<std::uint64_t>(Bytes[3]) << 24U) |
+                (static_cast<std::uint64_t>(Bytes[4]) << 32U);
+        }
+
+        [[nodiscard]] constexpr auto operator== (const uint40_t &) const noexcept -> bool = default;
+
+private:
+        std::array<std::uint8_t, bits / 8U> Bytes{};
+    };
+
+    static_assert(sizeof(uint40_t) == 5U);
+} // namespace Standard::Algorithms::Numbers
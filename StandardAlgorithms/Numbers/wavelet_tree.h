@@ -0,0 +1,129 @@
+#pragma once
+#include"rank_select_bit_vector.h"
+#include<cassert>
+#include<concepts>
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<vector>
+
+namespace Standard::Algorithms::Numbers
+{
+    // A wavelet tree over the symbols in [0, 2**bit_count), stored level by level as a wavelet matrix:
+    // the level bit vector holds one bit of every symbol, from the highest bit down;
+    // the next level has the symbols stably partitioned by that bit, the zeros first.
+    // So there are no node pointers, and a query does 1 or 2 constant time ranks per level.
+    // Space: n*bit_count bits + 1/4 overhead for the ranks.
+    template<std::unsigned_integral symbol_t>
+    struct wavelet_tree final
+    {
+        // Time O(n * bit_count).
+        constexpr wavelet_tree(const std::span<const symbol_t> symbols, const std::uint32_t bit_count)
+            : Size(symbols.size())
+            , Zeros(bit_count)
+        {
+            assert(0U < bit_count && bit_count <= sizeof(symbol_t) * 8U);
+
+            Levels.reserve(bit_count);
+
+            std::vector<symbol_t> current(symbols.begin(), symbols.end());
+            std::vector<symbol_t> next(Size);
+
+            for (std::uint32_t level{}; level < bit_count; ++level)
+            {
+                const auto shift = bit_count - 1U - level;
+                bit_array bits(Size);
+
+                std::size_t zeros{};
+
+                for (const auto &symbol : current)
+                {
+                    zeros += ((symbol >> shift) & 1U) == 0U ? 1U : 0U;
+                }
+
+                Zeros[level] = zeros;
+
+                std::size_t zero_pos{};
+                auto one_pos = zeros;
+
+                for (std::size_t index{}; index < Size; ++index)
+                {
+                    const auto &symbol = current[index];
+
+                    if (((symbol >> shift) & 1U) == 0U)
+                    {
+                        next[zero_pos++] = symbol;
+                    }
+                    else
+                    {
+                        bits.set_bit(index);
+                        next[one_pos++] = symbol;
+                    }
+                }
+
+                Levels.emplace_back(std::move(bits), Size);
+                std::swap(current, next);
+            }
+        }
+
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        // Time O(bit_count).
+        [[nodiscard]] constexpr auto access(std::size_t position) const -> symbol_t
+        {
+            assert(position < Size);
+
+            symbol_t symbol{};
+
+            for (std::size_t level{}; level < Levels.size(); ++level)
+            {
+                const auto &bits = Levels[level];
+                const auto bit = bits.get_bit(position);
+
+                symbol = static_cast<symbol_t>((symbol << 1U) | (bit ? 1U : 0U));
+                position = bit ? Zeros[level] + bits.rank1(position) : bits.rank0(position);
+            }
+
+            return symbol;
+        }
+
+        // The number of the "symbol" occurrences in [0, position).
+        // The "begin" follows the first symbol occurrence in the level order.
+        // Time O(bit_count).
+        [[nodiscard]] constexpr auto rank(const symbol_t &symbol, std::size_t position) const -> std::size_t
+        {
+            assert(position <= Size);
+
+            std::size_t begin{};
+            const auto bit_count = Levels.size();
+
+            for (std::size_t level{}; level < bit_count; ++level)
+            {
+                const auto &bits = Levels[level];
+
+                if (((symbol >> (bit_count - 1U - level)) & 1U) == 0U)
+                {
+                    begin = bits.rank0(begin);
+                    position = bits.rank0(position);
+                }
+                else
+                {
+                    begin = Zeros[level] + bits.rank1(begin);
+                    position = Zeros[level] + bits.rank1(position);
+                }
+            }
+
+            return position - begin;
+        }
+
+private:
+        std::size_t Size;
+        std::vector<rank_select_bit_vector> Levels{};
+
+        // The number of zeros per level.
+        std::vector<std::size_t> Zeros;
+    };
+} // namespace Standard::Algorithms::Numbers
@@ -0,0 +1,89 @@
+#include"add_benchmarks.h"
+#include"../Utilities/random.h"
+#include"bwt_block_compressor.h"
+#include<array>
+#include<iostream>
+#include<memory>
+#include<sstream>
+#include<string_view>
+
+namespace
+{
+    constexpr std::size_t one_million = 1'000'000;
+
+    // Log-like lines: a few frequent words, numbers; so that the compression ratio is not trivial.
+    [[nodiscard]] auto make_text(const std::size_t size) -> std::shared_ptr<const std::string>
+    {
+        constexpr std::array<std::string_view, 8> words{ "INFO", "WARN", "request", "served", "user", "cache",
+            "miss", "timeout" };
+
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+        auto text = std::make_shared<std::string>();
+        text->reserve(size + one_million / 1'000U);
+
+        while (text->size() < size)
+        {
+            // Frequent words are more likely.
+            const auto word = static_cast<std::size_t>(std::min(rnd(0, 7), rnd(0, 7)));
+            *text += words[word];
+            *text += ' ';
+            *text += std::to_string(rnd(0, 9'999));
+            *text += rnd(0, 3) == 0 ? '\n' : ' ';
+        }
+
+        text->resize(size);
+
+        return text;
+    }
+
+    [[nodiscard]] auto compress(const std::string &text) -> std::string
+    {
+        std::istringstream input(text);
+        std::ostringstream output;
+
+        Standard::Algorithms::Strings::bwt_compress(input, output);
+
+        return output.str();
+    }
+
+    [[nodiscard]] auto compress_setup(const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+    {
+        auto text = make_text(size);
+
+        return [text]
+        {
+            [[maybe_unused]] const auto compressed = compress(*text);
+        };
+    }
+
+    // The compression ratio is printed once per size.
+    [[nodiscard]] auto decompress_setup(const std::size_t size) -> Standard::Algorithms::benchmark_body_t
+    {
+        const auto text = make_text(size);
+        auto compressed = std::make_shared<const std::string>(compress(*text));
+
+        std::cout << "bwt_compress size " << size << " compressed to " << compressed->size() << " bytes, ratio "
+                  << static_cast<double>(size) / static_cast<double>(compressed->size()) << '\n';
+
+        return [compressed]
+        {
+            std::istringstream input(*compressed);
+            std::ostringstream output;
+
+            Standard::Algorithms::Strings::bwt_decompress(input, output);
+        };
+    }
+} // namespace
+
+void Standard::Algorithms::Strings::Benchmarks::add_benchmarks(std::vector<benchmark_function> &benchmarks)
+{
+    // The block size is 0.9MB, so 8MB is 9 blocks to compress in parallel.
+    const std::vector<std::size_t> sizes{ one_million, 8 * one_million };
+
+    // The sizes are in bytes of the uncompressed text.
+    constexpr std::size_t item_bytes = 1;
+
+    benchmarks.emplace_back("bwt_compress", compress_setup, sizes, "", item_bytes);
+    benchmarks.emplace_back("bwt_decompress", decompress_setup, sizes, "", item_bytes);
+}
@@ -1,10 +1,12 @@
 #include"add_tests.h"
 #include"aho_corasick_tests.h"
 #include"burrows_wheeler_transform_tests.h"
+#include"bwt_block_compressor_tests.h"
 #include"count_distinct_substrings_of_length_tests.h"
 #include"double_dispatch_tests.h"
 #include"edit_distance_vintsiuk_tests.h"
 #include"enumerate_all_valid_brace_strings_tests.h"
+#include"fm_index_tests.h"
 #include"full_class_tests.h"
 #include"knuth_morris_pratt_tests.h"
 #include"lcp_tests.h"
@@ -35,6 +37,8 @@ void Standard::Algorithms::Strings::Tests::add_tests(
     tests.emplace_back("double_dispatch_tests", &double_dispatch_tests, 1);
 
     tests.emplace_back("burrows_wheeler_transform_tests", &burrows_wheeler_transform_tests, 3);
+    tests.emplace_back("bwt_block_compressor_tests", &bwt_block_compressor_tests, 2);
+    tests.emplace_back("fm_index_tests", &fm_index_tests, 2);
 
     tests.emplace_back("ukkonen_suffix_tree_tests", &ukkonen_suffix_tree_tests, 3);
 
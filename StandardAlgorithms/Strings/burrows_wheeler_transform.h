@@ -8,7 +8,7 @@
 namespace Standard::Algorithms::Strings
 {
     // Permute the characters to have many repetitions to be used in further text compression.
-    // See also move_to_front_encoder.
+    // See also move_to_front_encoder, "bwt_block_compressor.h", and "fm_index.h" to search in the transformed text.
 
     // Build from a suffix array in time O(n).
     template<class encoded_t, class string_t,
@@ -0,0 +1,768 @@
+#pragma once
+#include"../Graphs/prefix_codes.h"
+#include"../Numbers/crc32.h"
+#include"../Numbers/move_to_front_encoding.h"
+#include"../Utilities/has_openmp.h"
+#include"../Utilities/throw_exception.h"
+#include"suffix_array_sais.h"
+#include<algorithm>
+#include<array>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<exception>
+#include<istream>
+#include<map>
+#include<ostream>
+#include<span>
+#include<stdexcept>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Strings::Inner
+{
+    // After the move-to-front, the ranks 1..255 become the symbols 2..256.
+    // A run of L zero ranks is written in the bijective base 2, the lowest digit first,
+    // by the symbols run_a for the digit 1 and run_b for 2, as in bzip2.
+    constexpr std::uint16_t bwt_run_a = 0;
+    constexpr std::uint16_t bwt_run_b = 1;
+    constexpr std::size_t bwt_alphabet_size = 257;
+
+    // The code lengths are stored in 5 bits each; 0 is for an absent symbol.
+    constexpr std::uint32_t bwt_max_code_length = 20;
+    constexpr std::uint32_t bwt_length_bits = 5;
+
+    static_assert(bwt_max_code_length < (1U << bwt_length_bits));
+
+    // "BWT" + version 1, little-endian.
+    constexpr std::uint32_t bwt_file_signature = 0x0154'5742U;
+
+    using bwt_lengths_t = std::array<std::uint32_t, bwt_alphabet_size>;
+
+    inline void bwt_put_u32(std::vector<std::uint8_t> &bytes, const std::uint32_t value)
+    {
+        for (std::uint32_t shift{}; shift < 32U; shift += 8U)
+        {
+            bytes.push_back(static_cast<std::uint8_t>(value >> shift));
+        }
+    }
+
+    [[nodiscard]] inline auto bwt_get_u32(const std::span<const std::uint8_t> bytes, const std::size_t offset)
+        -> std::uint32_t
+    {
+        if (bytes.size() < offset + 4U) [[unlikely]]
+        {
+            throw std::runtime_error("The BWT block header is truncated.");
+        }
+
+        std::uint32_t value{};
+
+        for (std::uint32_t index{}; index < 4U; ++index)
+        {
+            value |= static_cast<std::uint32_t>(bytes[offset + index]) << (index * 8U);
+        }
+
+        return value;
+    }
+
+    inline void bwt_write_u32(std::ostream &str, const std::uint32_t value)
+    {
+        std::array<char, 4> bytes{};
+
+        for (std::uint32_t index{}; auto &byte : bytes)
+        {
+            byte = static_cast<char>(static_cast<std::uint8_t>(value >> (8U * index++)));
+        }
+
+        str.write(bytes.data(), bytes.size());
+    }
+
+    [[nodiscard]] inline auto bwt_read_u32(std::istream &str) -> std::uint32_t
+    {
+        std::array<char, 4> bytes{};
+        str.read(bytes.data(), bytes.size());
+
+        if (!str) [[unlikely]]
+        {
+            throw std::runtime_error("The BWT compressed stream is truncated.");
+        }
+
+        std::uint32_t value{};
+
+        for (std::uint32_t index{}; const auto &byte : bytes)
+        {
+            value |= static_cast<std::uint32_t>(static_cast<std::uint8_t>(byte)) << (8U * index++);
+        }
+
+        return value;
+    }
+
+    // The most significant bit first.
+    struct bwt_bit_writer final
+    {
+        constexpr explicit bwt_bit_writer(std::vector<std::uint8_t> &bytes) noexcept
+            : Bytes(bytes)
+        {
+        }
+
+        // At most 32 bits.
+        constexpr void write(const std::uint32_t value, const std::uint32_t bits)
+        {
+            assert(bits <= 32U);
+
+            Buffer = (Buffer << bits) | (value & ((std::uint64_t{ 1 } << bits) - 1U));
+            Count += bits;
+
+            while (8U <= Count)
+            {
+                Count -= 8U;
+                Bytes.push_back(static_cast<std::uint8_t>(Buffer >> Count));
+            }
+        }
+
+        // Pad the last byte with zeros.
+        constexpr void flush()
+        {
+            if (0U < Count)
+            {
+                Bytes.push_back(static_cast<std::uint8_t>(Buffer << (8U - Count)));
+                Count = 0;
+            }
+        }
+
+private:
+        std::vector<std::uint8_t> &Bytes;
+        std::uint64_t Buffer{};
+        std::uint32_t Count{};
+    };
+
+    struct bwt_bit_reader final
+    {
+        constexpr explicit bwt_bit_reader(const std::span<const std::uint8_t> bytes) noexcept
+            : Bytes(bytes)
+        {
+        }
+
+        [[nodiscard]] constexpr auto read_bit() -> std::uint32_t
+        {
+            if (Bytes.size() * 8U <= Position) [[unlikely]]
+            {
+                throw std::runtime_error("The BWT block bits are truncated.");
+            }
+
+            const auto bit = (static_cast<std::uint32_t>(Bytes[Position / 8U]) >> (7U - Position % 8U)) & 1U;
+            ++Position;
+
+            return bit;
+        }
+
+        [[nodiscard]] constexpr auto read(const std::uint32_t bits) -> std::uint32_t
+        {
+            std::uint32_t value{};
+
+            for (std::uint32_t index{}; index < bits; ++index)
+            {
+                value = (value << 1U) | read_bit();
+            }
+
+            return value;
+        }
+
+private:
+        std::span<const std::uint8_t> Bytes;
+        std::size_t Position{};
+    };
+
+    // The text followed by a virtual sentinel, smaller than any byte, is rotated.
+    // The last column has the sentinel dropped; the row having it is returned as the primary index.
+    // Row 0 is the sentinel rotation, so the primary index is in [1, n].
+    // Time O(n).
+    [[nodiscard]] inline auto bwt_forward(const std::span<const std::uint8_t> block, std::vector<std::uint32_t> &sar,
+        std::vector<std::uint8_t> &last) -> std::size_t
+    {
+        const auto size = block.size();
+        assert(0U < size);
+
+        suffix_array_sais<std::uint32_t, std::uint8_t>(block, sar);
+
+        last.resize(size);
+        last[0] = block[size - 1U];
+
+        std::size_t primary{};
+        std::size_t out = 1;
+
+        for (std::size_t index{}; index < size; ++index)
+        {
+            if (const auto pos = static_cast<std::size_t>(sar[index]); 0U < pos)
+            {
+                last[out++] = block[pos - 1U];
+            }
+            else
+            {
+                primary = index + 1U;
+            }
+        }
+
+        assert(out == size && 0U < primary);
+
+        return primary;
+    }
+
+    // The LF mapping, starting from the sentinel row, restores the text from its end.
+    // Time O(n).
+    inline void bwt_inverse(const std::span<const std::uint8_t> last, const std::size_t primary,
+        std::vector<std::uint32_t> &next, std::vector<std::uint8_t> &block)
+    {
+        const auto size = last.size();
+        assert(0U < primary && primary <= size);
+
+        // The rows starting with a byte follow the sentinel row and the rows of the smaller bytes.
+        std::array<std::size_t, 256> starts{};
+
+        for (const auto &byte : last)
+        {
+            ++starts[byte];
+        }
+
+        for (std::size_t sum = 1; auto &start : starts)
+        {
+            const auto count = start;
+            start = sum;
+            sum += count;
+        }
+
+        next.resize(size + 1U);
+
+        for (std::size_t row{}, index{}; row <= size; ++row)
+        {
+            if (row != primary)
+            {
+                next[row] = static_cast<std::uint32_t>(starts[last[index++]]++);
+            }
+        }
+
+        block.resize(size);
+
+        for (std::size_t row{}, pos = size; 0U < pos;)
+        {
+            block[--pos] = last[row - (primary < row ? 1U : 0U)];
+            row = next[row];
+        }
+    }
+
+    inline void bwt_mtf_rle_encode(const std::span<const std::uint8_t> last, std::vector<std::uint16_t> &symbols)
+    {
+        Numbers::move_to_front_encoder_slow<std::uint8_t> coder{};
+
+        symbols.clear();
+
+        std::size_t run{};
+
+        const auto flush_run = [&symbols, &run]
+        {
+            for (; 0U < run; run = (run - 1U) / 2U)
+            {
+                symbols.push_back((run & 1U) != 0U ? bwt_run_a : bwt_run_b);
+            }
+        };
+
+        for (const auto &byte : last)
+        {
+            if (const auto rank = coder.encode(byte); rank == 0U)
+            {
+                ++run;
+            }
+            else
+            {
+                flush_run();
+                symbols.push_back(static_cast<std::uint16_t>(rank + 1U));
+            }
+        }
+
+        flush_run();
+    }
+
+    // Huffman code lengths by the prefix code tree; a single symbol gets the length 1.
+    // Should a code be too long, the frequencies are flattened, as in bzip2, and the tree is rebuilt.
+    inline void bwt_code_lengths(
+        const std::array<std::uint64_t, bwt_alphabet_size> &counts, bwt_lengths_t &lengths)
+    {
+        using letter_t = std::uint16_t;
+        using frequency_t = std::uint64_t;
+        using code_t = std::vector<letter_t>;
+        using node_t = Trees::prefix_code_node<letter_t, frequency_t>;
+
+        std::vector<std::pair<letter_t, frequency_t>> frequencies;
+
+        for (std::size_t symbol{}; symbol < bwt_alphabet_size; ++symbol)
+        {
+            if (0U < counts[symbol])
+            {
+                frequencies.emplace_back(static_cast<letter_t>(symbol), counts[symbol]);
+            }
+        }
+
+        assert(!frequencies.empty());
+
+        std::map<letter_t, code_t> codes;
+        std::vector<node_t> nodes;
+        std::size_t root_position{};
+
+        for (;;)
+        {
+            Trees::prefix_codes<code_t, frequency_t, letter_t>(
+                letter_t{}, frequencies, letter_t{ 1 }, codes, root_position, nodes);
+
+            lengths.fill(0U);
+
+            std::size_t max_length{};
+
+            for (const auto &[letter, code] : codes)
+            {
+                lengths[letter] = static_cast<std::uint32_t>(code.size());
+                max_length = std::max(max_length, code.size());
+            }
+
+            if (max_length <= bwt_max_code_length)
+            {
+                return;
+            }
+
+            for (auto &frequency : frequencies)
+            {
+                frequency.second = frequency.second / 2U + 1U;
+            }
+        }
+    }
+
+    // The canonical codes: shorter codes come first; the codes of the same length follow the symbol order.
+    // So only the lengths are stored.
+    inline void bwt_canonical_codes(const bwt_lengths_t &lengths, std::array<std::uint32_t, bwt_alphabet_size> &codes)
+    {
+        std::array<std::uint32_t, bwt_max_code_length + 1U> length_counts{};
+
+        for (const auto &length : lengths)
+        {
+            ++length_counts[length];
+        }
+
+        length_counts[0] = 0;
+
+        std::array<std::uint32_t, bwt_max_code_length + 1U> next_codes{};
+
+        for (std::uint32_t length = 1, code{}; length <= bwt_max_code_length; ++length)
+        {
+            code = (code + length_counts[length - 1U]) << 1U;
+            next_codes[length] = code;
+        }
+
+        for (std::size_t symbol{}; symbol < bwt_alphabet_size; ++symbol)
+        {
+            if (const auto &length = lengths[symbol]; 0U < length)
+            {
+                codes[symbol] = next_codes[length]++;
+            }
+        }
+    }
+
+    // Decode the canonical code bit by bit: the codes of a length are consecutive, starting from "first".
+    struct bwt_canonical_decoder final
+    {
+        explicit bwt_canonical_decoder(const bwt_lengths_t &lengths)
+        {
+            for (const auto &length : lengths)
+            {
+                ++Length_counts[length];
+            }
+
+            std::array<std::uint32_t, bwt_max_code_length + 2U> offsets{};
+
+            for (std::uint32_t length = 1; length <= bwt_max_code_length; ++length)
+            {
+                offsets[length + 1U] = offsets[length] + Length_counts[length];
+            }
+
+            for (std::size_t symbol{}; symbol < bwt_alphabet_size; ++symbol)
+            {
+                if (const auto &length = lengths[symbol]; 0U < length)
+                {
+                    Sorted_symbols[offsets[length]++] = static_cast<std::uint16_t>(symbol);
+                }
+            }
+        }
+
+        [[nodiscard]] constexpr auto decode(bwt_bit_reader &reader) const -> std::uint16_t
+        {
+            std::uint32_t code{};
+            std::uint32_t first{};
+            std::uint32_t index{};
+
+            for (std::uint32_t length = 1; length <= bwt_max_code_length; ++length)
+            {
+                code |= reader.read_bit();
+
+                const auto &count = Length_counts[length];
+
+                if (code < first + count)
+                {
+                    return Sorted_symbols[index + code - first];
+                }
+
+                index += count;
+                first = (first + count) << 1U;
+                code <<= 1U;
+            }
+
+            throw std::runtime_error("An invalid Huffman code in the BWT block.");
+        }
+
+private:
+        std::array<std::uint32_t, bwt_max_code_length + 1U> Length_counts{};
+        std::array<std::uint16_t, bwt_alphabet_size> Sorted_symbols{};
+    };
+
+    // The payload: the primary index, the symbol count, the code lengths, then the Huffman codes of the symbols.
+    // Time O(n) for the BWT plus up to 256 steps per byte for the move-to-front.
+    inline void bwt_compress_block(const std::span<const std::uint8_t> block, std::vector<std::uint8_t> &payload)
+    {
+        std::vector<std::uint16_t> symbols;
+        std::size_t primary{};
+        {
+            std::vector<std::uint32_t> sar;
+            std::vector<std::uint8_t> last;
+
+            primary = bwt_forward(block, sar, last);
+            sar = {};
+
+            bwt_mtf_rle_encode(last, symbols);
+        }
+
+        std::array<std::uint64_t, bwt_alphabet_size> counts{};
+
+        for (const auto &symbol : symbols)
+        {
+            ++counts[symbol];
+        }
+
+        bwt_lengths_t lengths{};
+        bwt_code_lengths(counts, lengths);
+
+        std::array<std::uint32_t, bwt_alphabet_size> codes{};
+        bwt_canonical_codes(lengths, codes);
+
+        payload.clear();
+        bwt_put_u32(payload, static_cast<std::uint32_t>(primary));
+        bwt_put_u32(payload, static_cast<std::uint32_t>(symbols.size()));
+
+        bwt_bit_writer writer(payload);
+
+        for (const auto &length : lengths)
+        {
+            writer.write(length, bwt_length_bits);
+        }
+
+        for (const auto &symbol : symbols)
+        {
+            writer.write(codes[symbol], lengths[symbol]);
+        }
+
+        writer.flush();
+    }
+
+    inline void bwt_decompress_block(
+        const std::span<const std::uint8_t> payload, const std::size_t raw_size, std::vector<std::uint8_t> &block)
+    {
+        const auto primary = static_cast<std::size_t>(bwt_get_u32(payload, 0));
+        const auto symbol_count = static_cast<std::size_t>(bwt_get_u32(payload, 4));
+
+        // A symbol stands for at least 1 byte.
+        if (primary == 0U || raw_size < primary || raw_size < symbol_count) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The BWT block primary index " << primary << " or symbol count " << symbol_count
+                << " is invalid for the block size " << raw_size << ".";
+            throw_exception(str);
+        }
+
+        bwt_bit_reader reader(payload.subspan(8));
+
+        bwt_lengths_t lengths{};
+
+        for (auto &length : lengths)
+        {
+            length = reader.read(bwt_length_bits);
+
+            if (bwt_max_code_length < length) [[unlikely]]
+            {
+                throw std::runtime_error("A too long Huffman code length in the BWT block.");
+            }
+        }
+
+        const bwt_canonical_decoder decoder(lengths);
+        Numbers::move_to_front_encoder_slow<std::uint8_t> coder{};
+
+        std::vector<std::uint8_t> last;
+        last.reserve(raw_size);
+
+        std::size_t run{};
+        std::size_t weight = 1;
+
+        const auto flush_run = [&coder, &last, &run, &weight, raw_size]
+        {
+            if (raw_size - last.size() < run) [[unlikely]]
+            {
+                throw std::runtime_error("A too long zero run in the BWT block.");
+            }
+
+            last.insert(last.end(), run, coder.decode(0U));
+            run = 0;
+            weight = 1;
+        };
+
+        for (std::size_t index{}; index < symbol_count; ++index)
+        {
+            const auto symbol = decoder.decode(reader);
+
+            if (symbol == bwt_run_a || symbol == bwt_run_b)
+            {
+                if (raw_size < weight) [[unlikely]]
+                {
+                    throw std::runtime_error("A too long zero run in the BWT block.");
+                }
+
+                run += symbol == bwt_run_a ? weight : weight * 2U;
+                weight *= 2U;
+                continue;
+            }
+
+            flush_run();
+
+            if (last.size() == raw_size) [[unlikely]]
+            {
+                throw std::runtime_error("The BWT block has more bytes than declared.");
+            }
+
+            last.push_back(coder.decode(static_cast<std::uint8_t>(symbol - 1U)));
+        }
+
+        flush_run();
+
+        if (last.size() != raw_size) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The BWT block has " << last.size() << " bytes instead of " << raw_size << ".";
+            throw_exception(str);
+        }
+
+        std::vector<std::uint32_t> next;
+        bwt_inverse(last, primary, next, block);
+    }
+
+    // An exception inside a parallel region must not escape it; the first one is rethrown after.
+    template<class work_t>
+    void bwt_parallel_for(const std::size_t count, const work_t &work)
+    {
+        std::vector<std::exception_ptr> errors(count);
+
+        const auto size = static_cast<std::int64_t>(count);
+
+#pragma omp parallel for default(none) shared(size, work, errors) schedule(dynamic, 1)
+        for (std::int64_t index = 0; index < size; ++index)
+        {
+            try
+            {
+                work(static_cast<std::size_t>(index));
+            }
+            catch (...)
+            {
+                errors[index] = std::current_exception();
+            }
+        }
+
+        for (const auto &error : errors)
+        {
+            if (error) [[unlikely]]
+            {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+} // namespace Standard::Algorithms::Strings::Inner
+
+namespace Standard::Algorithms::Strings
+{
+    constexpr std::size_t bwt_default_block_size = 900'000;
+    constexpr std::size_t bwt_max_block_size = 1U << 30U;
+
+    // A bzip2-like block compressor: every block goes through
+    // the Burrows-Wheeler transform by SA-IS, the move-to-front, the zero run-length coding, and the Huffman coding.
+    // The input is read by as many blocks as there are threads, compressed in parallel, and written in order;
+    // so the memory is about 10 bytes per input byte of a batch.
+    // The format: the signature, the block size; then per block the raw size, CRC-32 of the raw bytes,
+    // the payload size, the payload; the raw size 0 marks the end. All numbers are 4-byte little-endian.
+    // Unlike bzip2, there is no initial run-length coding, as SA-IS is linear on repetitive inputs too.
+    // See also "burrows_wheeler_transform.h", "move_to_front_encoding.h", "prefix_codes.h".
+    inline void bwt_compress(
+        std::istream &input, std::ostream &output, const std::size_t block_size = bwt_default_block_size)
+    {
+        if (block_size == 0U || bwt_max_block_size < block_size) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The BWT block size " << block_size << " must be in [1, " << bwt_max_block_size << "].";
+            throw_exception(str);
+        }
+
+        Inner::bwt_write_u32(output, Inner::bwt_file_signature);
+        Inner::bwt_write_u32(output, static_cast<std::uint32_t>(block_size));
+
+        const auto batch = std::max<std::size_t>(1, omp_thread_count());
+
+        std::vector<std::vector<std::uint8_t>> blocks(batch);
+        std::vector<std::vector<std::uint8_t>> payloads(batch);
+        std::vector<std::uint32_t> checksums(batch);
+
+        for (;;)
+        {
+            std::size_t count{};
+
+            for (; count < batch; ++count)
+            {
+                auto &block = blocks[count];
+                block.resize(block_size);
+
+                input.read(reinterpret_cast<char *>(block.data()), static_cast<std::streamsize>(block_size));
+                block.resize(static_cast<std::size_t>(input.gcount()));
+
+                if (block.empty())
+                {
+                    break;
+                }
+            }
+
+            if (input.bad()) [[unlikely]]
+            {
+                throw std::runtime_error("Cannot read the BWT compressor input.");
+            }
+
+            Inner::bwt_parallel_for(count,
+                [&blocks, &payloads, &checksums](const std::size_t index)
+                {
+                    checksums[index] = Numbers::crc32(blocks[index]);
+                    Inner::bwt_compress_block(blocks[index], payloads[index]);
+                });
+
+            for (std::size_t index{}; index < count; ++index)
+            {
+                const auto &payload = payloads[index];
+
+                Inner::bwt_write_u32(output, static_cast<std::uint32_t>(blocks[index].size()));
+                Inner::bwt_write_u32(output, checksums[index]);
+                Inner::bwt_write_u32(output, static_cast<std::uint32_t>(payload.size()));
+
+                output.write(reinterpret_cast<const char *>(payload.data()),
+                    static_cast<std::streamsize>(payload.size()));
+            }
+
+            if (count < batch)
+            {
+                break;
+            }
+        }
+
+        Inner::bwt_write_u32(output, 0U);
+
+        if (!output) [[unlikely]]
+        {
+            throw std::runtime_error("Cannot write the BWT compressed output.");
+        }
+    }
+
+    // Every block CRC-32 is verified; a corrupted or truncated input throws.
+    inline void bwt_decompress(std::istream &input, std::ostream &output)
+    {
+        if (Inner::bwt_read_u32(input) != Inner::bwt_file_signature) [[unlikely]]
+        {
+            throw std::runtime_error("Not a BWT compressed stream, or a different version.");
+        }
+
+        const auto block_size = static_cast<std::size_t>(Inner::bwt_read_u32(input));
+
+        if (block_size == 0U || bwt_max_block_size < block_size) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The BWT compressed stream block size " << block_size << " is invalid.";
+            throw_exception(str);
+        }
+
+        const auto batch = std::max<std::size_t>(1, omp_thread_count());
+
+        std::vector<std::vector<std::uint8_t>> blocks(batch);
+        std::vector<std::vector<std::uint8_t>> payloads(batch);
+        std::vector<std::uint32_t> checksums(batch);
+
+        for (auto has_end = false; !has_end;)
+        {
+            std::size_t count{};
+
+            for (; count < batch; ++count)
+            {
+                const auto raw_size = static_cast<std::size_t>(Inner::bwt_read_u32(input));
+
+                if (raw_size == 0U)
+                {
+                    has_end = true;
+                    break;
+                }
+
+                checksums[count] = Inner::bwt_read_u32(input);
+
+                const auto payload_size = static_cast<std::size_t>(Inner::bwt_read_u32(input));
+
+                // At most 20 bits per byte, plus the header and the code lengths.
+                if (constexpr auto max_overhead = 1'024U;
+                    block_size < raw_size || raw_size * 3U + max_overhead < payload_size) [[unlikely]]
+                {
+                    auto str = ::Standard::Algorithms::Utilities::w_stream();
+                    str << "The BWT block sizes " << raw_size << ", " << payload_size << " are invalid.";
+                    throw_exception(str);
+                }
+
+                auto &payload = payloads[count];
+                payload.resize(payload_size);
+
+                input.read(reinterpret_cast<char *>(payload.data()), static_cast<std::streamsize>(payload_size));
+
+                if (!input) [[unlikely]]
+                {
+                    throw std::runtime_error("The BWT compressed stream is truncated.");
+                }
+
+                blocks[count].resize(raw_size);
+            }
+
+            Inner::bwt_parallel_for(count,
+                [&blocks, &payloads, &checksums](const std::size_t index)
+                {
+                    auto &block = blocks[index];
+                    Inner::bwt_decompress_block(payloads[index], block.size(), block);
+
+                    if (Numbers::crc32(block) != checksums[index]) [[unlikely]]
+                    {
+                        throw std::runtime_error("The BWT block CRC-32 does not match.");
+                    }
+                });
+
+            for (std::size_t index{}; index < count; ++index)
+            {
+                const auto &block = blocks[index];
+
+                output.write(reinterpret_cast<const char *>(block.data()), static_cast<std::streamsize>(block.size()));
+            }
+        }
+
+        if (!output) [[unlikely]]
+        {
+            throw std::runtime_error("Cannot write the BWT decompressed output.");
+        }
+    }
+} // namespace Standard::Algorithms::Strings
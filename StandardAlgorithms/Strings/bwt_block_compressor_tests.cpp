@@ -0,0 +1,217 @@
+#include"bwt_block_compressor_tests.h"
+#include"../Utilities/random.h"
+#include"../Utilities/test_utilities.h"
+#include"bwt_block_compressor.h"
+#include<array>
+#include<cstdint>
+#include<sstream>
+
+namespace
+{
+    [[nodiscard]] auto compress(const std::string &text, const std::size_t block_size) -> std::string
+    {
+        std::istringstream input(text);
+        std::ostringstream output;
+
+        Standard::Algorithms::Strings::bwt_compress(input, output, block_size);
+
+        return output.str();
+    }
+
+    [[nodiscard]] auto decompress(const std::string &compressed) -> std::string
+    {
+        std::istringstream input(compressed);
+        std::ostringstream output;
+
+        Standard::Algorithms::Strings::bwt_decompress(input, output);
+
+        return output.str();
+    }
+
+    auto round_trip(const std::string &text, const std::size_t block_size) -> std::string
+    {
+        auto compressed = compress(text, block_size);
+
+        ::Standard::Algorithms::ert::are_equal(
+            text, decompress(compressed), "BWT round trip size " + std::to_string(text.size()));
+
+        return compressed;
+    }
+
+    void crc32_test()
+    {
+        const std::string text = "123456789";
+        const auto bytes =
+            std::span<const std::uint8_t>(reinterpret_cast<const std::uint8_t *>(text.data()), text.size());
+
+        constexpr std::uint32_t expected = 0xCBF4'3926U;
+
+        ::Standard::Algorithms::ert::are_equal(expected, Standard::Algorithms::Numbers::crc32(bytes), "crc32");
+
+        const auto head = Standard::Algorithms::Numbers::crc32(bytes.first(4));
+
+        ::Standard::Algorithms::ert::are_equal(
+            expected, Standard::Algorithms::Numbers::crc32(bytes.subspan(4), head), "crc32 in 2 pieces");
+    }
+
+    void corrupted_tests()
+    {
+        const std::string text = "The quick brown fox jumps over the lazy dog, again and again.";
+        const auto compressed = compress(text, text.size());
+
+        ::Standard::Algorithms::ert::expect_exception<std::runtime_error>(
+            "Not a BWT compressed stream",
+            [&compressed]
+            {
+                [[maybe_unused]] auto res = decompress("X" + compressed.substr(1));
+            },
+            "bad signature");
+
+        ::Standard::Algorithms::ert::expect_exception<std::runtime_error>(
+            "truncated",
+            [&compressed]
+            {
+                [[maybe_unused]] auto res = decompress(compressed.substr(0, compressed.size() - 6U));
+            },
+            "truncated");
+
+        // A payload byte flip is either harmless, say in an unused code length, or detected, at the latest by the CRC.
+        constexpr auto payload_start = 20U;
+
+        for (auto index = payload_start; index + 4U < compressed.size(); ++index)
+        {
+            auto bad = compressed;
+            bad[index] = static_cast<char>(bad[index] ^ 0x10);
+
+            std::string actual;
+
+            try
+            {
+                actual = decompress(bad);
+            }
+            catch (const std::runtime_error &exc)
+            {
+                const std::string_view message = exc.what();
+
+                if (message.contains("BWT"))
+                {
+                    continue;
+                }
+
+                throw;
+            }
+
+            ::Standard::Algorithms::ert::are_equal(text, actual, "flipped byte " + std::to_string(index));
+        }
+    }
+
+    // The Fibonacci frequencies make the deepest Huffman tree: a code per symbol longer by 1,
+    // so the frequencies must be flattened to fit the max code length.
+    void fibonacci_code_lengths_test()
+    {
+        constexpr std::size_t symbol_count = 40;
+        static_assert(Standard::Algorithms::Strings::Inner::bwt_max_code_length + 1U < symbol_count);
+
+        std::array<std::uint64_t, Standard::Algorithms::Strings::Inner::bwt_alphabet_size> counts{};
+        counts[0] = counts[1] = 1;
+
+        for (std::size_t symbol = 2; symbol < symbol_count; ++symbol)
+        {
+            counts[symbol] = counts[symbol - 1U] + counts[symbol - 2U];
+        }
+
+        Standard::Algorithms::Strings::Inner::bwt_lengths_t lengths{};
+        Standard::Algorithms::Strings::Inner::bwt_code_lengths(counts, lengths);
+
+        // A complete prefix code has the Kraft sum of exactly 1.
+        constexpr auto max_length = Standard::Algorithms::Strings::Inner::bwt_max_code_length;
+
+        std::uint64_t kraft_sum{};
+
+        for (std::size_t symbol{}; symbol < lengths.size(); ++symbol)
+        {
+            const auto &length = lengths[symbol];
+            const auto name = "Fibonacci code length " + std::to_string(symbol);
+
+            if (symbol_count <= symbol)
+            {
+                ::Standard::Algorithms::ert::are_equal(0U, length, name);
+                continue;
+            }
+
+            Standard::Algorithms::require_positive(length, name);
+            Standard::Algorithms::require_less_equal(length, max_length, name);
+
+            kraft_sum += std::uint64_t{ 1 } << (max_length - length);
+        }
+
+        ::Standard::Algorithms::ert::are_equal(std::uint64_t{ 1 } << max_length, kraft_sum, "Fibonacci Kraft sum");
+    }
+
+    void random_tests(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd)
+    {
+        constexpr auto max_size = 5'000;
+        constexpr auto max_attempts = 10;
+
+        for (std::int32_t attempt{}; attempt < max_attempts; ++attempt)
+        {
+            std::string text(rnd(0, max_size), 'a');
+
+            // Sometimes all the bytes, else a few letters.
+            const auto max_char = attempt % 2 == 0 ? 255 : rnd(0, 3);
+
+            for (auto &cha : text)
+            {
+                cha = static_cast<char>(rnd(0, max_char));
+            }
+
+            const auto block_size = static_cast<std::size_t>(rnd(1, max_size));
+
+            round_trip(text, block_size);
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Strings::Tests::bwt_block_compressor_tests()
+{
+    crc32_test();
+    fibonacci_code_lengths_test();
+
+    round_trip("", 1);
+    round_trip("a", 1);
+    round_trip("banana", 2);
+    round_trip("mississippi", bwt_default_block_size);
+
+    {
+        std::string text(256, '\0');
+
+        for (std::size_t index{}; auto &cha : text)
+        {
+            cha = static_cast<char>(index++);
+        }
+
+        round_trip(text + text, 300);
+    }
+
+    {// Runs, and a repeated phrase must compress well; the code lengths take 161 bytes per block.
+        constexpr auto size = 100'000U;
+
+        const auto compressed = round_trip(std::string(size, 'z'), bwt_default_block_size);
+        require_greater(size / 200U, compressed.size(), "one letter compressed size");
+
+        std::string text;
+
+        while (text.size() < size)
+        {
+            text += "To be, or not to be, that is the question " + std::to_string(text.size() % 7U);
+        }
+
+        const auto compressed2 = round_trip(text, size / 3U);
+        require_greater(size / 20U, compressed2.size(), "phrase compressed size");
+    }
+
+    corrupted_tests();
+
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+    random_tests(rnd);
+}
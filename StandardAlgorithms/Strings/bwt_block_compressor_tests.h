@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Strings::Tests
+{
+    void bwt_block_compressor_tests();
+}
@@ -0,0 +1,264 @@
+#pragma once
+#include"../Numbers/wavelet_tree.h"
+#include"../Utilities/require_utilities.h"
+#include"suffix_array_sais.h"
+#include<algorithm>
+#include<array>
+#include<bit>
+#include<cassert>
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<string>
+#include<string_view>
+#include<vector>
+
+namespace Standard::Algorithms::Strings
+{
+    // FM-index of Ferragina, Manzini: a compressed full-text index, answering the substring queries
+    // without keeping either the text or its suffix array.
+    // The Burrows-Wheeler transform of the text plus a unique smallest sentinel is kept in a wavelet tree;
+    // the bytes are first mapped to the codes [1..sigma], where the sentinel is 0 and sigma is the alphabet size.
+    // Every "sample_rate"-th text position is sampled, both in the suffix array and in its inverse.
+    // Space: n*log2(sigma + 1) bits + 2*n/sample_rate indices + 1 bit per row.
+    // See also "burrows_wheeler_transform.h", "suffix_array_sais.h".
+    template<class index_t = std::uint32_t>
+    struct fm_index final
+    {
+        using code_t = std::uint16_t;
+
+        static constexpr std::size_t default_sample_rate = 32;
+
+        // Time O(n * log(sigma)).
+        explicit fm_index(const std::string_view text, const std::size_t sample_rate = default_sample_rate)
+            : Size(text.size())
+            , Sample_rate(require_positive(sample_rate, "sample rate"))
+            , Wavelet(make_wavelet(text))
+        {
+            build_samples();
+        }
+
+        // The text size.
+        [[nodiscard]] constexpr auto size() const noexcept -> std::size_t
+        {
+            return Size;
+        }
+
+        // The number of the pattern occurrences; an empty pattern occurs n + 1 times.
+        // Time O(|pattern| * log(sigma)).
+        [[nodiscard]] constexpr auto count(const std::string_view pattern) const -> std::size_t
+        {
+            const auto [begin, end] = row_range(pattern);
+            return end - begin;
+        }
+
+        // The start positions of the pattern occurrences, in no particular order.
+        // Time O(|pattern| * log(sigma) + occurrences * sample_rate * log(sigma)).
+        constexpr void locate(const std::string_view pattern, std::vector<std::size_t> &positions) const
+        {
+            const auto [begin, end] = row_range(pattern);
+
+            positions.clear();
+            positions.reserve(end - begin);
+
+            for (auto row = begin; row < end; ++row)
+            {
+                positions.push_back(locate_row(row));
+            }
+        }
+
+        // The text substring [start, start + length).
+        // Time O((length + sample_rate) * log(sigma)).
+        [[nodiscard]] constexpr auto extract(const std::size_t start, const std::size_t length) const -> std::string
+        {
+            require_less_equal(start, Size, "extract start");
+
+            const auto stop = start + std::min(length, Size - start);
+
+            // Walk backward from the nearest sampled position at or after the stop.
+            auto pos = std::min(Size, (stop + Sample_rate - 1U) / Sample_rate * Sample_rate);
+            auto row = pos == Size ? std::size_t{} : static_cast<std::size_t>(Inverse_samples[pos / Sample_rate]);
+
+            std::string result(stop - start, '\0');
+
+            while (start < pos)
+            {
+                const auto code = Wavelet.access(row);
+                assert(code != sentinel);
+
+                if (--pos < stop)
+                {
+                    result[pos - start] = static_cast<char>(Code_to_byte[code]);
+                }
+
+                row = last_to_first(code, row);
+            }
+
+            return result;
+        }
+
+private:
+        static constexpr code_t sentinel = 0;
+        static constexpr std::size_t byte_count = 256;
+
+        [[nodiscard]] static constexpr auto to_byte(const char cha) noexcept -> std::size_t
+        {
+            return static_cast<std::uint8_t>(cha);
+        }
+
+        [[nodiscard]] auto make_wavelet(const std::string_view text) -> Numbers::wavelet_tree<code_t>
+        {
+            Byte_to_code.fill(sentinel);
+
+            for (const auto &cha : text)
+            {
+                Byte_to_code[to_byte(cha)] = 1;
+            }
+
+            Code_to_byte.assign(1, 0);
+
+            for (std::size_t byte{}; byte < byte_count; ++byte)
+            {
+                if (Byte_to_code[byte] != sentinel)
+                {
+                    Byte_to_code[byte] = static_cast<code_t>(Code_to_byte.size());
+                    Code_to_byte.push_back(static_cast<std::uint8_t>(byte));
+                }
+            }
+
+            // The rows starting with each code.
+            Code_starts.assign(Code_to_byte.size() + 1U, 0U);
+            Code_starts[1] = 1; // The sentinel row.
+
+            // The suffixes are sorted by the codes, to have the same order as the unsigned bytes.
+            std::vector<code_t> codes(Size);
+
+            for (std::size_t pos{}; pos < Size; ++pos)
+            {
+                codes[pos] = Byte_to_code[to_byte(text[pos])];
+                ++Code_starts[codes[pos] + 1U];
+            }
+
+            for (std::size_t code = 1; code < Code_starts.size(); ++code)
+            {
+                Code_starts[code] += Code_starts[code - 1U];
+            }
+
+            Suffixes.reserve(Size + 1U);
+            Suffixes.push_back(static_cast<index_t>(Size)); // The sentinel suffix is the smallest.
+            {
+                std::vector<index_t> sar;
+                suffix_array_sais<index_t, code_t>(std::span<const code_t>(codes), sar);
+                Suffixes.insert(Suffixes.end(), sar.cbegin(), sar.cend());
+            }
+
+            std::vector<code_t> bwt(Size + 1U);
+
+            for (std::size_t row{}; row <= Size; ++row)
+            {
+                const auto pos = static_cast<std::size_t>(Suffixes[row]);
+                bwt[row] = pos == 0U ? sentinel : codes[pos - 1U];
+            }
+
+            const auto bit_count = std::max(1U, static_cast<std::uint32_t>(std::bit_width(Code_to_byte.size() - 1U)));
+
+            return Numbers::wavelet_tree<code_t>(std::span<const code_t>(bwt), bit_count);
+        }
+
+        // The full suffix array is only needed during the construction.
+        void build_samples()
+        {
+            assert(Suffixes.size() == Size + 1U);
+
+            Inverse_samples.resize((Size + Sample_rate - 1U) / Sample_rate);
+
+            Numbers::bit_array sampled(Size + 1U);
+
+            for (std::size_t row{}; row <= Size; ++row)
+            {
+                if (const auto pos = static_cast<std::size_t>(Suffixes[row]); pos % Sample_rate == 0U)
+                {
+                    sampled.set_bit(row);
+                    Samples.push_back(Suffixes[row]);
+
+                    if (pos < Size)
+                    {
+                        Inverse_samples[pos / Sample_rate] = static_cast<index_t>(row);
+                    }
+                }
+            }
+
+            Sampled_rows = Numbers::rank_select_bit_vector(std::move(sampled), Size + 1U);
+
+            Suffixes = {};
+        }
+
+        // LF mapping: the row of the suffix, one symbol longer, starting with the "code".
+        [[nodiscard]] constexpr auto last_to_first(const code_t code, const std::size_t row) const -> std::size_t
+        {
+            return Code_starts[code] + Wavelet.rank(code, row);
+        }
+
+        // The rows [begin, end) of the suffixes starting with the pattern, by the backward search.
+        [[nodiscard]] constexpr auto row_range(const std::string_view pattern) const
+            -> std::pair<std::size_t, std::size_t>
+        {
+            std::size_t begin{};
+            auto end = Size + 1U;
+
+            for (auto index = pattern.size(); 0U < index-- && begin < end;)
+            {
+                const auto code = Byte_to_code[to_byte(pattern[index])];
+
+                if (code == sentinel)
+                {
+                    return {};
+                }
+
+                begin = last_to_first(code, begin);
+                end = last_to_first(code, end);
+            }
+
+            return { begin, std::max(begin, end) };
+        }
+
+        // The row of the text position 0 is sampled, so the loop stops before the sentinel.
+        [[nodiscard]] constexpr auto locate_row(std::size_t row) const -> std::size_t
+        {
+            std::size_t steps{};
+
+            while (!Sampled_rows.get_bit(row))
+            {
+                const auto code = Wavelet.access(row);
+                assert(code != sentinel);
+
+                row = last_to_first(code, row);
+                ++steps;
+            }
+
+            return static_cast<std::size_t>(Samples[Sampled_rows.rank1(row)]) + steps;
+        }
+
+        std::size_t Size;
+        std::size_t Sample_rate;
+
+        std::array<code_t, byte_count> Byte_to_code{};
+        std::vector<std::uint8_t> Code_to_byte{};
+
+        // The number of the symbols smaller than a code, including the sentinel.
+        std::vector<std::size_t> Code_starts{};
+
+        // Temporary.
+        std::vector<index_t> Suffixes{};
+
+        Numbers::wavelet_tree<code_t> Wavelet;
+
+        Numbers::rank_select_bit_vector Sampled_rows{};
+
+        // The text positions of the sampled rows, in the row order.
+        std::vector<index_t> Samples{};
+
+        // The rows of the text positions 0, sample_rate, 2*sample_rate, ..
+        std::vector<index_t> Inverse_samples{};
+    };
+} // namespace Standard::Algorithms::Strings
@@ -0,0 +1,136 @@
+#include"fm_index_tests.h"
+#include"../Numbers/wavelet_tree.h"
+#include"../Utilities/random.h"
+#include"../Utilities/test_utilities.h"
+#include"fm_index.h"
+
+namespace
+{
+    void wavelet_tree_test(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd)
+    {
+        constexpr auto max_size = 1'000;
+        constexpr std::uint32_t bit_count = 5;
+        constexpr auto max_symbol = (1 << bit_count) - 1;
+
+        std::vector<std::uint16_t> symbols(rnd(0, max_size));
+
+        // A few symbols are absent.
+        for (auto &symbol : symbols)
+        {
+            symbol = static_cast<std::uint16_t>(rnd(0, max_symbol / 2) * 2);
+        }
+
+        const Standard::Algorithms::Numbers::wavelet_tree<std::uint16_t> tree(
+            std::span<const std::uint16_t>(symbols), bit_count);
+
+        ::Standard::Algorithms::ert::are_equal(symbols.size(), tree.size(), "wavelet tree size");
+
+        std::vector<std::size_t> counts(max_symbol + 1);
+
+        for (std::size_t position{}; position <= symbols.size(); ++position)
+        {
+            for (std::int32_t symbol{}; symbol <= max_symbol; ++symbol)
+            {
+                ::Standard::Algorithms::ert::are_equal(counts[symbol],
+                    tree.rank(static_cast<std::uint16_t>(symbol), position), "wavelet tree rank");
+            }
+
+            if (position == symbols.size())
+            {
+                break;
+            }
+
+            ::Standard::Algorithms::ert::are_equal(symbols[position], tree.access(position), "wavelet tree access");
+
+            ++counts[symbols[position]];
+        }
+    }
+
+    void fm_index_test(const std::string &text, const std::size_t sample_rate, const std::string &pattern)
+    {
+        const Standard::Algorithms::Strings::fm_index<> index(text, sample_rate);
+
+        std::vector<std::size_t> expected;
+
+        for (auto pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1U))
+        {
+            expected.push_back(pos);
+        }
+
+        const auto name = "text '" + text + "', pattern '" + pattern + "'";
+
+        ::Standard::Algorithms::ert::are_equal(expected.size(), index.count(pattern), "count " + name);
+
+        std::vector<std::size_t> actual;
+        index.locate(pattern, actual);
+        std::sort(actual.begin(), actual.end());
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "locate " + name);
+    }
+
+    void fm_index_extract_test(const std::string &text, const std::size_t sample_rate)
+    {
+        const Standard::Algorithms::Strings::fm_index<> index(text, sample_rate);
+        ::Standard::Algorithms::ert::are_equal(text.size(), index.size(), "size");
+
+        for (std::size_t start{}; start <= text.size(); ++start)
+        {
+            for (std::size_t length{}; start + length <= text.size() + 1U; ++length)
+            {
+                ::Standard::Algorithms::ert::are_equal(
+                    text.substr(start, length), index.extract(start, length), "extract " + text);
+            }
+        }
+    }
+
+    void fm_index_random_tests(Standard::Algorithms::Utilities::random_t<std::int32_t> &rnd)
+    {
+        constexpr auto max_size = 200;
+        constexpr auto max_attempts = 10;
+
+        for (std::int32_t attempt{}; attempt < max_attempts; ++attempt)
+        {
+            std::string text(rnd(0, max_size), 'a');
+
+            // Including the zero and negative chars.
+            for (auto &cha : text)
+            {
+                cha = static_cast<char>(rnd(-1, 2));
+            }
+
+            const auto sample_rate = static_cast<std::size_t>(rnd(1, 10));
+
+            fm_index_extract_test(text, sample_rate);
+
+            for (std::int32_t pattern_size = 1; pattern_size <= 4; ++pattern_size)
+            {
+                std::string pattern(pattern_size, 'a');
+
+                for (auto &cha : pattern)
+                {
+                    cha = static_cast<char>(rnd(-1, 2));
+                }
+
+                fm_index_test(text, sample_rate, pattern);
+            }
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Strings::Tests::fm_index_tests()
+{
+    fm_index_test("banana", 2, "ana");
+    fm_index_test("banana", 1, "nab");
+    fm_index_test("banana", 3, "z");
+    fm_index_test("mississippi", 4, "ssi");
+    fm_index_test("mississippi", 4, "mississippi");
+    fm_index_test("mississippi", 4, "mississippii");
+    fm_index_test("", 1, "a");
+
+    fm_index_extract_test("abracadabra", 3);
+
+    Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+    wavelet_tree_test(rnd);
+    fm_index_random_tests(rnd);
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Strings::Tests
+{
+    void fm_index_tests();
+}
@@ -1,12 +1,46 @@
 #include"lcp_tests.h"
 #include"../Numbers/permutation.h"
+#include"../Numbers/uint40.h"
 #include"../Utilities/iota_vector.h"
 #include"../Utilities/random.h"
 #include"../Utilities/test_utilities.h"
 #include"suffix_array.h"
+#include"suffix_array_doubling_parallel.h"
+#include"suffix_array_sais.h"
 
 namespace
 {
+    template<class index_t, class char_t>
+    void check_sais(const std::span<const char_t> str, const std::vector<std::int32_t> &sa_expected,
+        const std::vector<std::int32_t> &lcp_expected, const std::string &name)
+    {
+        std::vector<index_t> sar;
+        Standard::Algorithms::Strings::suffix_array_sais<index_t, char_t>(str, sar);
+
+        std::vector<index_t> lcp;
+        Standard::Algorithms::Strings::lcp_phi<index_t, char_t>(str, sar, lcp);
+
+        const std::vector<std::int32_t> sa_actual(sar.cbegin(), sar.cend());
+        ::Standard::Algorithms::ert::are_equal(sa_expected, sa_actual, "sar suffix_array_sais " + name);
+
+        const std::vector<std::int32_t> lcp_actual(lcp.cbegin(), lcp.cend());
+        ::Standard::Algorithms::ert::are_equal(lcp_expected, lcp_actual, "lcp_phi " + name);
+
+        Standard::Algorithms::Strings::suffix_array_doubling_parallel<index_t, char_t>(str, sar);
+
+        const std::vector<std::int32_t> sa_doubling(sar.cbegin(), sar.cend());
+        ::Standard::Algorithms::ert::are_equal(sa_expected, sa_doubling, "sar suffix_array_doubling_parallel " + name);
+    }
+
+    template<class char_t>
+    void check_all_sais(const std::span<const char_t> str, const std::vector<std::int32_t> &sa_expected,
+        const std::vector<std::int32_t> &lcp_expected)
+    {
+        check_sais<std::uint32_t, char_t>(str, sa_expected, lcp_expected, "uint32");
+        check_sais<Standard::Algorithms::Numbers::uint40_t, char_t>(str, sa_expected, lcp_expected, "uint40");
+        check_sais<std::uint64_t, char_t>(str, sa_expected, lcp_expected, "uint64");
+    }
+
     void run_lcp_test(std::vector<bool> &taken, const std::vector<std::int32_t> &raw_sa_expected,
         const std::string &str, const std::vector<std::int32_t> &raw_lcp_expected, const bool is_computed = true)
     {
@@ -32,6 +66,8 @@ namespace
                 ::Standard::Algorithms::ert::are_equal(sa_expected, sa_fast, "sar suffix_array_other");
                 ::Standard::Algorithms::ert::are_equal(lcp_expected, lcp_fast, "lcp suffix_array_other");
             }
+
+            check_all_sais<char>(str, sa_expected, lcp_expected);
             {
                 const auto sa_still = Standard::Algorithms::Strings::suffix_array_slow_still(str);
 
@@ -77,6 +113,85 @@ namespace
         }
     }
 
+    // Long texts over small alphabets have deep SA-IS recursions.
+    void sais_random_tests()
+    {
+        Standard::Algorithms::Utilities::random_t<std::int32_t> rnd{};
+
+        constexpr auto max_size = 5'000;
+        constexpr auto max_alphabet = 4;
+
+        std::vector<std::int32_t> sar;
+        std::vector<std::int32_t> lcp;
+
+        for (std::int32_t alphabet = 1; alphabet <= max_alphabet; ++alphabet)
+        {
+            std::string str(rnd(0, max_size), 'a');
+
+            for (auto &cha : str)
+            {
+                cha = static_cast<char>('a' + rnd(0, alphabet - 1));
+            }
+
+            Standard::Algorithms::Strings::suffix_array_other(str, sar, &lcp);
+
+            check_all_sais<char>(str, sar, lcp);
+        }
+
+        {// Several chunks in parallel.
+            constexpr auto size = 100'000;
+            constexpr auto period = 1'000;
+
+            std::string str(size, 'a');
+
+            for (std::int32_t index{}; index < size; ++index)
+            {
+                str[index] = static_cast<char>('a' + (index < period ? rnd(0, 1) : str[index - period] - 'a'));
+            }
+
+            std::vector<std::uint32_t> sar_sais;
+            Standard::Algorithms::Strings::suffix_array_sais<std::uint32_t, char>(str, sar_sais);
+
+            std::vector<std::uint32_t> sar_doubling;
+            Standard::Algorithms::Strings::suffix_array_doubling_parallel<std::uint32_t, char>(str, sar_doubling);
+
+            ::Standard::Algorithms::ert::are_equal(sar_sais, sar_doubling, "periodic suffix_array_doubling_parallel");
+        }
+
+        {// Negative symbols.
+            constexpr auto size = 300;
+            constexpr auto max_symbol = 2;
+
+            std::vector<std::int32_t> text(size);
+
+            for (auto &symbol : text)
+            {
+                symbol = rnd(-max_symbol, max_symbol);
+            }
+
+            sar = ::Standard::Algorithms::Utilities::iota_vector<std::int32_t>(size);
+
+            std::sort(sar.begin(), sar.end(),
+                [&text](const auto &one, const auto &two)
+                {
+                    return std::lexicographical_compare(
+                        text.cbegin() + one, text.cend(), text.cbegin() + two, text.cend());
+                });
+
+            lcp.assign(size, 0);
+
+            for (std::int32_t index = 1; index < size; ++index)
+            {
+                const auto one = text.cbegin() + sar[index - 1];
+                const auto two = text.cbegin() + sar[index];
+
+                lcp[index] = static_cast<std::int32_t>(std::mismatch(one, text.cend(), two, text.cend()).first - one);
+            }
+
+            check_all_sais<std::int32_t>(text, sar, lcp);
+        }
+    }
+
     void preset_tests()
     {
         // Here the last character don't have to be unique.
@@ -134,4 +249,5 @@ void Standard::Algorithms::Strings::Tests::lcp_tests()
     // See also suffix_array_tests.
     preset_tests();
     random_tests();
+    sais_random_tests();
 }
@@ -0,0 +1,304 @@
+#pragma once
+#include"../Utilities/has_openmp.h"
+#include"suffix_array_sais.h" // sais_empty, sais_require_size
+#include<algorithm>
+#include<bit>
+#include<cassert>
+#include<concepts>
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<type_traits>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms::Strings::Inner
+{
+    // The rank of a suffix by its first h symbols is in [1..n]; 0 is for the empty suffix past the end.
+    // A round doubles h by sorting the (rank[i], rank[i + h]) pairs: the order by the second rank
+    // is read off the previous round suffix array, then a stable LSD radix sort by the first rank follows.
+    // The items are split into contiguous chunks, one per thread;
+    // a radix pass counts the digits per chunk, so that every chunk scatters into its own slots, keeping stability.
+    template<class index_t>
+    struct doubling_context final
+    {
+        using item_t = std::pair<index_t, index_t>; // Key, position.
+
+        static constexpr std::uint32_t digit_bits = 8;
+        static constexpr std::size_t radix = 1U << digit_bits;
+        static constexpr std::size_t min_chunk_size = 1U << 14U;
+
+        constexpr explicit doubling_context(const std::size_t size)
+            : Size(size)
+            , Chunks(std::max<std::size_t>(1, std::min(omp_thread_count(), size / min_chunk_size)))
+            , Ranks(size)
+            , Items(size)
+            , Buffer(size)
+            , Counts(Chunks * radix)
+            , Chunk_sums(Chunks)
+        {
+            assert(1U < size);
+        }
+
+        template<class symbols_t>
+        void run(const symbols_t &symbols, const std::size_t max_key, std::vector<index_t> &sar)
+        {
+            const auto size = static_cast<std::int64_t>(Size);
+
+#pragma omp parallel for default(none) shared(size, symbols) schedule(static)
+            for (std::int64_t pos = 0; pos < size; ++pos)
+            {
+                Items[pos] = { static_cast<index_t>(symbols(static_cast<std::size_t>(pos)) + 1U),
+                    static_cast<index_t>(pos) };
+            }
+
+            radix_sort(max_key + 1U);
+
+            for (auto rank_count = update_ranks(0), half = std::size_t{ 1 }; rank_count < Size; half *= 2U)
+            {
+                order_by_second_rank(half);
+                radix_sort(rank_count);
+                rank_count = update_ranks(half);
+            }
+
+#pragma omp parallel for default(none) shared(size, sar) schedule(static)
+            for (std::int64_t index = 0; index < size; ++index)
+            {
+                sar[index] = Items[index].second;
+            }
+        }
+
+private:
+        [[nodiscard]] constexpr auto chunk_bounds(const std::size_t chunk) const noexcept
+            -> std::pair<std::size_t, std::size_t>
+        {
+            assert(chunk < Chunks);
+
+            return { Size * chunk / Chunks, Size * (chunk + 1U) / Chunks };
+        }
+
+        [[nodiscard]] constexpr auto rank(const std::size_t pos) const -> std::size_t
+        {
+            return pos < Size ? static_cast<std::size_t>(Ranks[pos]) : 0U;
+        }
+
+        // Exclusive prefix sums of the Chunk_sums; return the total.
+        constexpr auto scan_chunk_sums() noexcept -> std::size_t
+        {
+            std::size_t sum{};
+
+            for (auto &chunk_sum : Chunk_sums)
+            {
+                const auto count = chunk_sum;
+                chunk_sum = sum;
+                sum += count;
+            }
+
+            return sum;
+        }
+
+        // The positions in [n - h, n) have the empty second half; the rest follow in the previous order.
+        void order_by_second_rank(const std::size_t half)
+        {
+            assert(0U < half && half < Size);
+
+            const auto chunks = static_cast<std::int64_t>(Chunks);
+
+#pragma omp parallel for default(none) shared(chunks, half) schedule(static, 1)
+            for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                const auto [begin, end] = chunk_bounds(chunk);
+                std::size_t count{};
+
+                for (auto index = begin; index < end; ++index)
+                {
+                    count += half <= static_cast<std::size_t>(Items[index].second) ? 1U : 0U;
+                }
+
+                Chunk_sums[chunk] = count;
+            }
+
+            [[maybe_unused]] const auto kept = scan_chunk_sums();
+            assert(kept == Size - half);
+
+#pragma omp parallel for default(none) shared(chunks, half) schedule(static, 1)
+            for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                const auto [begin, end] = chunk_bounds(chunk);
+                auto slot = half + Chunk_sums[chunk];
+
+                for (auto index = begin; index < end; ++index)
+                {
+                    if (const auto pos = static_cast<std::size_t>(Items[index].second); half <= pos)
+                    {
+                        Buffer[slot++] = { Ranks[pos - half], static_cast<index_t>(pos - half) };
+                    }
+                }
+            }
+
+            for (auto pos = Size - half; pos < Size; ++pos)
+            {
+                Buffer[pos - (Size - half)] = { Ranks[pos], static_cast<index_t>(pos) };
+            }
+
+            std::swap(Items, Buffer);
+        }
+
+        // Stable by the keys in [0..max_key].
+        void radix_sort(const std::size_t max_key)
+        {
+            const auto key_bits = static_cast<std::uint32_t>(std::bit_width(max_key));
+
+            for (std::uint32_t shift{}; shift < key_bits; shift += digit_bits)
+            {
+                radix_pass(shift);
+            }
+        }
+
+        void radix_pass(const std::uint32_t shift)
+        {
+            const auto chunks = static_cast<std::int64_t>(Chunks);
+
+#pragma omp parallel for default(none) shared(chunks, shift) schedule(static, 1)
+            for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                const auto [begin, end] = chunk_bounds(chunk);
+                const auto counts = std::span<std::size_t>(Counts).subspan(chunk * radix, radix);
+
+                std::fill(counts.begin(), counts.end(), std::size_t{});
+
+                for (auto index = begin; index < end; ++index)
+                {
+                    ++counts[(static_cast<std::size_t>(Items[index].first) >> shift) & (radix - 1U)];
+                }
+            }
+
+            // The digit major, the chunk minor order.
+            std::size_t sum{};
+
+            for (std::size_t digit{}; digit < radix; ++digit)
+            {
+                for (std::size_t chunk{}; chunk < Chunks; ++chunk)
+                {
+                    auto &count = Counts[chunk * radix + digit];
+                    const auto temp = count;
+                    count = sum;
+                    sum += temp;
+                }
+            }
+
+#pragma omp parallel for default(none) shared(chunks, shift) schedule(static, 1)
+            for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                const auto [begin, end] = chunk_bounds(chunk);
+                const auto offsets = std::span<std::size_t>(Counts).subspan(chunk * radix, radix);
+
+                for (auto index = begin; index < end; ++index)
+                {
+                    const auto &item = Items[index];
+                    Buffer[offsets[(static_cast<std::size_t>(item.first) >> shift) & (radix - 1U)]++] = item;
+                }
+            }
+
+            std::swap(Items, Buffer);
+        }
+
+        // The items are sorted by the pairs; equal adjacent pairs get equal ranks.
+        // Return the number of distinct ranks.
+        [[nodiscard]] auto update_ranks(const std::size_t half) -> std::size_t
+        {
+            const auto chunks = static_cast<std::int64_t>(Chunks);
+
+            // The Buffer keys are the flags of a new rank.
+#pragma omp parallel for default(none) shared(chunks, half) schedule(static, 1)
+            for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                const auto [begin, end] = chunk_bounds(chunk);
+                std::size_t count{};
+
+                for (auto index = begin; index < end; ++index)
+                {
+                    auto is_new = index == 0U || Items[index - 1U].first != Items[index].first;
+
+                    if (!is_new && 0U < half)
+                    {
+                        is_new = rank(static_cast<std::size_t>(Items[index - 1U].second) + half) !=
+                            rank(static_cast<std::size_t>(Items[index].second) + half);
+                    }
+
+                    Buffer[index].first = static_cast<index_t>(is_new ? 1U : 0U);
+                    count += is_new ? 1U : 0U;
+                }
+
+                Chunk_sums[chunk] = count;
+            }
+
+            const auto rank_count = scan_chunk_sums();
+
+            // No old rank is read below.
+#pragma omp parallel for default(none) shared(chunks) schedule(static, 1)
+            for (std::int64_t chunk = 0; chunk < chunks; ++chunk)
+            {
+                const auto [begin, end] = chunk_bounds(chunk);
+                auto current = Chunk_sums[chunk];
+
+                for (auto index = begin; index < end; ++index)
+                {
+                    current += static_cast<std::size_t>(Buffer[index].first);
+
+                    Ranks[static_cast<std::size_t>(Items[index].second)] = static_cast<index_t>(current);
+                }
+            }
+
+            return rank_count;
+        }
+
+        std::size_t Size;
+        std::size_t Chunks;
+        std::vector<index_t> Ranks;
+        std::vector<item_t> Items;
+        std::vector<item_t> Buffer;
+        std::vector<std::size_t> Counts;
+        std::vector<std::size_t> Chunk_sums;
+    };
+} // namespace Standard::Algorithms::Strings::Inner
+
+namespace Standard::Algorithms::Strings
+{
+    // Multi-threaded prefix doubling suffix array, the same output as suffix_array_sais.
+    // Each round doubles the sorted prefix length with a parallel LSD radix sort on the rank pairs,
+    // and recomputes the ranks with parallel prefix sums; the rounds stop when all the ranks are distinct,
+    // that is after log2(max LCP) + 2 rounds.
+    // The "index_t" max value must exceed both the text size and the symbol range.
+    // Space O(n): 5 index arrays.
+    // Time O(n * log(max LCP) * log(n) / 8 / threads), where 8 is the bits per radix digit.
+    template<class index_t, std::integral char_t>
+    void suffix_array_doubling_parallel(const std::span<const char_t> text, std::vector<index_t> &sar)
+    {
+        const auto size = text.size();
+        Inner::sais_require_size<index_t>(size);
+
+        sar.resize(size);
+
+        if (size <= 1U)
+        {
+            std::fill(sar.begin(), sar.end(), index_t{});
+            return;
+        }
+
+        const auto [min_it, max_it] = std::minmax_element(text.begin(), text.end());
+
+        const Inner::sais_text_symbols<char_t> symbols{ text, *min_it };
+        const auto max_symbol = symbols(static_cast<std::size_t>(max_it - text.begin()));
+
+        if (constexpr auto empty = Inner::sais_empty<index_t>; !(max_symbol + 1U < empty)) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The symbol range " << max_symbol << " must be less than the max index " << empty << ".";
+            throw_exception(str);
+        }
+
+        Inner::doubling_context<index_t> context(size);
+        context.run(symbols, max_symbol, sar);
+    }
+} // namespace Standard::Algorithms::Strings
@@ -0,0 +1,432 @@
+#pragma once
+#include"../Utilities/throw_exception.h"
+#include<algorithm>
+#include<cassert>
+#include<concepts>
+#include<cstddef>
+#include<cstdint>
+#include<span>
+#include<type_traits>
+#include<vector>
+
+namespace Standard::Algorithms::Strings::Inner
+{
+    // The max value of the index type marks an empty slot; it is 2**40 - 1 for uint40_t.
+    template<class index_t>
+    inline constexpr auto sais_empty = static_cast<std::size_t>(static_cast<index_t>(~std::uint64_t{}));
+
+    // The input alphabet range may exceed the text size by at most this.
+    constexpr std::size_t sais_max_extra_alphabet = 1U << 16U;
+
+    // The input symbols are shifted to start from 0.
+    template<std::integral char_t>
+    struct sais_text_symbols final
+    {
+        using unsigned_t = std::make_unsigned_t<char_t>;
+
+        [[nodiscard]] constexpr auto operator() (const std::size_t index) const -> std::size_t
+        {
+            return static_cast<unsigned_t>(static_cast<unsigned_t>(text[index]) - static_cast<unsigned_t>(min));
+        }
+
+        // NOLINTNEXTLINE
+        std::span<const char_t> text{};
+
+        // NOLINTNEXTLINE
+        char_t min{};
+    };
+
+    // The reduced string is stored in the tail of the parent suffix array.
+    template<class index_t>
+    struct sais_reduced_symbols final
+    {
+        [[nodiscard]] constexpr auto operator() (const std::size_t index) const -> std::size_t
+        {
+            return static_cast<std::size_t>(text[index]);
+        }
+
+        // NOLINTNEXTLINE
+        std::span<const index_t> text{};
+    };
+
+    // The suffix "size", made of a virtual sentinel, is smaller than any other.
+    // The types are: true for S (smaller than the next suffix), false for L.
+    template<class index_t, class symbols_t>
+    struct sais_context final
+    {
+        constexpr sais_context(
+            const symbols_t &symbols, const std::size_t size, const std::size_t alphabet_size, std::span<index_t> sar)
+            : Symbols(symbols)
+            , Size(size)
+            , Sar(sar)
+            , Alphabet_size(alphabet_size)
+            , Types(size)
+        {
+            assert(1U < size && sar.size() == size);
+
+            for (auto index = Size - 1U; 0U < index--;)
+            {
+                const auto cur = Symbols(index);
+                const auto next = Symbols(index + 1U);
+
+                Types[index] = cur < next || (cur == next && Types[index + 1U]);
+            }
+        }
+
+        void run()
+        {
+            constexpr auto empty = sais_empty<index_t>;
+
+            // Step 1. Sort the LMS substrings by inducing from the LMS suffixes put in any order.
+            std::fill(Sar.begin(), Sar.end(), static_cast<index_t>(empty));
+            bucket_bounds(true);
+
+            for (std::size_t index = 1; index < Size; ++index)
+            {
+                if (is_lms(index))
+                {
+                    put(bucket_back(Symbols(index)), index);
+                }
+            }
+
+            induce();
+
+            // Step 2. Name the LMS substrings; the reduced string has at most n/2 symbols.
+            std::size_t lms_count{};
+
+            for (std::size_t index{}; index < Size; ++index)
+            {
+                if (const auto pos = at(index); is_lms(pos))
+                {
+                    put(lms_count++, pos);
+                }
+            }
+
+            assert(lms_count * 2U <= Size);
+            std::fill(Sar.begin() + static_cast<std::ptrdiff_t>(lms_count), Sar.end(), static_cast<index_t>(empty));
+
+            const auto name_count = name_lms_substrings(lms_count);
+
+            // Step 3. Sort the LMS suffixes, recursively when the names repeat.
+            const auto reduced = Sar.last(lms_count);
+            const auto sub_sar = Sar.first(lms_count);
+
+            if (name_count < lms_count)
+            {
+                // Free the buckets during the recursion.
+                Buckets = {};
+
+                const sais_reduced_symbols<index_t> sub_symbols{ reduced };
+
+                sais_context<index_t, sais_reduced_symbols<index_t>> sub(
+                    sub_symbols, lms_count, name_count, sub_sar);
+
+                sub.run();
+            }
+            else
+            {
+                for (std::size_t index{}; index < lms_count; ++index)
+                {
+                    sub_sar[static_cast<std::size_t>(reduced[index])] = static_cast<index_t>(index);
+                }
+            }
+
+            // Step 4. Induce all the suffixes from the sorted LMS suffixes.
+            for (std::size_t index = 1, count{}; index < Size; ++index)
+            {
+                if (is_lms(index))
+                {
+                    reduced[count++] = static_cast<index_t>(index);
+                }
+            }
+
+            for (auto &pos : sub_sar)
+            {
+                pos = reduced[static_cast<std::size_t>(pos)];
+            }
+
+            std::fill(Sar.begin() + static_cast<std::ptrdiff_t>(lms_count), Sar.end(), static_cast<index_t>(empty));
+            bucket_bounds(true);
+
+            // The positions only move right, so that none is overwritten before being read.
+            for (auto index = lms_count; 0U < index--;)
+            {
+                const auto pos = at(index);
+                Sar[index] = static_cast<index_t>(empty);
+                put(bucket_back(Symbols(pos)), pos);
+            }
+
+            induce();
+        }
+
+private:
+        [[nodiscard]] constexpr auto at(const std::size_t index) const -> std::size_t
+        {
+            return static_cast<std::size_t>(Sar[index]);
+        }
+
+        constexpr void put(const std::size_t index, const std::size_t pos)
+        {
+            Sar[index] = static_cast<index_t>(pos);
+        }
+
+        [[nodiscard]] constexpr auto is_lms(const std::size_t pos) const -> bool
+        {
+            return 0U < pos && pos < Size && Types[pos] && !Types[pos - 1U];
+        }
+
+        // Take the next free slot from the bucket start.
+        [[nodiscard]] constexpr auto bucket_front(const std::size_t symbol) -> std::size_t
+        {
+            auto &bound = Buckets[symbol];
+            const auto slot = static_cast<std::size_t>(bound);
+
+            bound = static_cast<index_t>(slot + 1U);
+            return slot;
+        }
+
+        // Take the last free slot from the bucket end.
+        [[nodiscard]] constexpr auto bucket_back(const std::size_t symbol) -> std::size_t
+        {
+            auto &bound = Buckets[symbol];
+            const auto slot = static_cast<std::size_t>(bound) - 1U;
+
+            bound = static_cast<index_t>(slot);
+            return slot;
+        }
+
+        // Either the bucket starts or the ends (exclusive).
+        // The bounds are stored in "index_t" to take no more space than the suffix array part being sorted.
+        constexpr void bucket_bounds(const bool is_end)
+        {
+            Buckets.assign(Alphabet_size, index_t{});
+
+            for (std::size_t index{}; index < Size; ++index)
+            {
+                auto &bound = Buckets[Symbols(index)];
+                bound = static_cast<index_t>(static_cast<std::size_t>(bound) + 1U);
+            }
+
+            std::size_t sum{};
+
+            for (auto &bound : Buckets)
+            {
+                const auto count = static_cast<std::size_t>(bound);
+                sum += count;
+                bound = static_cast<index_t>(is_end ? sum : sum - count);
+            }
+        }
+
+        constexpr void induce()
+        {
+            constexpr auto empty = sais_empty<index_t>;
+
+            // The L suffixes, left to right, starting from the one before the sentinel.
+            bucket_bounds(false);
+            put(bucket_front(Symbols(Size - 1U)), Size - 1U);
+
+            for (std::size_t index{}; index < Size; ++index)
+            {
+                if (const auto pos = at(index); pos != empty && 0U < pos && !Types[pos - 1U])
+                {
+                    put(bucket_front(Symbols(pos - 1U)), pos - 1U);
+                }
+            }
+
+            // The S suffixes, right to left.
+            bucket_bounds(true);
+
+            for (auto index = Size; 0U < index--;)
+            {
+                if (const auto pos = at(index); pos != empty && 0U < pos && Types[pos - 1U])
+                {
+                    put(bucket_back(Symbols(pos - 1U)), pos - 1U);
+                }
+            }
+        }
+
+        // The sorted LMS positions are in Sar[0..lms_count); the names go to the tail in the text order.
+        // Return the number of distinct names.
+        [[nodiscard]] constexpr auto name_lms_substrings(const std::size_t lms_count) -> std::size_t
+        {
+            constexpr auto empty = sais_empty<index_t>;
+
+            std::size_t name_count{};
+            auto previous = empty;
+
+            for (std::size_t index{}; index < lms_count; ++index)
+            {
+                const auto pos = at(index);
+
+                if (previous == empty || !are_lms_substrings_equal(previous, pos))
+                {
+                    ++name_count;
+                    previous = pos;
+                }
+
+                // The LMS positions differ by at least 2.
+                put(lms_count + pos / 2U, name_count - 1U);
+            }
+
+            for (auto index = Size, tail = Size; lms_count < index--;)
+            {
+                if (const auto name = at(index); name != empty)
+                {
+                    put(--tail, name);
+                }
+            }
+
+            return name_count;
+        }
+
+        [[nodiscard]] constexpr auto are_lms_substrings_equal(const std::size_t one, const std::size_t two) const
+            -> bool
+        {
+            for (std::size_t delta{};; ++delta)
+            {
+                // The sentinel is unique.
+                if (one + delta == Size || two + delta == Size || Symbols(one + delta) != Symbols(two + delta) ||
+                    Types[one + delta] != Types[two + delta])
+                {
+                    return false;
+                }
+
+                // The types before are equal too.
+                if (0U < delta && is_lms(one + delta))
+                {
+                    return true;
+                }
+            }
+        }
+
+        const symbols_t &Symbols;
+        std::size_t Size;
+        std::span<index_t> Sar;
+        std::size_t Alphabet_size;
+        std::vector<bool> Types;
+        std::vector<index_t> Buckets{};
+    };
+
+    template<class index_t>
+    constexpr void sais_require_size(const std::size_t size)
+    {
+        if (constexpr auto empty = sais_empty<index_t>; !(size < empty)) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The text size " << size << " must be less than the max index " << empty << ".";
+            throw_exception(str);
+        }
+    }
+} // namespace Standard::Algorithms::Strings::Inner
+
+namespace Standard::Algorithms::Strings
+{
+    // Suffix array by the induced sorting SA-IS of Nong, Zhang, Chan:
+    // sar[i] is the start of the i-th smallest non-empty suffix, the same as suffix_array_other.
+    // The "index_t" can be std::uint32_t, Numbers::uint40_t (5 bytes), std::uint64_t;
+    // its max value must exceed the text size. Any integer "char_t" is supported;
+    // the buckets take (max - min + 1) indices, where the min, max are over the text.
+    // The space besides the input, output: n bits of the suffix types plus the buckets,
+    // as the reduced string, the names, and the recursive suffix array all live in the output array.
+    // Time O(n).
+    template<class index_t, std::integral char_t>
+    constexpr void suffix_array_sais(const std::span<const char_t> text, std::vector<index_t> &sar)
+    {
+        const auto size = text.size();
+        Inner::sais_require_size<index_t>(size);
+
+        sar.resize(size);
+
+        if (size <= 1U)
+        {
+            std::fill(sar.begin(), sar.end(), index_t{});
+            return;
+        }
+
+        const auto [min_it, max_it] = std::minmax_element(text.begin(), text.end());
+
+        const Inner::sais_text_symbols<char_t> symbols{ text, *min_it };
+        const auto max_symbol = symbols(static_cast<std::size_t>(max_it - text.begin()));
+
+        if (size + Inner::sais_max_extra_alphabet <= max_symbol) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The alphabet range " << max_symbol << " is too large for the text size " << size
+                << "; compress the alphabet first.";
+            throw_exception(str);
+        }
+
+        Inner::sais_context<index_t, Inner::sais_text_symbols<char_t>> context(
+            symbols, size, max_symbol + 1U, std::span<index_t>(sar));
+
+        context.run();
+    }
+
+    // Longest common prefix, the same as in suffix_array_other: lcp[i] is of the suffixes sar[i], sar[i - 1].
+    // Kasai et al., in the permuted form of Karkkainen, Manzini, Puglisi:
+    // phi[sar[i]] = sar[i - 1], and then plcp[pos] >= plcp[pos - 1] - 1 in the text order,
+    // so that the text is scanned sequentially. The "phi" array is reused for the "plcp".
+    // Space: n indices besides the output.
+    // Time O(n).
+    template<class index_t, std::integral char_t>
+    constexpr void lcp_phi(
+        const std::span<const char_t> text, const std::vector<index_t> &sar, std::vector<index_t> &lcp)
+    {
+        constexpr auto empty = Inner::sais_empty<index_t>;
+
+        const auto size = text.size();
+        Inner::sais_require_size<index_t>(size);
+
+        if (size != sar.size()) [[unlikely]]
+        {
+            auto str = ::Standard::Algorithms::Utilities::w_stream();
+            str << "The text size " << size << " must be equal to the suffix array size " << sar.size() << ".";
+            throw_exception(str);
+        }
+
+        lcp.resize(size);
+
+        if (size == 0U)
+        {
+            return;
+        }
+
+        std::vector<index_t> plcp(size);
+        plcp[static_cast<std::size_t>(sar[0])] = static_cast<index_t>(empty);
+
+        for (std::size_t index = 1; index < size; ++index)
+        {
+            plcp[static_cast<std::size_t>(sar[index])] = sar[index - 1U];
+        }
+
+        for (std::size_t pos{}, matches{}; pos < size; ++pos)
+        {
+            const auto previous = static_cast<std::size_t>(plcp[pos]);
+
+            if (previous == empty)
+            {
+                plcp[pos] = index_t{};
+                matches = 0;
+                continue;
+            }
+
+            while (pos + matches < size && previous + matches < size &&
+                text[pos + matches] == text[previous + matches])
+            {
+                ++matches;
+            }
+
+            plcp[pos] = static_cast<index_t>(matches);
+
+            if (0U < matches)
+            {
+                --matches;
+            }
+        }
+
+        for (std::size_t index{}; index < size; ++index)
+        {
+            lcp[index] = plcp[static_cast<std::size_t>(sar[index])];
+        }
+    }
+} // namespace Standard::Algorithms::Strings
@@ -0,0 +1,72 @@
+#pragma once
+#include<cstddef>
+#include<functional>
+#include<string>
+#include<utility>
+#include<vector>
+
+namespace Standard::Algorithms
+{
+    // The measured body runs once per repetition.
+    using benchmark_body_t = std::function<void()>;
+
+    // The body to measure, and an optional "prepare" to restore the input e.g. copy the unsorted items;
+    // the "prepare" runs before each body run, and is neither timed nor counted.
+    struct benchmark_run final
+    {
+        // NOLINTNEXTLINE
+        benchmark_body_t body{};
+
+        // NOLINTNEXTLINE
+        benchmark_body_t prepare{};
+
+        benchmark_run() = default;
+
+        // Not explicit: a setup might return just the body.
+        // NOLINTNEXTLINE
+        benchmark_run(benchmark_body_t body, benchmark_body_t prepare = {})
+            : body(std::move(body))
+            , prepare(std::move(prepare))
+        {
+        }
+    };
+
+    // Prepare the input of the given size, which is not measured, and return the body to measure.
+    using benchmark_setup_t = std::function<benchmark_run(std::size_t size)>;
+
+    struct benchmark_function final
+    {
+        // NOLINTNEXTLINE
+        std::string name{};
+
+        // NOLINTNEXTLINE
+        benchmark_setup_t setup{};
+
+        // The sweep over the input sizes.
+        // NOLINTNEXTLINE
+        std::vector<std::size_t> sizes{};
+
+        // When not empty, the name of an earlier registered benchmark to compare with on the same size.
+        // NOLINTNEXTLINE
+        std::string baseline{};
+
+        // When positive, a size counts the items of this many bytes each, and the throughput is printed in MB/s.
+        // NOLINTNEXTLINE
+        std::size_t item_bytes{};
+
+#if defined(__clang__) // todo(p3): del unnecessary ctors in C++26
+        constexpr benchmark_function() = default;
+
+        template<class name_t, class baseline_t = std::string>
+        constexpr benchmark_function(name_t &&nam, benchmark_setup_t setup, std::vector<std::size_t> sizes,
+            baseline_t &&baseline = {}, const std::size_t item_bytes = 0)
+            : name(std::forward<name_t>(nam))
+            , setup(std::move(setup))
+            , sizes(std::move(sizes))
+            , baseline(std::forward<baseline_t>(baseline))
+            , item_bytes(item_bytes)
+        {
+        }
+#endif
+    };
+} // namespace Standard::Algorithms
@@ -0,0 +1,105 @@
+#pragma once
+// "benchmark_statistics.h"
+#include"elapsed_time_ns.h"
+#include"require_utilities.h"
+#include<algorithm>
+#include<cmath>
+#include<vector>
+
+namespace Standard::Algorithms
+{
+    struct benchmark_statistics final
+    {
+        // NOLINTNEXTLINE
+        std::size_t count{};
+
+        // NOLINTNEXTLINE
+        ns_elapsed_type min{};
+
+        // NOLINTNEXTLINE
+        ns_elapsed_type max{};
+
+        // NOLINTNEXTLINE
+        ns_elapsed_type median{};
+
+        // Median absolute deviation is a robust dispersion measure.
+        // NOLINTNEXTLINE
+        ns_elapsed_type mad{};
+
+        // The distribution-free 95% confidence interval of the median.
+        // NOLINTNEXTLINE
+        ns_elapsed_type median_low{};
+
+        // NOLINTNEXTLINE
+        ns_elapsed_type median_high{};
+
+        [[nodiscard]] constexpr auto operator<=> (const benchmark_statistics &) const noexcept = default;
+    };
+
+    inline auto operator<< (std::ostream &str, const benchmark_statistics &stats) -> std::ostream &
+    {
+        str << "count " << stats.count << ", min " << stats.min << ", max " << stats.max << ", median "
+            << stats.median << ", MAD " << stats.mad << ", median CI [" << stats.median_low << ", "
+            << stats.median_high << "]";
+
+        return str;
+    }
+} // namespace Standard::Algorithms
+
+namespace Standard::Algorithms::Inner
+{
+    // The "samples" must be sorted.
+    [[nodiscard]] constexpr auto sorted_median(const std::vector<ns_elapsed_type> &samples) -> ns_elapsed_type
+    {
+        assert(!samples.empty() && std::is_sorted(samples.cbegin(), samples.cend()));
+
+        const auto half = samples.size() / 2U;
+
+        auto median = (samples.size() & 1U) != 0U ? samples[half] : (samples[half - 1U] + samples[half]) / 2;
+
+        return median;
+    }
+} // namespace Standard::Algorithms::Inner
+
+namespace Standard::Algorithms
+{
+    // Time O(n*log(n)).
+    [[nodiscard]] constexpr auto compute_benchmark_statistics(std::vector<ns_elapsed_type> samples)
+        -> benchmark_statistics
+    {
+        const auto size = require_positive(samples.size(), "samples size");
+
+        std::sort(samples.begin(), samples.end());
+
+        benchmark_statistics stats{};
+        stats.count = size;
+        stats.min = samples.front();
+        stats.max = samples.back();
+        stats.median = Inner::sorted_median(samples);
+
+        {// The binomial order statistics: the ranks n/2 -+ 1.96*sqrt(n)/2, 1-based.
+            constexpr auto z_95 = 1.96;
+
+            const auto half_width = z_95 * std::sqrt(static_cast<double>(size)) / 2.0;
+            const auto half = static_cast<double>(size) / 2.0;
+
+            const auto low_rank = std::max(1.0, std::floor(half - half_width));
+            const auto high_rank = std::min(static_cast<double>(size), std::ceil(half + 1.0 + half_width));
+
+            stats.median_low = samples[static_cast<std::size_t>(low_rank) - 1U];
+            stats.median_high = samples[static_cast<std::size_t>(high_rank) - 1U];
+        }
+
+        for (auto &sample : samples)
+        {
+            const auto dif = sample - stats.median;
+            sample = dif < 0 ? -dif : dif;
+        }
+
+        std::sort(samples.begin(), samples.end());
+
+        stats.mad = Inner::sorted_median(samples);
+
+        return stats;
+    }
+} // namespace Standard::Algorithms
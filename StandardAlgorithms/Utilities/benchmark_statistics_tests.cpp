@@ -0,0 +1,60 @@
+#include"benchmark_statistics_tests.h"
+#include"benchmark_statistics.h"
+#include"ert.h"
+#include<numeric>
+
+namespace
+{
+    constexpr void one_sample_test()
+    {
+        constexpr Standard::Algorithms::ns_elapsed_type value = 7;
+
+        const auto actual = Standard::Algorithms::compute_benchmark_statistics({ value });
+
+        const Standard::Algorithms::benchmark_statistics expected{ 1U, value, value, value, 0, value, value };
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "one sample");
+    }
+
+    constexpr void many_samples_test()
+    {
+        // Sorted: 1 2 3 4 5 6 7 8 9 100; the outlier 100 must not move the median much.
+        const std::vector<Standard::Algorithms::ns_elapsed_type> samples{// NOLINTNEXTLINE
+            9, 3, 100, 1, 7, 5, 2, 8, 4, 6
+        };
+
+        const auto actual = Standard::Algorithms::compute_benchmark_statistics(samples);
+
+        // Median (5 + 6)/2 = 5 in integers.
+        // Deviations from 5: 4 3 2 1 0 1 2 3 4 95 -> sorted 0 1 1 2 2 3 3 4 4 95 -> MAD (2 + 3)/2 = 2.
+        // The ranks: 10/2 -+ 1.96*sqrt(10)/2 = 5 -+ 3.099 -> floor(1.9) = 1, ceil(9.099) = 10.
+        const Standard::Algorithms::benchmark_statistics expected{// NOLINTNEXTLINE
+            10U, 1, 100, 5, 2, 1, 100
+        };
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "many samples");
+    }
+
+    void large_sample_interval_test()
+    {
+        constexpr auto size = 100;
+
+        std::vector<Standard::Algorithms::ns_elapsed_type> samples(size);
+        std::iota(samples.begin(), samples.end(), 1);
+
+        const auto actual = Standard::Algorithms::compute_benchmark_statistics(samples);
+
+        // The ranks: 50 -+ 1.96*10/2 = 50 -+ 9.8 -> floor(40.2) = 40, ceil(60.8) = 61.
+        ::Standard::Algorithms::ert::are_equal(40, actual.median_low, "median low");
+        ::Standard::Algorithms::ert::are_equal(61, actual.median_high, "median high");
+        ::Standard::Algorithms::ert::are_equal(50, actual.median, "median");
+        ::Standard::Algorithms::ert::are_equal(25, actual.mad, "MAD");
+    }
+} // namespace
+
+void Standard::Algorithms::Utilities::Tests::benchmark_statistics_tests()
+{
+    one_sample_test();
+    many_samples_test();
+    large_sample_interval_test();
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Utilities::Tests
+{
+    void benchmark_statistics_tests();
+}
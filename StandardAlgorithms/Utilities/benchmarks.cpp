@@ -0,0 +1,27 @@
+#include"benchmarks.h"
+#include"../Graphs/add_benchmarks.h"
+#include"../Numbers/add_benchmarks.h"
+#include"../Strings/add_benchmarks.h"
+#include<stdexcept>
+
+[[nodiscard]] auto Standard::Algorithms::gather_all_benchmarks() -> std::vector<benchmark_function>
+{
+    std::vector<benchmark_function> benchmarks;
+
+    Standard::Algorithms::Graphs::Benchmarks::add_benchmarks(benchmarks);
+
+    Standard::Algorithms::Numbers::Benchmarks::add_benchmarks(benchmarks);
+
+    Standard::Algorithms::Strings::Benchmarks::add_benchmarks(benchmarks);
+
+    for (const auto &benchmark : benchmarks)
+    {
+        if (benchmark.name.empty() || !benchmark.setup || benchmark.sizes.empty()) [[unlikely]]
+        {
+            throw std::runtime_error(
+                "The benchmark '" + benchmark.name + "' must have a name, a setup function, and the sizes.");
+        }
+    }
+
+    return benchmarks;
+}
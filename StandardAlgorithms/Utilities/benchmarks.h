@@ -0,0 +1,12 @@
+#pragma once
+// "benchmarks.h"
+#include"benchmark_function.h"
+#include<cstdint>
+
+namespace Standard::Algorithms
+{
+    [[nodiscard]] auto gather_all_benchmarks() -> std::vector<benchmark_function>;
+
+    // Run the benchmarks whose names contain the "filter"; an empty filter matches all.
+    [[nodiscard]] auto run_all_benchmarks(const std::string &filter) -> std::int32_t;
+} // namespace Standard::Algorithms
@@ -0,0 +1,192 @@
+#include"benchmark_statistics.h"
+#include"benchmarks.h"
+#include"console_color.h"
+#include"perf_counters.h"
+#include<iomanip>
+#include<iostream>
+#include<map>
+#include<tuple>
+
+namespace
+{
+    using ns_elapsed_type = Standard::Algorithms::ns_elapsed_type;
+
+    // The warm-up runs fill the caches, and let the CPU frequency settle.
+    constexpr auto warmup_count = 2U;
+
+    constexpr auto min_repetitions = 5U;
+    constexpr auto max_repetitions = 51U;
+
+    // Stop repeating after the min repetitions when the total time exceeds the limit.
+    constexpr ns_elapsed_type max_time_per_size_ns = 2'000'000'000;
+
+    // The counters are averaged over the repetitions.
+    [[nodiscard]] auto measure(const Standard::Algorithms::benchmark_run &run,
+        Standard::Algorithms::perf_counter_values &counter_values) -> std::vector<ns_elapsed_type>
+    {
+        const auto &body = run.body;
+        const auto &prepare = run.prepare;
+
+        for (auto warmup = 0U; warmup < warmup_count; ++warmup)
+        {
+            if (prepare)
+            {
+                prepare();
+            }
+
+            body();
+        }
+
+        std::vector<ns_elapsed_type> samples;
+        samples.reserve(max_repetitions);
+
+        Standard::Algorithms::perf_counters counters{};
+        const Standard::Algorithms::elapsed_time_ns total_time{};
+
+        counters.start();
+
+        do
+        {
+            if (prepare)
+            {
+                counters.stop();
+                prepare();
+                counters.resume();
+            }
+
+            const Standard::Algorithms::elapsed_time_ns tim{};
+            body();
+            samples.push_back(tim.elapsed());
+        } while (samples.size() < max_repetitions &&
+            (samples.size() < min_repetitions || total_time.elapsed() < max_time_per_size_ns));
+
+        counters.stop();
+        counter_values = counters.read();
+
+        for (auto &value : counter_values)
+        {
+            if (value.has_value())
+            {
+                value = value.value() / static_cast<std::int64_t>(samples.size());
+            }
+        }
+
+        return samples;
+    }
+
+    void print_line(const Standard::Algorithms::benchmark_function &benchmark, const std::size_t size,
+        const Standard::Algorithms::benchmark_statistics &stats, const ns_elapsed_type baseline_median)
+    {
+        const auto &baseline = benchmark.baseline;
+
+        std::cout << std::left << std::setw(40) << benchmark.name << std::right << " size " << std::setw(10) << size
+                  << " median " << std::setw(14) << stats.median << " ns, MAD " << std::setw(12) << stats.mad
+                  << ", 95% CI [" << stats.median_low << ", " << stats.median_high << "], runs " << stats.count;
+
+        if (0U < benchmark.item_bytes && 0 < stats.median)
+        {
+            // Bytes per ns are GB/s.
+            constexpr auto mega_per_giga = 1'000.0;
+
+            const auto mb_per_second = static_cast<double>(size * benchmark.item_bytes) /
+                static_cast<double>(stats.median) * mega_per_giga;
+
+            std::cout << ", " << std::setprecision(4) << mb_per_second << " MB/s";
+        }
+
+        if (0 < baseline_median && 0 < stats.median)
+        {
+            const auto speedup = static_cast<double>(baseline_median) / static_cast<double>(stats.median);
+
+            std::cout << ", " << std::setprecision(3) << speedup << " times faster than '" << baseline << "'";
+        }
+
+        std::cout << '\n';
+    }
+
+    void print_counters(const Standard::Algorithms::perf_counter_values &values)
+    {
+        const auto &cycles = values[static_cast<std::size_t>(Standard::Algorithms::perf_counter_kind::cycles)];
+
+        const auto &instructions =
+            values[static_cast<std::size_t>(Standard::Algorithms::perf_counter_kind::instructions)];
+
+        if (std::none_of(values.cbegin(), values.cend(),
+                [] [[nodiscard]] (const auto &value)
+                {
+                    return value.has_value();
+                }))
+        {
+            return;
+        }
+
+        std::cout << "    per run: ";
+        Standard::Algorithms::print_perf_counters(std::cout, values);
+
+        if (cycles.has_value() && instructions.has_value() && 0 < cycles.value())
+        {
+            const auto ipc = static_cast<double>(instructions.value()) / static_cast<double>(cycles.value());
+
+            std::cout << ", instructions per cycle " << std::setprecision(3) << ipc;
+        }
+
+        std::cout << '\n';
+    }
+} // namespace
+
+[[nodiscard]] auto Standard::Algorithms::run_all_benchmarks(const std::string &filter) -> std::int32_t
+{
+    try
+    {
+        const auto benchmarks = gather_all_benchmarks();
+
+        // {name, size} -> median.
+        std::map<std::pair<std::string, std::size_t>, ns_elapsed_type> medians;
+        std::size_t run_count{};
+
+        for (const auto &benchmark : benchmarks)
+        {
+            if (!filter.empty() && benchmark.name.find(filter) == std::string::npos)
+            {
+                continue;
+            }
+
+            ++run_count;
+
+            for (const auto &size : benchmark.sizes)
+            {
+                const auto run = benchmark.setup(size);
+
+                perf_counter_values counter_values{};
+                const auto stats = compute_benchmark_statistics(measure(run, counter_values));
+
+                medians[{ benchmark.name, size }] = stats.median;
+
+                ns_elapsed_type baseline_median{};
+
+                if (!benchmark.baseline.empty())
+                {
+                    if (const auto ite = medians.find({ benchmark.baseline, size }); ite != medians.end())
+                    {
+                        baseline_median = ite->second;
+                    }
+                }
+
+                print_line(benchmark, size, stats, baseline_median);
+                print_counters(counter_values);
+            }
+        }
+
+        std::cout << "Ran " << run_count << " of " << benchmarks.size() << " benchmarks.\n";
+
+        return 0;
+    }
+    catch (const std::exception &exc)
+    {
+        const Standard::Algorithms::Colors::error_color color;
+
+        std::cout << "Benchmarks error: " << exc.what() << '\n';
+
+        return 1;
+    }
+}
@@ -1,4 +1,5 @@
 #pragma once
+#include<cstddef>
 #ifdef _OPENMP
 #include<omp.h>
 #endif
@@ -15,4 +16,23 @@ namespace Standard::Algorithms
     }
 
     [[nodiscard]] auto has_openmp_computer() -> bool;
+
+    [[nodiscard]] inline auto omp_thread_count() noexcept -> std::size_t
+    {
+#ifdef _OPENMP
+        return static_cast<std::size_t>(omp_get_max_threads());
+#else
+        return 1U;
+#endif
+    }
+
+    // Inside a parallel region.
+    [[nodiscard]] inline auto omp_thread_index() noexcept -> std::size_t
+    {
+#ifdef _OPENMP
+        return static_cast<std::size_t>(omp_get_thread_num());
+#else
+        return 0U;
+#endif
+    }
 } // namespace Standard::Algorithms
@@ -0,0 +1,346 @@
+#include"perf_counters.h"
+#include<cassert>
+#include<ostream>
+
+#if defined(__linux__)
+#include<charconv>
+#include<cstring>
+#include<filesystem>
+#include<linux/perf_event.h>
+#include<sys/ioctl.h>
+#include<sys/syscall.h>
+#include<unistd.h>
+#endif
+
+namespace
+{
+    constexpr std::int32_t absent_descriptor = -1;
+
+#if defined(__linux__)
+    // The counters of a group are scheduled on the PMU together, and read at once.
+    // The cycles and instructions might take the fixed counters, the cache misses need the general ones;
+    // two small groups fit more often than a big one e.g. when the NMI watchdog has taken a counter.
+    constexpr std::size_t group_count = 2;
+
+    [[nodiscard]] constexpr auto group_of(const Standard::Algorithms::perf_counter_kind kind) noexcept -> std::size_t
+    {
+        using enum Standard::Algorithms::perf_counter_kind;
+
+        return kind == cycles || kind == instructions || kind == branch_misses ? 0U : 1U;
+    }
+
+    [[nodiscard]] constexpr auto cache_event(const std::uint64_t cache, const std::uint64_t operation,
+        const std::uint64_t result) noexcept -> std::uint64_t
+    {
+        constexpr auto operation_shift = 8U;
+        constexpr auto result_shift = 16U;
+
+        return cache | (operation << operation_shift) | (result << result_shift);
+    }
+
+    [[nodiscard]] constexpr auto to_type_config(const Standard::Algorithms::perf_counter_kind kind) noexcept
+        -> std::pair<std::uint32_t, std::uint64_t>
+    {
+        using enum Standard::Algorithms::perf_counter_kind;
+
+        switch (kind)
+        {
+        case cycles:
+            return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES };
+        case instructions:
+            return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS };
+        case l1d_read_misses:
+            return { PERF_TYPE_HW_CACHE,
+                cache_event(PERF_COUNT_HW_CACHE_L1D, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) };
+        case llc_read_misses:
+            return { PERF_TYPE_HW_CACHE,
+                cache_event(PERF_COUNT_HW_CACHE_LL, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) };
+        case branch_misses:
+            return { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES };
+        case dtlb_read_misses:
+            return { PERF_TYPE_HW_CACHE,
+                cache_event(PERF_COUNT_HW_CACHE_DTLB, PERF_COUNT_HW_CACHE_OP_READ, PERF_COUNT_HW_CACHE_RESULT_MISS) };
+        default:
+            assert(0);
+            return {};
+        }
+    }
+
+    // A group leader starts disabled; the members follow it.
+    [[nodiscard]] auto open_counter(const Standard::Algorithms::perf_counter_kind kind, const pid_t thread_id,
+        const std::int32_t group_descriptor) noexcept -> std::int32_t
+    {
+        perf_event_attr attr{};
+        std::memset(&attr, 0, sizeof(attr));
+
+        attr.size = sizeof(attr);
+
+        const auto [type, config] = to_type_config(kind);
+        attr.type = type;
+        attr.config = config;
+
+        attr.disabled = group_descriptor == absent_descriptor ? 1 : 0;
+        attr.inherit = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+        constexpr std::int32_t any_cpu = -1;
+        constexpr unsigned long no_flags = 0;
+
+        // There is no glibc wrapper.
+        const auto descriptor = syscall(SYS_perf_event_open, &attr, thread_id, any_cpu, group_descriptor, no_flags);
+
+        return descriptor < 0 ? absent_descriptor : static_cast<std::int32_t>(descriptor);
+    }
+
+    // The threads of this process; a thread might exit at any moment.
+    [[nodiscard]] auto process_thread_ids() -> std::vector<pid_t>
+    {
+        std::vector<pid_t> thread_ids;
+        std::error_code err{};
+
+        for (std::filesystem::directory_iterator ite("/proc/self/task", err), end{}; !err && ite != end;
+             ite.increment(err))
+        {
+            const auto name = ite->path().filename().string();
+            const auto *const last = name.data() + name.size();
+
+            if (pid_t thread_id{}; std::from_chars(name.data(), last, thread_id).ptr == last && 0 < thread_id)
+            {
+                thread_ids.push_back(thread_id);
+            }
+        }
+
+        if (thread_ids.empty())
+        {
+            constexpr pid_t this_thread = 0;
+
+            thread_ids.push_back(this_thread);
+        }
+
+        return thread_ids;
+    }
+
+    // The leader is the first opened counter of a group.
+    template<class func_t>
+    void for_each_leader(
+        const std::array<std::int32_t, Standard::Algorithms::perf_counter_count> &descriptors, func_t func)
+    {
+        std::array<bool, group_count> has_leader{};
+
+        for (std::size_t index{}; index < Standard::Algorithms::perf_counter_count; ++index)
+        {
+            const auto &descriptor = descriptors[index];
+            const auto group = group_of(static_cast<Standard::Algorithms::perf_counter_kind>(index));
+
+            if (descriptor == absent_descriptor || has_leader[group])
+            {
+                continue;
+            }
+
+            has_leader[group] = true;
+            func(group, descriptor);
+        }
+    }
+
+    void group_ioctl(const std::vector<std::array<std::int32_t, Standard::Algorithms::perf_counter_count>> &threads,
+        const unsigned long request) noexcept
+    {
+        for (const auto &descriptors : threads)
+        {
+            for_each_leader(descriptors,
+                [request](const std::size_t, const std::int32_t leader)
+                {
+                    ioctl(leader, request, PERF_IOC_FLAG_GROUP);
+                });
+        }
+    }
+#endif
+} // namespace
+
+[[nodiscard]] auto Standard::Algorithms::perf_counter_name(const perf_counter_kind kind) -> const char *
+{
+    using enum perf_counter_kind;
+
+    switch (kind)
+    {
+    case cycles:
+        return "cycles";
+    case instructions:
+        return "instructions";
+    case l1d_read_misses:
+        return "L1D read misses";
+    case llc_read_misses:
+        return "LLC read misses";
+    case branch_misses:
+        return "branch misses";
+    case dtlb_read_misses:
+        return "dTLB read misses";
+    default:
+        return "unknown";
+    }
+}
+
+void Standard::Algorithms::print_perf_counters(std::ostream &str, const perf_counter_values &values)
+{
+    auto is_first = true;
+
+    for (std::size_t index{}; index < perf_counter_count; ++index)
+    {
+        const auto &value = values[index];
+
+        if (!value.has_value())
+        {
+            continue;
+        }
+
+        str << (is_first ? "" : ", ") << perf_counter_name(static_cast<perf_counter_kind>(index)) << " "
+            << value.value();
+
+        is_first = false;
+    }
+
+    if (is_first)
+    {
+        str << "no performance counters";
+    }
+}
+
+Standard::Algorithms::perf_counters::perf_counters()
+{
+#if defined(__linux__)
+    for (const auto &thread_id : process_thread_ids())
+    {
+        std::array<std::int32_t, perf_counter_count> descriptors{};
+        std::array<std::int32_t, group_count> leaders{};
+        leaders.fill(absent_descriptor);
+
+        for (std::size_t index{}; index < perf_counter_count; ++index)
+        {
+            const auto kind = static_cast<perf_counter_kind>(index);
+            auto &leader = leaders[group_of(kind)];
+
+            descriptors[index] = open_counter(kind, thread_id, leader);
+
+            if (leader == absent_descriptor)
+            {
+                leader = descriptors[index];
+            }
+        }
+
+        Descriptors.push_back(descriptors);
+    }
+#endif
+}
+
+Standard::Algorithms::perf_counters::~perf_counters() noexcept
+{
+#if defined(__linux__)
+    for (const auto &descriptors : Descriptors)
+    {
+        for (const auto &descriptor : descriptors)
+        {
+            if (descriptor != absent_descriptor)
+            {
+                close(descriptor);
+            }
+        }
+    }
+#endif
+}
+
+[[nodiscard]] auto Standard::Algorithms::perf_counters::has_any() const &noexcept -> bool
+{
+    for (const auto &descriptors : Descriptors)
+    {
+        for (const auto &descriptor : descriptors)
+        {
+            if (descriptor != absent_descriptor)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+void Standard::Algorithms::perf_counters::start() &noexcept
+{
+#if defined(__linux__)
+    group_ioctl(Descriptors, PERF_EVENT_IOC_RESET);
+    group_ioctl(Descriptors, PERF_EVENT_IOC_ENABLE);
+#endif
+}
+
+void Standard::Algorithms::perf_counters::stop() &noexcept
+{
+#if defined(__linux__)
+    group_ioctl(Descriptors, PERF_EVENT_IOC_DISABLE);
+#endif
+}
+
+void Standard::Algorithms::perf_counters::resume() &noexcept
+{
+#if defined(__linux__)
+    group_ioctl(Descriptors, PERF_EVENT_IOC_ENABLE);
+#endif
+}
+
+[[nodiscard]] auto Standard::Algorithms::perf_counters::read() const & -> perf_counter_values
+{
+    perf_counter_values values{};
+
+#if defined(__linux__)
+    std::array<double, perf_counter_count> sums{};
+
+    for (const auto &descriptors : Descriptors)
+    {
+        for_each_leader(descriptors,
+            [&descriptors, &values, &sums](const std::size_t group, const std::int32_t leader)
+            {
+                constexpr std::size_t header_size = 3;
+
+                // The count, time enabled, time running, and then the values in the opening order.
+                std::array<std::uint64_t, header_size + perf_counter_count> data{};
+
+                const auto size = ::read(leader, data.data(), sizeof(data));
+                const auto words = size < 0 ? std::size_t{} : static_cast<std::size_t>(size) / sizeof(std::uint64_t);
+
+                if (words < header_size || data[2] == 0U || words < header_size + data[0])
+                {// Never scheduled on a PMU.
+                    return;
+                }
+
+                const auto scale =
+                    data[1] == data[2] ? 1.0 : static_cast<double>(data[1]) / static_cast<double>(data[2]);
+
+                auto position = header_size;
+
+                for (std::size_t index{}; index < perf_counter_count; ++index)
+                {
+                    if (descriptors[index] == absent_descriptor ||
+                        group_of(static_cast<perf_counter_kind>(index)) != group)
+                    {
+                        continue;
+                    }
+
+                    sums[index] += static_cast<double>(data[position]) * scale;
+                    values[index] = 0;
+                    ++position;
+                }
+            });
+    }
+
+    for (std::size_t index{}; index < perf_counter_count; ++index)
+    {
+        if (values[index].has_value())
+        {
+            values[index] = static_cast<std::int64_t>(sums[index]);
+        }
+    }
+#endif
+
+    return values;
+}
@@ -0,0 +1,70 @@
+#pragma once
+// "perf_counters.h"
+#include<array>
+#include<cstddef>
+#include<cstdint>
+#include<iosfwd>
+#include<optional>
+#include<vector>
+
+namespace Standard::Algorithms
+{
+    enum class [[nodiscard]] perf_counter_kind : std::uint8_t
+    {
+        cycles,
+        instructions,
+        l1d_read_misses,
+        llc_read_misses,
+        branch_misses,
+        dtlb_read_misses,
+        // Not a counter.
+        count,
+    };
+
+    constexpr auto perf_counter_count = static_cast<std::size_t>(perf_counter_kind::count);
+
+    [[nodiscard]] auto perf_counter_name(perf_counter_kind kind) -> const char *;
+
+    // A missing value means that the counter is not available.
+    using perf_counter_values = std::array<std::optional<std::int64_t>, perf_counter_count>;
+
+    // Print the available values only.
+    void print_perf_counters(std::ostream &str, const perf_counter_values &values);
+
+    // Hardware performance counters of the whole process: every thread existing at the construction,
+    // e.g. an OpenMP pool, and the threads they create later.
+    // The other work running in the process is counted too, so measure one thing at a time.
+    // On Linux, perf_event_open is used per thread; the user space events only.
+    // The counters form 2 groups, see "group_of"; the values of a thread are summed after the multiplexing scaling.
+    // When the counters are not supported or not permitted e.g. by "/proc/sys/kernel/perf_event_paranoid",
+    // all the values are missing, and the measured code runs as usual.
+    // Usage: create, start, run the measured code, stop, read.
+    struct perf_counters final
+    {
+        perf_counters();
+
+        perf_counters(const perf_counters &) = delete;
+        auto operator= (const perf_counters &) & -> perf_counters & = delete;
+        perf_counters(perf_counters &&) noexcept = delete;
+        auto operator= (perf_counters &&) &noexcept -> perf_counters & = delete;
+
+        ~perf_counters() noexcept;
+
+        [[nodiscard]] auto has_any() const &noexcept -> bool;
+
+        // Reset to zero and enable.
+        void start() &noexcept;
+
+        void stop() &noexcept;
+
+        // Enable again after "stop" without a reset to exclude e.g. a preparation from the counted values.
+        void resume() &noexcept;
+
+        // When the kernel multiplexes the counters, the values are scaled.
+        [[nodiscard]] auto read() const & -> perf_counter_values;
+
+private:
+        // Per thread; -1 for a not available counter.
+        std::vector<std::array<std::int32_t, perf_counter_count>> Descriptors{};
+    };
+} // namespace Standard::Algorithms
@@ -0,0 +1,128 @@
+#include"perf_counters_tests.h"
+#include"ert.h"
+#include"perf_counters.h"
+#include<semaphore>
+#include<sstream>
+#include<thread>
+
+namespace
+{
+    [[nodiscard]] auto busy_sum(const std::int64_t count) -> std::int64_t
+    {
+        volatile std::int64_t sum{};
+
+        for (std::int64_t index{}; index < count; ++index)
+        {
+            sum = sum + index;
+        }
+
+        return sum;
+    }
+
+    [[nodiscard]] constexpr auto instructions_of(const Standard::Algorithms::perf_counter_values &values)
+        -> const std::optional<std::int64_t> &
+    {
+        return values[static_cast<std::size_t>(Standard::Algorithms::perf_counter_kind::instructions)];
+    }
+
+    [[nodiscard]] auto count_instructions(const std::int64_t count) -> std::optional<std::int64_t>
+    {
+        Standard::Algorithms::perf_counters counters{};
+
+        counters.start();
+        const auto sum = busy_sum(count);
+        counters.stop();
+
+        ::Standard::Algorithms::ert::are_equal(count * (count - 1) / 2, sum, "busy sum");
+
+        return instructions_of(counters.read());
+    }
+
+    void availability_tests()
+    {
+        constexpr std::int64_t count = 100'000;
+
+        Standard::Algorithms::perf_counters counters{};
+
+        counters.start();
+        const auto sum = busy_sum(count);
+        counters.stop();
+
+        ::Standard::Algorithms::ert::are_equal(count * (count - 1) / 2, sum, "busy sum");
+
+        const auto values = counters.read();
+
+        // Counters might be not available e.g. in a virtual machine.
+        if (!counters.has_any())
+        {
+            for (const auto &value : values)
+            {
+                ::Standard::Algorithms::ert::are_equal(false, value.has_value(), "no counter value");
+            }
+        }
+
+        std::ostringstream str;
+        Standard::Algorithms::print_perf_counters(str, values);
+
+        ::Standard::Algorithms::ert::are_equal(false, str.str().empty(), "printed counters");
+    }
+
+    // A loop iteration has at least 1 instruction; the other threads of the process add some noise.
+    void loop_length_tests()
+    {
+        constexpr std::int64_t short_count = 1'000'000;
+        constexpr std::int64_t long_count = short_count * 8;
+
+        const auto short_instructions = count_instructions(short_count);
+        const auto long_instructions = count_instructions(long_count);
+
+        if (!short_instructions.has_value() || !long_instructions.has_value())
+        {
+            return;
+        }
+
+        Standard::Algorithms::require_less_equal(short_count, short_instructions.value(), "short loop instructions");
+
+        Standard::Algorithms::require_less_equal(long_count, long_instructions.value(), "long loop instructions");
+
+        Standard::Algorithms::require_greater(
+            long_instructions.value(), short_instructions.value() * 2, "long loop versus short loop instructions");
+    }
+
+    // A thread, started before the counters, is counted too.
+    void existing_thread_tests()
+    {
+        constexpr std::int64_t count = 1'000'000;
+
+        std::binary_semaphore go{ 0 };
+        std::int64_t sum{};
+
+        std::thread worker(
+            [&go, &sum]
+            {
+                go.acquire();
+                sum = busy_sum(count);
+            });
+
+        Standard::Algorithms::perf_counters counters{};
+
+        counters.start();
+        go.release();
+        worker.join();
+        counters.stop();
+
+        ::Standard::Algorithms::ert::are_equal(count * (count - 1) / 2, sum, "worker busy sum");
+
+        if (const auto instructions = instructions_of(counters.read()); instructions.has_value())
+        {
+            Standard::Algorithms::require_less_equal(count, instructions.value(), "worker thread instructions");
+        }
+    }
+} // namespace
+
+void Standard::Algorithms::Utilities::Tests::perf_counters_tests()
+{
+    availability_tests();
+    loop_length_tests();
+    existing_thread_tests();
+}
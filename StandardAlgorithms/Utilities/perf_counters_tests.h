@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Utilities::Tests
+{
+    void perf_counters_tests();
+}
@@ -0,0 +1,85 @@
+#include"resource_usage.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include<sys/resource.h>
+#include<time.h>
+#elif defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include<windows.h>
+// Must follow windows.h.
+#include<psapi.h>
+#endif
+
+[[nodiscard]] auto Standard::Algorithms::Utilities::thread_cpu_time_ns() noexcept -> std::int64_t
+{
+#if defined(__unix__) || defined(__APPLE__)
+    constexpr std::int64_t ns_in_second = 1'000'000'000;
+
+    timespec spec{};
+
+    if (0 != clock_gettime(CLOCK_THREAD_CPUTIME_ID, &spec))
+    {
+        return 0;
+    }
+
+    return static_cast<std::int64_t>(spec.tv_sec) * ns_in_second + static_cast<std::int64_t>(spec.tv_nsec);
+#elif defined(_WIN32)
+    FILETIME creation{};
+    FILETIME ext{};
+    FILETIME kernel{};
+    FILETIME user{};
+
+    if (0 == GetThreadTimes(GetCurrentThread(), &creation, &ext, &kernel, &user))
+    {
+        return 0;
+    }
+
+    constexpr std::int64_t ns_in_tick = 100;
+    constexpr auto dword_bits = 32U;
+
+    const auto to_ticks = [] [[nodiscard]] (const FILETIME &time) noexcept
+    {
+        return static_cast<std::int64_t>((static_cast<std::uint64_t>(time.dwHighDateTime) << dword_bits) |
+            static_cast<std::uint64_t>(time.dwLowDateTime));
+    };
+
+    return (to_ticks(kernel) + to_ticks(user)) * ns_in_tick;
+#else
+    return 0;
+#endif
+}
+
+[[nodiscard]] auto Standard::Algorithms::Utilities::peak_resident_set_kb() noexcept -> std::int64_t
+{
+#if defined(__unix__) || defined(__APPLE__)
+    rusage usage{};
+
+    if (0 != getrusage(RUSAGE_SELF, &usage))
+    {
+        return 0;
+    }
+
+#if defined(__APPLE__)
+    constexpr std::int64_t bytes_in_kb = 1'024;
+
+    return static_cast<std::int64_t>(usage.ru_maxrss) / bytes_in_kb; // Bytes on macOS.
+#else
+    return static_cast<std::int64_t>(usage.ru_maxrss);
+#endif
+#elif defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters{};
+
+    if (0 == K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+    {
+        return 0;
+    }
+
+    constexpr std::int64_t bytes_in_kb = 1'024;
+
+    return static_cast<std::int64_t>(counters.PeakWorkingSetSize) / bytes_in_kb;
+#else
+    return 0;
+#endif
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include<cstdint>
+
+namespace Standard::Algorithms::Utilities
+{
+    // The CPU time consumed by the calling thread in nanoseconds, or 0 when not available.
+    [[nodiscard]] auto thread_cpu_time_ns() noexcept -> std::int64_t;
+
+    // The peak resident set size of the process in kilobytes, or 0 when not available.
+    [[nodiscard]] auto peak_resident_set_kb() noexcept -> std::int64_t;
+} // namespace Standard::Algorithms::Utilities
@@ -3,8 +3,11 @@
 #include"require_utilities.h"
 #include"run_result_kind.h"
 #include"run_result_utilities.h"
-#include<atomic>
+#include<algorithm>
+#include<cstdint>
+#include<deque>
 #include<mutex>
+#include<numeric>
 #include<new> // std::hardware_destructive_interference_size
 #include<semaphore>
 #include<thread>
@@ -25,23 +28,51 @@ namespace Standard::Algorithms::Utilities
 
         using result_vector_t = std::vector<std::tuple<std::size_t, run_result_kind, std::string>>;
 
+        using cost_t = std::int64_t;
+
         // There must be at least one item in "functions".
+        // The errors are returned sorted by the function index.
         [[nodiscard]] static constexpr auto execute(std::counting_semaphore<> *sem, std::size_t cpu_count,
             bool &has_unknown_error, const std::vector<function_t> &functions, arguments_t... arguments)
             -> result_vector_t
+        {
+            const std::vector<cost_t> no_costs{};
+
+            auto result = execute_by_costs(sem, cpu_count, has_unknown_error, functions, no_costs,
+                // no std::forward<arguments_t>(arguments)...
+                arguments...);
+
+            return result;
+        }
+
+        // The "costs", if not empty, must be of the same size as "functions".
+        // A cost is an estimation e.g. the past duration; the costlier functions are started first.
+        // When running in parallel, each thread has its own deque of tasks;
+        // an idle thread steals a task from the back of another thread's deque.
+        [[nodiscard]] static constexpr auto execute_by_costs(std::counting_semaphore<> *sem, std::size_t cpu_count,
+            bool &has_unknown_error, const std::vector<function_t> &functions, const std::vector<cost_t> &costs,
+            arguments_t... arguments) -> result_vector_t
         {
             throw_if_empty("functions", functions);
 
             const auto size = functions.size();
-            const auto actual_core_count = compute_core_count(size, cpu_count);
 
-            // NOLINTNEXTLINE
-            const auto is_single = actual_core_count <= single_core || true; // todo(p2): fix
+            if (!costs.empty() && costs.size() != size) [[unlikely]]
+            {
+                auto err = "The costs size (" + std::to_string(costs.size()) + ") must be either 0 or " +
+                    std::to_string(size) + ".";
+
+                throw std::out_of_range(err);
+            }
+
+            const auto actual_core_count = compute_core_count(size, cpu_count);
+            const auto is_single = actual_core_count <= single_core;
 
             auto result = is_single ? launch_sequential(sem, has_unknown_error, functions,
                                           // no std::forward<arguments_t>(arguments)...
                                           arguments...)
                                     : launch_in_parallel(sem, actual_core_count, has_unknown_error, functions,
+                                          costs,
                                           // no std::forward<arguments_t>(arguments)...
                                           arguments...);
 
@@ -49,17 +80,30 @@ namespace Standard::Algorithms::Utilities
         }
 
 private:
-        struct alignas( // False sharing is bad.
+        static constexpr std::size_t cache_line_size =
 #if defined(__cpp_lib_hardware_interference_size)
-            std::hardware_destructive_interference_size
+            std::hardware_destructive_interference_size;
 #else // NOLINTNEXTLINE
-            64
+            64;
 #endif
-            ) run_context final
+
+        // The task indexes of one thread.
+        struct alignas(cache_line_size) // False sharing is bad.
+            work_deque final
+        {
+            // NOLINTNEXTLINE
+            std::mutex mutex{};
+
+            // NOLINTNEXTLINE
+            std::deque<std::size_t> indexes{};
+        };
+
+        struct alignas(cache_line_size) run_context final
         {
             constexpr run_context(std::counting_semaphore<> *sem, const std::size_t cpu_count, bool &has_unknown_error)
                 : Semaphore(sem)
                 , Has_unknown_error(has_unknown_error)
+                , Deques(std::vector<work_deque>(cpu_count))
                 , Threads(std::vector<std::jthread>(cpu_count))
             {
             }
@@ -91,9 +135,9 @@ private:
                 return Semaphore;
             }
 
-            [[nodiscard]] constexpr auto atomic_counter() &noexcept -> std::atomic<std::size_t> &
+            [[nodiscard]] constexpr auto deques() &noexcept -> std::vector<work_deque> &
             {
-                return Atomic_counter;
+                return Deques;
             }
 
             [[nodiscard]] constexpr auto mutex() &noexcept -> std::mutex &
@@ -101,12 +145,43 @@ private:
                 return Mutex;
             }
 
-            [[nodiscard]] constexpr auto has_jobs(const std::size_t total_count) const noexcept -> bool
+            // The owner takes the costliest task from the front of its own deque.
+            [[nodiscard]] constexpr auto try_pop(const std::size_t owner, std::size_t &index) -> bool
+            {
+                auto &deq = Deques.at(owner);
+                const std::lock_guard lock(deq.mutex);
+
+                if (deq.indexes.empty())
+                {
+                    return false;
+                }
+
+                index = deq.indexes.front();
+                deq.indexes.pop_front();
+                return true;
+            }
+
+            // A thief takes the cheapest task from the back of a victim deque.
+            [[nodiscard]] constexpr auto try_steal(const std::size_t thief, std::size_t &index) -> bool
             {
-                assert(0U < total_count);
+                const auto count = Deques.size();
+
+                for (std::size_t shift = 1; shift < count; ++shift)
+                {
+                    auto &deq = Deques[(thief + shift) % count];
+                    const std::lock_guard lock(deq.mutex);
+
+                    if (deq.indexes.empty())
+                    {
+                        continue;
+                    }
 
-                const auto cur = static_cast<std::size_t>(Atomic_counter);
-                return cur < total_count;
+                    index = deq.indexes.back();
+                    deq.indexes.pop_back();
+                    return true;
+                }
+
+                return false;
             }
 
             constexpr void join_threads() noexcept
@@ -128,7 +203,7 @@ private:
             bool &Has_unknown_error;
 
             // One thread can run several tasks.
-            std::atomic<std::size_t> Atomic_counter{};
+            std::vector<work_deque> Deques;
 
             // To lock on task reports.
             std::mutex Mutex{};
@@ -174,9 +249,30 @@ private:
             return result;
         }
 
+        // Longest processing time first: sort by cost descending, keep the original order on ties.
+        [[nodiscard]] static constexpr auto order_by_costs(const std::size_t size, const std::vector<cost_t> &costs)
+            -> std::vector<std::size_t>
+        {
+            std::vector<std::size_t> order(size);
+            std::iota(order.begin(), order.end(), std::size_t{});
+
+            if (!costs.empty())
+            {
+                assert(costs.size() == size);
+
+                std::stable_sort(order.begin(), order.end(),
+                    [&costs] [[nodiscard]] (const std::size_t one, const std::size_t two)
+                    {
+                        return costs[two] < costs[one];
+                    });
+            }
+
+            return order;
+        }
+
         [[nodiscard]] static constexpr auto launch_in_parallel(std::counting_semaphore<> *sem,
             const std::size_t cpu_count, bool &has_unknown_error, const std::vector<function_t> &functions,
-            arguments_t... arguments) -> result_vector_t
+            const std::vector<cost_t> &costs, arguments_t... arguments) -> result_vector_t
         {
             if (cpu_count < 2U) [[unlikely]]
             {
@@ -186,11 +282,21 @@ private:
             }
 
             run_context context(sem, cpu_count, has_unknown_error);
+            {
+                const auto order = order_by_costs(functions.size(), costs);
+
+                // Round-robin dealing keeps every deque sorted by cost descending.
+                for (std::size_t pos{}; pos < order.size(); ++pos)
+                {
+                    context.deques()[pos % cpu_count].indexes.push_back(order[pos]);
+                }
+            }
+
             auto debt = false;
 
             try
             {
-                for (std::size_t index{}; index < cpu_count && context.has_jobs(functions.size()); ++index)
+                for (std::size_t index{}; index < cpu_count; ++index)
                 {
                     if (sem != nullptr)
                     {
@@ -200,7 +306,7 @@ private:
 
                     context.threads()[index] = std::jthread(
                         // Use pointers for a thread function.
-                        &run_in_thread, &context, &functions,
+                        &run_in_thread, &context, index, &functions,
                         // no std::forward<arguments_t>(arguments)...
                         arguments...);
 
@@ -209,7 +315,8 @@ private:
             }
             catch (...)
             {
-                has_unknown_error = true;
+                // The started threads might be setting the flag too.
+                unknown_error_safe(context);
 
                 if (sem != nullptr && debt)
                 {
@@ -219,7 +326,16 @@ private:
 
             context.join_threads();
 
-            return context.result();
+            auto &result = context.result();
+
+            // The same order as in the sequential run.
+            std::sort(result.begin(), result.end(),
+                [] [[nodiscard]] (const auto &one, const auto &two)
+                {
+                    return std::get<0>(one) < std::get<0>(two);
+                });
+
+            return std::move(result);
         }
 
         static constexpr void run_function(bool &has_unknown_error, const std::size_t index, std::mutex *ptr_mutex,
@@ -229,24 +345,30 @@ private:
                 // no std::forward<arguments_t>(arguments)...
                 arguments...);
 
-            if (run_result_utilities::has_error_uncaught(run_result.first))
+            const auto is_uncaught = run_result_utilities::has_error_uncaught(run_result.first);
+            const auto is_error = run_result_utilities::has_error(run_result.first);
+
+            if (!is_uncaught && !is_error)
             {
-                has_unknown_error = true;
+                return;
             }
 
-            if (run_result_utilities::has_error(run_result.first))
+            // Both the flag and the result are shared by the worker threads.
+            std::unique_lock<std::mutex> lock;
+
+            if (nullptr != ptr_mutex)
             {
-                if (nullptr == ptr_mutex)
-                {
-                    result.emplace_back(index, run_result.first, run_result.second);
-                }
-                else
-                {
-                    const std::lock_guard lock(*ptr_mutex);
+                lock = std::unique_lock<std::mutex>(*ptr_mutex);
+            }
 
-                    // todo(p3): del copy-paste.
-                    result.emplace_back(index, run_result.first, run_result.second);
-                }
+            if (is_uncaught)
+            {
+                has_unknown_error = true;
+            }
+
+            if (is_error)
+            {
+                result.emplace_back(index, run_result.first, run_result.second);
             }
         }
 
@@ -254,6 +376,8 @@ private:
         {
             try
             {
+                const std::lock_guard lock(context.mutex());
+
                 context.has_unknown_error() = true;
             }
             // todo(p3): log n catch (const std::exception &exc)
@@ -262,7 +386,7 @@ private:
             }
         }
 
-        static constexpr void run_in_thread(run_context *ptr_run_context,
+        static constexpr void run_in_thread(run_context *ptr_run_context, const std::size_t owner,
             // Use pointers to be called from a thread.
             const std::vector<function_t> *ptr_functions, arguments_t... arguments) noexcept
         {
@@ -286,7 +410,7 @@ private:
 
             try
             {
-                execute_function_cycle_unsafe(ptr_run_context, *ptr_functions,
+                execute_function_cycle_unsafe(ptr_run_context, owner, *ptr_functions,
                     // no std::forward<arguments_t>(arguments)...);
                     arguments...);
             }
@@ -310,29 +434,19 @@ private:
             }
         }
 
-        static constexpr void execute_function_cycle_unsafe(
-            run_context *const ptr_run_context, const std::vector<function_t> &functions, arguments_t... arguments)
+        static constexpr void execute_function_cycle_unsafe(run_context *const ptr_run_context, const std::size_t owner,
+            const std::vector<function_t> &functions, arguments_t... arguments)
         {
-            const auto size = functions.size();
+            [[maybe_unused]] const auto size = functions.size();
+            std::size_t index{};
 
-            for (;;)
+            // No task is added after the start - all deques are empty when there is nothing to steal.
+            while (ptr_run_context->try_pop(owner, index) || ptr_run_context->try_steal(owner, index))
             {
-                std::size_t counter_old = ptr_run_context->atomic_counter();
-
-                if (size <= counter_old)
-                {// All tasks have been taken.
-                    break;
-                }
-
-                const auto counter_new = counter_old + 1U;
-
-                if (!(ptr_run_context->atomic_counter().compare_exchange_strong(counter_old, counter_new)))
-                {// Should retry to take a task.
-                    continue;
-                }
+                assert(index < size);
 
-                run_function(ptr_run_context->has_unknown_error(), counter_old, &(ptr_run_context->mutex()),
-                    ptr_run_context->result(), functions[counter_old],
+                run_function(ptr_run_context->has_unknown_error(), index, &(ptr_run_context->mutex()),
+                    ptr_run_context->result(), functions[index],
                     // no std::forward<arguments_t>(arguments)...);
                     arguments...);
             }
@@ -4,6 +4,7 @@
 #include"is_debug.h"
 #include"launch_exception.h"
 #include"require_utilities.h"
+#include"resource_usage.h"
 #include<cmath>
 #include<iomanip>
 #include<iostream>
@@ -62,6 +63,8 @@ void Standard::Algorithms::Utilities::test_named_functor::operator() (
     std::string error_message;
     std::int64_t elapsed_ns{};
 
+    const auto rss_start_kb = peak_resident_set_kb();
+    const auto cpu_start_ns = thread_cpu_time_ns();
     const elapsed_time_ns clo{};
 
     try
@@ -83,6 +86,14 @@ void Standard::Algorithms::Utilities::test_named_functor::operator() (
         std::cout << "The test '" << name() << "' has failed:\n" << error_message << '\n';
     }
 
+    {
+        test_timing timing{ name(), elapsed_ns, thread_cpu_time_ns() - cpu_start_ns,
+            peak_resident_set_kb() - rss_start_kb };
+
+        const lock_t add_lock(context->console_mutex);
+        context->timings.push_back(std::move(timing));
+    }
+
     // NOLINTNEXTLINE
     constexpr auto max_duration_ns = 1'000'000 * (::Standard::Algorithms::is_debug ? 50 : 5);
     static_assert(0 < max_duration_ns);
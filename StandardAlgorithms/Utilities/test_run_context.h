@@ -1,4 +1,5 @@
 #pragma once
+#include"test_timing.h"
 #include<atomic>
 #include<cstddef>
 #include<mutex>
@@ -15,5 +16,8 @@ namespace Standard::Algorithms::Tests
 
         std::atomic<std::size_t> long_runing_tests{};
         bool shall_print_line{};
+
+        // Each finished test adds its timing.
+        Utilities::test_timings_t timings{};
     };
 } // namespace Standard::Algorithms::Tests
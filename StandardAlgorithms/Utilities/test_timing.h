@@ -0,0 +1,33 @@
+#pragma once
+#include<cstdint>
+#include<iosfwd>
+#include<string>
+#include<vector>
+
+namespace Standard::Algorithms::Utilities
+{
+    // The resources spent by one test.
+    struct test_timing final
+    {
+        // NOLINTNEXTLINE
+        std::string name{};
+
+        // NOLINTNEXTLINE
+        std::int64_t wall_ns{};
+
+        // The CPU time of the thread, which has run the test.
+        // NOLINTNEXTLINE
+        std::int64_t cpu_ns{};
+
+        // The process peak resident set size growth in kilobytes.
+        // When the tests run in parallel, another test might have caused the growth.
+        // NOLINTNEXTLINE
+        std::int64_t peak_rss_delta_kb{};
+
+        [[nodiscard]] constexpr auto operator<=> (const test_timing &) const noexcept = default;
+    };
+
+    auto operator<< (std::ostream &str, const test_timing &timing) -> std::ostream &;
+
+    using test_timings_t = std::vector<test_timing>;
+} // namespace Standard::Algorithms::Utilities
@@ -0,0 +1,292 @@
+#include"test_timing_database.h"
+#include<algorithm>
+#include<charconv>
+#include<filesystem>
+#include<fstream>
+#include<iomanip>
+#include<istream>
+#include<ostream>
+#include<stdexcept>
+#include<system_error>
+#include<unordered_map>
+
+namespace
+{
+    using test_timing = Standard::Algorithms::Utilities::test_timing;
+    using test_timings_t = Standard::Algorithms::Utilities::test_timings_t;
+
+    constexpr auto header = "wall_ns,cpu_ns,peak_rss_delta_kb,name";
+    constexpr auto separator = ',';
+
+    constexpr std::int64_t ns_in_millisecond = 1'000'000;
+
+    // Parse a number, which must end at a separator; return the position after the separator.
+    [[nodiscard]] auto parse_field(const std::string &line, const std::size_t line_number, const std::size_t start,
+        std::int64_t &value) -> std::size_t
+    {
+        const auto stop = line.find(separator, start);
+        const auto *const first = line.data() + start;
+        const auto *const last = line.data() + (stop == std::string::npos ? line.size() : stop);
+
+        if (const auto [ptr, err] = std::from_chars(first, last, value);
+            stop == std::string::npos || err != std::errc{} || ptr != last) [[unlikely]]
+        {
+            throw std::runtime_error(
+                "Cannot parse the test timings line " + std::to_string(line_number) + " '" + line + "'.");
+        }
+
+        return stop + 1U;
+    }
+
+    // Only the separators are removed; the name is kept as is, spaces included.
+    [[nodiscard]] auto parse_line(const std::string &line, const std::size_t line_number) -> test_timing
+    {
+        test_timing timing{};
+
+        auto start = parse_field(line, line_number, 0, timing.wall_ns);
+        start = parse_field(line, line_number, start, timing.cpu_ns);
+        start = parse_field(line, line_number, start, timing.peak_rss_delta_kb);
+
+        timing.name = line.substr(start);
+
+        if (timing.name.empty()) [[unlikely]]
+        {
+            throw std::runtime_error("The test name is empty at the timings line " + std::to_string(line_number) + ".");
+        }
+
+        return timing;
+    }
+
+    [[nodiscard]] auto to_timing_map(const test_timings_t &timings)
+        -> std::unordered_map<std::string, const test_timing *>
+    {
+        std::unordered_map<std::string, const test_timing *> result;
+        result.reserve(timings.size());
+
+        for (const auto &timing : timings)
+        {
+            result[timing.name] = &timing;
+        }
+
+        return result;
+    }
+
+    [[nodiscard]] constexpr auto has_grown(const std::int64_t previous_ns, const std::int64_t current_ns,
+        const double max_ratio, const std::int64_t min_delta_ns) noexcept -> bool
+    {
+        const auto delta = current_ns - previous_ns;
+
+        return min_delta_ns <= delta &&
+            static_cast<double>(previous_ns) * max_ratio < static_cast<double>(current_ns);
+    }
+
+    void print_milliseconds(std::ostream &str, const std::int64_t nanoseconds)
+    {
+        const auto millis = static_cast<double>(nanoseconds) / static_cast<double>(ns_in_millisecond);
+
+        str << std::fixed << std::setprecision(3) << millis << std::defaultfloat << " ms";
+    }
+} // namespace
+
+auto Standard::Algorithms::Utilities::operator<< (std::ostream &str, const test_timing &timing) -> std::ostream &
+{
+    str << "Test '" << timing.name << "', wall " << timing.wall_ns << " ns, CPU " << timing.cpu_ns
+        << " ns, peak RSS delta " << timing.peak_rss_delta_kb << " KB";
+
+    return str;
+}
+
+auto Standard::Algorithms::Utilities::operator<< (std::ostream &str, const test_time_regression &regression)
+    -> std::ostream &
+{
+    str << "Test '" << regression.name << "', previous wall " << regression.previous_wall_ns << " ns, CPU "
+        << regression.previous_cpu_ns << " ns, current wall " << regression.current_wall_ns << " ns, CPU "
+        << regression.current_cpu_ns << " ns";
+
+    return str;
+}
+
+void Standard::Algorithms::Utilities::write_test_timings(std::ostream &str, const test_timings_t &timings)
+{
+    str << header << '\n';
+
+    for (const auto &timing : timings)
+    {
+        if (timing.name.find('\n') != std::string::npos) [[unlikely]]
+        {
+            throw std::runtime_error("The test name '" + timing.name + "' must not have a new line.");
+        }
+
+        str << timing.wall_ns << separator << timing.cpu_ns << separator << timing.peak_rss_delta_kb << separator
+            << timing.name << '\n';
+    }
+}
+
+[[nodiscard]] auto Standard::Algorithms::Utilities::read_test_timings(std::istream &str) -> test_timings_t
+{
+    test_timings_t timings;
+    std::string line;
+
+    if (!std::getline(str, line))
+    {
+        return timings;
+    }
+
+    if (line != header) [[unlikely]]
+    {
+        throw std::runtime_error("The test timings header must be '" + std::string(header) + "'.");
+    }
+
+    for (std::size_t line_number = 2; std::getline(str, line); ++line_number)
+    {
+        if (!line.empty())
+        {
+            timings.push_back(parse_line(line, line_number));
+        }
+    }
+
+    return timings;
+}
+
+[[nodiscard]] auto Standard::Algorithms::Utilities::load_test_timings(const std::string &file_name) -> test_timings_t
+{
+    std::ifstream file(file_name);
+
+    if (!file.is_open())
+    {
+        return {};
+    }
+
+    auto timings = read_test_timings(file);
+    return timings;
+}
+
+void Standard::Algorithms::Utilities::save_test_timings(const std::string &file_name, const test_timings_t &timings)
+{
+    // A crash while writing must not corrupt the previous file:
+    // write a temporary file, then rename it over the old one.
+    const auto temp_name = file_name + ".tmp";
+
+    {
+        std::ofstream file(temp_name, std::ios::trunc);
+
+        if (!file.is_open()) [[unlikely]]
+        {
+            throw std::runtime_error("Cannot open the test timings file '" + temp_name + "' for writing.");
+        }
+
+        write_test_timings(file, timings);
+        file.flush();
+
+        if (!file) [[unlikely]]
+        {
+            throw std::runtime_error("Cannot write the test timings file '" + temp_name + "'.");
+        }
+    }
+
+    std::error_code err{};
+    std::filesystem::rename(temp_name, file_name, err);
+
+    if (err) [[unlikely]]
+    {
+        std::filesystem::remove(temp_name, err);
+
+        throw std::runtime_error("Cannot rename the test timings file '" + temp_name + "' to '" + file_name + "'.");
+    }
+}
+
+[[nodiscard]] auto Standard::Algorithms::Utilities::find_time_regressions(const test_timings_t &previous,
+    const test_timings_t &current, const double max_ratio, const std::int64_t min_delta_ns)
+    -> std::vector<test_time_regression>
+{
+    if (!(1.0 <= max_ratio)) [[unlikely]]
+    {
+        throw std::out_of_range("The max ratio (" + std::to_string(max_ratio) + ") must be at least 1.");
+    }
+
+    const auto previous_timings = to_timing_map(previous);
+    std::vector<test_time_regression> regressions;
+
+    for (const auto &timing : current)
+    {
+        const auto ite = previous_timings.find(timing.name);
+        if (ite == previous_timings.end())
+        {
+            continue;
+        }
+
+        const auto &old = *(ite->second);
+
+        if (!has_grown(old.wall_ns, timing.wall_ns, max_ratio, min_delta_ns) &&
+            !has_grown(old.cpu_ns, timing.cpu_ns, max_ratio, min_delta_ns))
+        {
+            continue;
+        }
+
+        regressions.push_back({ timing.name, old.wall_ns, timing.wall_ns, old.cpu_ns, timing.cpu_ns });
+    }
+
+    std::sort(regressions.begin(), regressions.end());
+
+    return regressions;
+}
+
+auto Standard::Algorithms::Utilities::print_test_timings_report(std::ostream &str, const test_timings_t &previous,
+    const test_timings_t &current, const std::size_t top_count) -> std::size_t
+{
+    {
+        auto slowest = current;
+
+        std::sort(slowest.begin(), slowest.end(),
+            [] [[nodiscard]] (const auto &one, const auto &two)
+            {
+                return two.wall_ns < one.wall_ns || (two.wall_ns == one.wall_ns && one.name < two.name);
+            });
+
+        slowest.resize(std::min(slowest.size(), top_count));
+
+        str << "\nThe " << slowest.size() << " slowest tests of " << current.size() << ":\n";
+
+        for (std::size_t index{}; const auto &timing : slowest)
+        {
+            str << ++index << ". '" << timing.name << "' wall ";
+            print_milliseconds(str, timing.wall_ns);
+            str << ", CPU ";
+            print_milliseconds(str, timing.cpu_ns);
+            str << ", peak RSS delta " << timing.peak_rss_delta_kb << " KB.\n";
+        }
+    }
+
+    constexpr auto max_ratio = 1.5;
+    constexpr std::int64_t min_delta_ns = 10 * ns_in_millisecond;
+
+    const auto regressions = find_time_regressions(previous, current, max_ratio, min_delta_ns);
+
+    if (previous.empty())
+    {
+        str << "No previous test timings to compare with.\n";
+    }
+    else if (regressions.empty())
+    {
+        str << "No test has become more than " << max_ratio << " times slower.\n";
+    }
+    else
+    {
+        str << regressions.size() << " tests have become more than " << max_ratio << " times slower:\n";
+
+        for (const auto &regression : regressions)
+        {
+            str << " '" << regression.name << "' wall ";
+            print_milliseconds(str, regression.previous_wall_ns);
+            str << " -> ";
+            print_milliseconds(str, regression.current_wall_ns);
+            str << ", CPU ";
+            print_milliseconds(str, regression.previous_cpu_ns);
+            str << " -> ";
+            print_milliseconds(str, regression.current_cpu_ns);
+            str << ".\n";
+        }
+    }
+
+    return regressions.size();
+}
@@ -0,0 +1,53 @@
+#pragma once
+#include"test_timing.h"
+#include<cstddef>
+#include<iosfwd>
+
+namespace Standard::Algorithms::Utilities
+{
+    // A test has become slower than in the previous run: either the wall or CPU time has grown.
+    struct test_time_regression final
+    {
+        // NOLINTNEXTLINE
+        std::string name{};
+
+        // NOLINTNEXTLINE
+        std::int64_t previous_wall_ns{};
+
+        // NOLINTNEXTLINE
+        std::int64_t current_wall_ns{};
+
+        // NOLINTNEXTLINE
+        std::int64_t previous_cpu_ns{};
+
+        // NOLINTNEXTLINE
+        std::int64_t current_cpu_ns{};
+
+        [[nodiscard]] constexpr auto operator<=> (const test_time_regression &) const noexcept = default;
+    };
+
+    auto operator<< (std::ostream &str, const test_time_regression &regression) -> std::ostream &;
+
+    // The timings are stored as CSV lines "wall_ns,cpu_ns,peak_rss_delta_kb,name" after a header line.
+    // The name goes last as it might contain a comma.
+    void write_test_timings(std::ostream &str, const test_timings_t &timings);
+
+    [[nodiscard]] auto read_test_timings(std::istream &str) -> test_timings_t;
+
+    // Return empty timings when the file does not exist.
+    [[nodiscard]] auto load_test_timings(const std::string &file_name) -> test_timings_t;
+
+    // The file is replaced atomically: a temporary file is written, and then renamed.
+    void save_test_timings(const std::string &file_name, const test_timings_t &timings);
+
+    // Find the tests, present in both runs, whose wall or CPU time has grown
+    // more than "max_ratio" times, and by at least "min_delta_ns" to ignore the noise of quick tests.
+    // The result is sorted by name.
+    [[nodiscard]] auto find_time_regressions(const test_timings_t &previous, const test_timings_t &current,
+        double max_ratio, std::int64_t min_delta_ns) -> std::vector<test_time_regression>;
+
+    // Print the "top_count" slowest tests, and the regressions against the previous run.
+    // Return the number of regressions.
+    auto print_test_timings_report(std::ostream &str, const test_timings_t &previous, const test_timings_t &current,
+        std::size_t top_count) -> std::size_t;
+} // namespace Standard::Algorithms::Utilities
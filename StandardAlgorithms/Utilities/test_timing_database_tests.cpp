@@ -0,0 +1,110 @@
+#include"test_timing_database_tests.h"
+#include"ert.h"
+#include"test_timing_database.h"
+#include<filesystem>
+#include<sstream>
+
+namespace
+{
+    using test_timing = Standard::Algorithms::Utilities::test_timing;
+    using test_timings_t = Standard::Algorithms::Utilities::test_timings_t;
+    using test_time_regression = Standard::Algorithms::Utilities::test_time_regression;
+
+    constexpr std::int64_t ms = 1'000'000;
+
+    void round_trip_tests()
+    {
+        const test_timings_t expected{// NOLINTNEXTLINE
+            { "a_tests", 5 * ms, 4 * ms, 0 }, // NOLINTNEXTLINE
+            { "#slow, with a comma", 900 * ms, 850 * ms, 1'024 }, // NOLINTNEXTLINE
+            { "  leading and trailing spaces ", 2 * ms, 1 * ms, 0 }, // NOLINTNEXTLINE
+            { "z_tests", 1, 0, -3 }
+        };
+
+        std::stringstream str;
+        Standard::Algorithms::Utilities::write_test_timings(str, expected);
+
+        const auto actual = Standard::Algorithms::Utilities::read_test_timings(str);
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "test timings round trip");
+
+        std::stringstream empty;
+        const auto none = Standard::Algorithms::Utilities::read_test_timings(empty);
+        ::Standard::Algorithms::ert::are_equal(true, none.empty(), "empty test timings");
+
+        for (const auto *const bad : { "1,2,3", "1,2, 3,name", "1,x,3,name", "1,2,3," })
+        {
+            std::stringstream wrong;
+            wrong << "wall_ns,cpu_ns,peak_rss_delta_kb,name\n" << bad << '\n';
+
+            ::Standard::Algorithms::ert::expect_exception<std::runtime_error>(
+                "timings line",
+                [&wrong]
+                {
+                    [[maybe_unused]] const auto ignored = Standard::Algorithms::Utilities::read_test_timings(wrong);
+                },
+                std::string("read bad timings '") + bad + "'");
+        }
+    }
+
+    void save_load_tests()
+    {
+        const auto file_name =
+            (std::filesystem::temp_directory_path() / "standard_algorithms_test_timings_tests.csv").string();
+
+        const test_timings_t expected{// NOLINTNEXTLINE
+            { "saved", 7 * ms, 6 * ms, 5 }
+        };
+
+        Standard::Algorithms::Utilities::save_test_timings(file_name, expected);
+        // Overwrite.
+        Standard::Algorithms::Utilities::save_test_timings(file_name, expected);
+
+        const auto actual = Standard::Algorithms::Utilities::load_test_timings(file_name);
+        const auto has_temp = std::filesystem::exists(file_name + ".tmp");
+        std::filesystem::remove(file_name);
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "saved test timings");
+        ::Standard::Algorithms::ert::are_equal(false, has_temp, "the temporary timings file is left");
+    }
+
+    void regression_tests()
+    {
+        const test_timings_t previous{// NOLINTNEXTLINE
+            { "fast", 1 * ms, 1 * ms, 0 }, // NOLINTNEXTLINE
+            { "same", 100 * ms, 100 * ms, 0 }, // NOLINTNEXTLINE
+            { "slower", 100 * ms, 100 * ms, 0 }, // NOLINTNEXTLINE
+            { "busier", 100 * ms, 20 * ms, 0 }, // NOLINTNEXTLINE
+            { "removed", 10 * ms, 10 * ms, 0 }
+        };
+
+        const test_timings_t current{// The "fast" one is 5 times slower, but by less than the minimum delta.
+            // NOLINTNEXTLINE
+            { "fast", 5 * ms, 5 * ms, 0 }, // NOLINTNEXTLINE
+            { "same", 120 * ms, 120 * ms, 0 }, // NOLINTNEXTLINE
+            { "new", 500 * ms, 500 * ms, 0 }, // NOLINTNEXTLINE
+            { "slower", 300 * ms, 300 * ms, 0 }, // The wall time is the same, but the CPU time has grown.
+            // NOLINTNEXTLINE
+            { "busier", 100 * ms, 90 * ms, 0 }
+        };
+
+        constexpr auto max_ratio = 1.5;
+        constexpr auto min_delta_ns = 10 * ms;
+
+        const auto actual =
+            Standard::Algorithms::Utilities::find_time_regressions(previous, current, max_ratio, min_delta_ns);
+
+        const std::vector<test_time_regression> expected{// NOLINTNEXTLINE
+            { "busier", 100 * ms, 100 * ms, 20 * ms, 90 * ms }, // NOLINTNEXTLINE
+            { "slower", 100 * ms, 300 * ms, 100 * ms, 300 * ms }
+        };
+
+        ::Standard::Algorithms::ert::are_equal(expected, actual, "find_time_regressions");
+    }
+} // namespace
+
+void Standard::Algorithms::Utilities::Tests::test_timing_database_tests()
+{
+    round_trip_tests();
+    save_load_tests();
+    regression_tests();
+}
@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Standard::Algorithms::Utilities::Tests
+{
+    void test_timing_database_tests();
+}
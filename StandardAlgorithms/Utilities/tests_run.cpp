@@ -5,12 +5,16 @@
 #include"task_runner.h"
 #include"test_named_functor.h"
 #include"test_run_context.h"
+#include"test_timing_database.h"
 #include"tests.h"
 #include<algorithm>
+#include<array>
 #include<functional>
 #include<iostream>
 #include<optional>
+#include<string_view>
 #include<tuple>
+#include<unordered_map>
 
 namespace
 {
@@ -77,6 +81,182 @@ namespace
         }
     }
 
+    using runner_t =
+        Standard::Algorithms::Utilities::task_runner<full_function_t, Standard::Algorithms::Tests::test_run_context *>;
+
+    using cost_t = runner_t::cost_t;
+    using test_timings_t = Standard::Algorithms::Utilities::test_timings_t;
+
+    // The per test timings of the previous run are kept in the current directory.
+    constexpr auto timings_file_name = "test_timings.csv";
+
+    constexpr std::size_t slowest_tests_to_print = 10;
+
+    // A long time running test name starts with this prefix, see "gather_all_tests".
+    constexpr auto long_time_running_char = '#';
+
+    // The previous wall time is the cost of a test.
+    // A new test is assumed to be cheap, unless it has the long time running prefix.
+    [[nodiscard]] auto to_costs(const std::vector<Standard::Algorithms::test_function> &tests,
+        const test_timings_t &previous) -> std::vector<cost_t>
+    {
+        std::unordered_map<std::string, cost_t> previous_costs;
+        previous_costs.reserve(previous.size());
+
+        cost_t max_cost = 1;
+
+        for (const auto &timing : previous)
+        {
+            previous_costs[timing.name] = timing.wall_ns;
+            max_cost = std::max(max_cost, timing.wall_ns);
+        }
+
+        std::vector<cost_t> costs(tests.size());
+
+        std::transform(tests.cbegin(), tests.cend(), costs.begin(),
+            [&previous_costs, max_cost] [[nodiscard]] (const auto &test)
+            {
+                if (const auto ite = previous_costs.find(test.name); ite != previous_costs.end())
+                {
+                    return ite->second;
+                }
+
+                const auto is_long = !test.name.empty() && test.name[0] == long_time_running_char;
+
+                return is_long ? max_cost : cost_t{};
+            });
+
+        return costs;
+    }
+
+    // These tests run alone, after all the others have finished:
+    // the hardware performance counters count the whole process, the other running tests included.
+    // The rest of the tests do not share mutable state: each random generator is a local object,
+    // and the printing to "std::cout" is either disabled at compile time, or locked by the console mutex.
+    constexpr std::array serial_test_names{ std::string_view("perf_counters_tests") };
+
+    [[nodiscard]] constexpr auto is_serial_test(const std::string &name) -> bool
+    {
+        return std::find(serial_test_names.cbegin(), serial_test_names.cend(), name) != serial_test_names.cend();
+    }
+
+    // Run the "indexes" subset of the tests; the errors get the original indexes.
+    void run_test_group(const std::vector<std::size_t> &indexes, const std::size_t cpu_count,
+        const std::vector<full_function_t> &test_functors, const std::vector<cost_t> &costs,
+        Standard::Algorithms::Tests::test_run_context &context, bool &has_unknown_error,
+        runner_t::result_vector_t &errors)
+    {
+        if (indexes.empty())
+        {
+            return;
+        }
+
+        std::vector<full_function_t> functors;
+        functors.reserve(indexes.size());
+
+        std::vector<cost_t> group_costs;
+        group_costs.reserve(indexes.size());
+
+        for (const auto &index : indexes)
+        {
+            functors.push_back(test_functors.at(index));
+            group_costs.push_back(costs.at(index));
+        }
+
+        auto group_errors =
+            runner_t::execute_by_costs(nullptr, cpu_count, has_unknown_error, functors, group_costs, &context);
+
+        for (auto &error : group_errors)
+        {
+            std::get<0>(error) = indexes.at(std::get<0>(error));
+            errors.push_back(std::move(error));
+        }
+    }
+
+    // The serial tests run on a single core after the parallel ones.
+    // The errors are sorted by the test index.
+    [[nodiscard]] auto run_parallel_then_serial(const std::size_t cpu_count,
+        const std::vector<Standard::Algorithms::test_function> &tests,
+        const std::vector<full_function_t> &test_functors, const std::vector<cost_t> &costs,
+        Standard::Algorithms::Tests::test_run_context &context, bool &has_unknown_error) -> runner_t::result_vector_t
+    {
+        std::vector<std::size_t> parallel_indexes;
+        std::vector<std::size_t> serial_indexes;
+
+        for (std::size_t index{}; index < tests.size(); ++index)
+        {
+            auto &indexes = is_serial_test(tests[index].name) ? serial_indexes : parallel_indexes;
+            indexes.push_back(index);
+        }
+
+        runner_t::result_vector_t errors;
+
+        run_test_group(parallel_indexes, cpu_count, test_functors, costs, context, has_unknown_error, errors);
+
+        constexpr std::size_t serial_cpu_count = Standard::Algorithms::single_core;
+
+        run_test_group(serial_indexes, serial_cpu_count, test_functors, costs, context, has_unknown_error, errors);
+
+        std::sort(errors.begin(), errors.end(),
+            [] [[nodiscard]] (const auto &one, const auto &two)
+            {
+                return std::get<0>(one) < std::get<0>(two);
+            });
+
+        return errors;
+    }
+
+    [[nodiscard]] auto load_previous_timings_safe() -> test_timings_t
+    {
+        try
+        {
+            return Standard::Algorithms::Utilities::load_test_timings(timings_file_name);
+        }
+        catch (const std::exception &exc)
+        {
+            const Standard::Algorithms::Colors::warn_color color;
+
+            std::cout << "Ignoring the previous test timings: " << exc.what() << '\n';
+        }
+
+        return {};
+    }
+
+    // Return the number of regressions.
+    // A slow run must not become the new baseline, so the previous timings are kept when there is a regression.
+    [[nodiscard]] auto report_and_save_timings_safe(const test_timings_t &previous, test_timings_t &current)
+        -> std::size_t
+    {
+        std::size_t regression_count{};
+
+        try
+        {
+            std::sort(current.begin(), current.end());
+
+            regression_count = Standard::Algorithms::Utilities::print_test_timings_report(
+                std::cout, previous, current, slowest_tests_to_print);
+
+            if (0U < regression_count)
+            {
+                const Standard::Algorithms::Colors::warn_color color;
+
+                std::cout << "Keeping the previous test timings as the baseline.\n";
+            }
+            else
+            {
+                Standard::Algorithms::Utilities::save_test_timings(timings_file_name, current);
+            }
+        }
+        catch (const std::exception &exc)
+        {
+            const Standard::Algorithms::Colors::error_color color;
+
+            std::cout << "Error saving the test timings: " << exc.what() << '\n';
+        }
+
+        return regression_count;
+    }
+
     [[nodiscard]] auto tests_prepared(const bool is_debugger_attached = false)
         -> std::vector<Standard::Algorithms::test_function>
     {
@@ -100,7 +280,7 @@ namespace
     }
 
     void print_errors_safe(const std::vector<Standard::Algorithms::test_function> &tests,
-        const Standard::Algorithms::Utilities::task_runner<>::result_vector_t &errors)
+        const runner_t::result_vector_t &errors)
     {
         const Standard::Algorithms::Colors::error_color color;
 
@@ -131,7 +311,7 @@ namespace
     }
 
     [[nodiscard]] auto run_tests_safe_two(const std::size_t cpu_count, const bool is_debugger_attached)
-        -> std::tuple<std::size_t, std::size_t, bool, std::int64_t>
+        -> std::tuple<std::size_t, std::size_t, bool, std::size_t, std::int64_t>
     {
         const Standard::Algorithms::elapsed_time_ns start_time{};
         std::optional<Standard::Algorithms::ns_elapsed_type> elapsed{};
@@ -140,21 +320,25 @@ namespace
         std::size_t test_count{};
         std::size_t error_count{};
         auto has_unknown_error = false;
+        std::size_t regression_count{};
 
         try
         {
             const auto tests = tests_prepared(is_debugger_attached);
             test_count = tests.size();
 
+            const auto previous_timings = load_previous_timings_safe();
             const auto test_functors = to_functors(tests);
+            const auto costs = to_costs(tests, previous_timings);
 
-            const auto errors = Standard::Algorithms::Utilities::task_runner<full_function_t,
-                Standard::Algorithms::Tests::test_run_context *>::execute(nullptr, cpu_count, has_unknown_error,
-                test_functors, &context);
+            const auto errors =
+                run_parallel_then_serial(cpu_count, tests, test_functors, costs, context, has_unknown_error);
 
             error_count = errors.size();
             elapsed = start_time.elapsed();
 
+            regression_count = report_and_save_timings_safe(previous_timings, context.timings);
+
             if (0U < error_count)
             {
                 print_errors_safe(tests, errors);
@@ -179,7 +363,7 @@ namespace
             throw std::runtime_error("Elapsed has not been set in the tests run.");
         }
 
-        return { test_count, error_count, has_unknown_error, elapsed.value() };
+        return { test_count, error_count, has_unknown_error, regression_count, elapsed.value() };
     }
 } // namespace
 
@@ -195,7 +379,7 @@ namespace
 
     const auto cpu_count = is_debugger_attached ? 1U : 0U;
 
-    const auto &[test_count, error_count, has_unknown_error, elapsed_ns] =
+    const auto &[test_count, error_count, has_unknown_error, regression_count, elapsed_ns] =
         run_tests_safe_two(cpu_count, is_debugger_attached);
 
     if (!has_unknown_error && 0U == error_count)
@@ -225,5 +409,20 @@ namespace
 
     std::cout << " Elapsed time " << elapsed_ns << " nanoseconds.\n";
 
-    return 0;
+    if (0U < regression_count)
+    {
+        const Standard::Algorithms::Colors::error_color color;
+
+        std::cout << regression_count << " tests have become slower.\n";
+    }
+
+    if (has_unknown_error || 0U < error_count)
+    {
+        return 1;
+    }
+
+    // Otherwise, the exit code is the number of regressions.
+    constexpr std::size_t max_exit_code = 100;
+
+    return static_cast<std::int32_t>(std::min(regression_count, max_exit_code));
 }
@@ -1,3 +1,4 @@
+#include"Utilities/benchmarks.h"
 #include"Utilities/console_color.h"
 #include"Utilities/ert.h"
 #include"Utilities/is_debug.h"
@@ -6,8 +7,11 @@
 #include"Utilities/print_utilities.h"
 #include"Utilities/tests.h"
 #include"Utilities/three_numpunct.h"
+#include<algorithm>
 #include<iostream>
 #include<memory>
+#include<span>
+#include<string>
 
 namespace
 {
@@ -40,6 +44,22 @@ namespace
             ::Standard::Algorithms::ert::are_equal(true, is_little, "is little Endian");
         }
     }
+
+    // Run "--benchmark [name filter]" to measure the performance instead of running the tests.
+    [[nodiscard]] auto is_benchmark_run(const std::span<char *> arguments, std::string &filter) -> bool
+    {
+        if (arguments.size() < 2U || std::string(arguments[1]) != "--benchmark")
+        {
+            return false;
+        }
+
+        if (2U < arguments.size())
+        {
+            filter = arguments[2];
+        }
+
+        return true;
+    }
 } // namespace
 
 [[nodiscard]] auto Standard::Algorithms::Utilities::fetch_locale() noexcept -> const std::locale &
@@ -54,7 +74,8 @@ namespace
 
 // todo(p3): modules.
 
-auto main() -> std::int32_t
+// NOLINTNEXTLINE
+auto main(const std::int32_t argc, char *argv[]) -> std::int32_t
 {
     std::int32_t attempt{};
     std::int32_t result{};
@@ -63,6 +84,12 @@ auto main() -> std::int32_t
     {
         init_unsafe();
 
+        if (std::string filter{};
+            is_benchmark_run(std::span<char *>(argv, static_cast<std::size_t>(std::max(argc, 0))), filter))
+        {
+            return Standard::Algorithms::run_all_benchmarks(filter);
+        }
+
         constexpr auto is_debugger_attached = false;
         constexpr auto max_attempts = 1;
 